@@ -42,6 +42,7 @@ SOFTWARE.
 #include <functional>
 #include <iterator>
 #include <stdint.h>
+#include <string.h>
 
 #include "platform.h"
 #include "iterator.h"
@@ -338,6 +339,101 @@ namespace etl
     return o_begin;
   }
 
+  //***************************************************************************
+  /// move
+  /// Moves a range of elements. Copies them if rvalue references are not supported.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/move"></a>
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  TOutputIterator move(TInputIterator  i_begin,
+                       TInputIterator  i_end,
+                       TOutputIterator o_begin)
+  {
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    return std::move(i_begin, i_end, o_begin);
+#else
+    return std::copy(i_begin, i_end, o_begin);
+#endif
+  }
+
+  //***************************************************************************
+  /// move_backward
+  /// Moves a range of elements, starting from the end.
+  /// Copies them if rvalue references are not supported.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/move_backward"></a>
+  //***************************************************************************
+  template <typename TInputIterator,
+            typename TOutputIterator>
+  TOutputIterator move_backward(TInputIterator  i_begin,
+                                TInputIterator  i_end,
+                                TOutputIterator o_end)
+  {
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    return std::move_backward(i_begin, i_end, o_end);
+#else
+    return std::copy_backward(i_begin, i_end, o_end);
+#endif
+  }
+
+  //***************************************************************************
+  /// move
+  /// Trivially copyable elements are moved as a single block.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   move(const T* i_begin, const T* i_end, T* o_begin)
+  {
+    const size_t n = i_end - i_begin;
+
+    memmove(static_cast<void*>(o_begin), static_cast<const void*>(i_begin), n * sizeof(T));
+
+    return o_begin + n;
+  }
+
+  //***************************************************************************
+  /// move
+  /// Trivially copyable elements are moved as a single block.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   move(T* i_begin, T* i_end, T* o_begin)
+  {
+    return etl::move(static_cast<const T*>(i_begin), static_cast<const T*>(i_end), o_begin);
+  }
+
+  //***************************************************************************
+  /// move_backward
+  /// Trivially copyable elements are moved as a single block.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   move_backward(const T* i_begin, const T* i_end, T* o_end)
+  {
+    const size_t n = i_end - i_begin;
+
+    memmove(static_cast<void*>(o_end - n), static_cast<const void*>(i_begin), n * sizeof(T));
+
+    return o_end - n;
+  }
+
+  //***************************************************************************
+  /// move_backward
+  /// Trivially copyable elements are moved as a single block.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   move_backward(T* i_begin, T* i_end, T* o_end)
+  {
+    return etl::move_backward(static_cast<const T*>(i_begin), static_cast<const T*>(i_end), o_end);
+  }
+
   //***************************************************************************
   /// copy_if
   ///\ingroup algorithm
@@ -1113,7 +1209,749 @@ namespace etl
 
     return std::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
+
+  namespace private_algorithm
+  {
+    enum
+    {
+      INSERTION_SORT_THRESHOLD     = 24,  ///< Ranges smaller than this are insertion sorted.
+      NINTHER_THRESHOLD            = 128, ///< Ranges larger than this use the median of three medians.
+      PARTIAL_INSERTION_SORT_LIMIT = 8,   ///< The moves allowed before an attempted insertion sort gives up.
+      STABLE_SORT_RUN              = 16   ///< The length of the insertion sorted runs that stable_sort merges.
+    };
+
+    //*************************************************************************
+    /// floor(log2(n)) for n > 0.
+    //*************************************************************************
+    template <typename TDistance>
+    int log2(TDistance n)
+    {
+      int result = 0;
+
+      while (n > 1)
+      {
+        n >>= 1;
+        ++result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Sorts [begin, end) by insertion.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+      if (begin == end)
+      {
+        return;
+      }
+
+      for (TIterator current = begin + 1; current != end; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != begin) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts [begin, end) by insertion.
+    /// The element before 'begin' must not be greater than any in the range,
+    /// so that no bounds check is needed.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void unguarded_insertion_sort(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+      if (begin == end)
+      {
+        return;
+      }
+
+      for (TIterator current = begin + 1; current != end; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while (compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Attempts an insertion sort of [begin, end), giving up if too many
+    /// elements have to move.
+    ///\return true if the range was sorted.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool partial_insertion_sort(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+      if (begin == end)
+      {
+        return true;
+      }
+
+      size_t moves = 0U;
+
+      for (TIterator current = begin + 1; current != end; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != begin) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+          moves += size_t(current - sift);
+
+          if (moves > PARTIAL_INSERTION_SORT_LIMIT)
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        std::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the three elements, so that *b is the median.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      sort2(a, b, compare);
+      sort2(b, c, compare);
+      sort2(a, b, compare);
+    }
+
+    //*************************************************************************
+    /// Moves 'value' down the heap from 'hole'.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void sift_down(TIterator first, TDistance hole, TDistance length, TValue& value, TCompare compare)
+    {
+      TDistance child = (2 * hole) + 1;
+
+      while (child < length)
+      {
+        if (((child + 1) < length) && compare(*(first + child), *(first + (child + 1))))
+        {
+          ++child;
+        }
+
+        if (!compare(value, *(first + child)))
+        {
+          break;
+        }
+
+        *(first + hole) = ETL_MOVE(*(first + child));
+        hole  = child;
+        child = (2 * hole) + 1;
+      }
+
+      *(first + hole) = ETL_MOVE(value);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void make_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length = last - first;
+      difference_type parent = length / 2;
+
+      while (parent > 0)
+      {
+        --parent;
+        value_type value = ETL_MOVE(*(first + parent));
+        sift_down(first, parent, length, value, compare);
+      }
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      difference_type length = last - first;
+
+      while (length > 1)
+      {
+        --length;
+        value_type value = ETL_MOVE(*(first + length));
+        *(first + length) = ETL_MOVE(*first);
+        sift_down(first, difference_type(0), length, value, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the smallest (middle - first) elements of [first, last) to
+    /// [first, middle), as a heap with the largest at 'first'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_select(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length = middle - first;
+
+      etl::private_algorithm::make_heap(first, middle, compare);
+
+      for (TIterator i = middle; i != last; ++i)
+      {
+        if (compare(*i, *first))
+        {
+          value_type value = ETL_MOVE(*i);
+          *i = ETL_MOVE(*first);
+          sift_down(first, difference_type(0), length, value, compare);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions [begin, end) around the pivot at *begin.
+    /// Elements equal to the pivot go to the right.
+    /// Requires an element not less than the pivot at the end of the range.
+    ///\return The position of the pivot, and whether the range was already partitioned.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    std::pair<TIterator, bool> partition_right(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot = ETL_MOVE(*begin);
+
+      TIterator first = begin;
+      TIterator last  = end;
+
+      // Find the first element not less than the pivot.
+      while (compare(*++first, pivot))
+      {
+      }
+
+      // Find the last element less than the pivot.
+      // Guarded if there was no element less than the pivot before 'first'.
+      if ((first - 1) == begin)
+      {
+        while (((last - first) > 0) && !compare(*--last, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = ((last - first) <= 0);
+
+      while ((last - first) > 0)
+      {
+        std::iter_swap(first, last);
+
+        while (compare(*++first, pivot))
+        {
+        }
+
+        while (!compare(*--last, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = first - 1;
+      *begin          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return std::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions [begin, end) around the pivot at *begin.
+    /// Elements equal to the pivot go to the left. Used when the pivot equals
+    /// the element before the range, so the left part is all equal.
+    ///\return The position of the pivot.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot = ETL_MOVE(*begin);
+
+      TIterator first = begin;
+      TIterator last  = end;
+
+      while (compare(pivot, *--last))
+      {
+      }
+
+      if ((last + 1) == end)
+      {
+        while (((last - first) > 0) && !compare(pivot, *++first))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      while ((last - first) > 0)
+      {
+        std::iter_swap(first, last);
+
+        while (compare(pivot, *--last))
+        {
+        }
+
+        while (!compare(pivot, *++first))
+        {
+        }
+      }
+
+      TIterator pivot_position = last;
+      *begin          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return pivot_position;
+    }
+
+    //*************************************************************************
+    /// Chooses a pivot and moves it to *begin. Uses the median of three, or
+    /// the median of three medians for large ranges.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void choose_pivot(TIterator begin, TIterator end, TCompare compare)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type size = end - begin;
+      const difference_type half = size / 2;
+
+      if (size > NINTHER_THRESHOLD)
+      {
+        sort3(begin,              begin + half,       end - 1, compare);
+        sort3(begin + 1,          begin + (half - 1), end - 2, compare);
+        sort3(begin + 2,          begin + (half + 1), end - 3, compare);
+        sort3(begin + (half - 1), begin + half,       begin + (half + 1), compare);
+        std::iter_swap(begin, begin + half);
+      }
+      else
+      {
+        sort3(begin + half, begin, end - 1, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps a few elements of an unbalanced partition, to break up patterns
+    /// that would otherwise give bad pivots again.
+    //*************************************************************************
+    template <typename TIterator>
+    void break_patterns(TIterator begin, TIterator end)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type size = end - begin;
+
+      if (size >= INSERTION_SORT_THRESHOLD)
+      {
+        const difference_type quarter = size / 4;
+
+        std::iter_swap(begin,   begin + quarter);
+        std::iter_swap(end - 1, end - quarter);
+
+        if (size > NINTHER_THRESHOLD)
+        {
+          std::iter_swap(begin + 1, begin + (quarter + 1));
+          std::iter_swap(begin + 2, begin + (quarter + 2));
+          std::iter_swap(end - 2,   end - (quarter + 1));
+          std::iter_swap(end - 3,   end - (quarter + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pattern-defeating quicksort.
+    /// See "Pattern-defeating Quicksort", Orson Peters, 2021.
+    /// The smaller part is sorted recursively, so the depth is at most log2(n).
+    ///\param bad_allowed The unbalanced partitions allowed before heap sort is used.
+    ///\param leftmost    Whether there are no elements before the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void pdqsort(TIterator begin, TIterator end, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+      for (;;)
+      {
+        const difference_type size = end - begin;
+
+        if (size < INSERTION_SORT_THRESHOLD)
+        {
+          if (leftmost)
+          {
+            insertion_sort(begin, end, compare);
+          }
+          else
+          {
+            unguarded_insertion_sort(begin, end, compare);
+          }
+
+          return;
+        }
+
+        choose_pivot(begin, end, compare);
+
+        // If the pivot equals the element before the range, then every element
+        // equal to the pivot can be put in place in one pass.
+        if (!leftmost && !compare(*(begin - 1), *begin))
+        {
+          begin = partition_left(begin, end, compare) + 1;
+          continue;
+        }
+
+        const std::pair<TIterator, bool> partition = partition_right(begin, end, compare);
+
+        const TIterator       pivot_position      = partition.first;
+        const bool            already_partitioned = partition.second;
+        const difference_type left_size           = pivot_position - begin;
+        const difference_type right_size          = end - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          // Too many bad pivots, so guarantee O(n log n).
+          if (--bad_allowed == 0)
+          {
+            etl::private_algorithm::make_heap(begin, end, compare);
+            etl::private_algorithm::sort_heap(begin, end, compare);
+            return;
+          }
+
+          break_patterns(begin, pivot_position);
+          break_patterns(pivot_position + 1, end);
+        }
+        else if (already_partitioned &&
+                 partial_insertion_sort(begin, pivot_position, compare) &&
+                 partial_insertion_sort(pivot_position + 1, end, compare))
+        {
+          // Nearly sorted input.
+          return;
+        }
+
+        if (left_size < right_size)
+        {
+          pdqsort(begin, pivot_position, compare, bad_allowed, leftmost);
+          begin    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          pdqsort(pivot_position + 1, end, compare, bad_allowed, false);
+          end = pivot_position;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last) in place,
+    /// with rotations.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void merge_in_place(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if ((length1 + length2) == 2)
+        {
+          sort2(first, middle, compare);
+          return;
+        }
+
+        TIterator first_cut;
+        TIterator second_cut;
+        TDistance length11;
+        TDistance length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = first + length11;
+          second_cut = std::lower_bound(middle, last, *first_cut, compare);
+          length22   = second_cut - middle;
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = middle + length22;
+          first_cut  = std::upper_bound(first, middle, *second_cut, compare);
+          length11   = first_cut - first;
+        }
+
+        std::rotate(first_cut, middle, second_cut);
+        const TIterator new_middle = first_cut + length22;
+
+        // Recurse on the smaller half, and loop on the larger.
+        if ((length11 + length22) < ((length1 - length11) + (length2 - length22)))
+        {
+          merge_in_place(first, first_cut, new_middle, length11, length22, compare);
+
+          first   = new_middle;
+          middle  = second_cut;
+          length1 = length1 - length11;
+          length2 = length2 - length22;
+        }
+        else
+        {
+          merge_in_place(new_middle, second_cut, last, length1 - length11, length2 - length22, compare);
+
+          middle  = first_cut;
+          last    = new_middle;
+          length1 = length11;
+          length2 = length22;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range.
+  /// Uses pattern-defeating quicksort. Falls back to heap sort if it meets too
+  /// many bad pivots, so is O(n log n) in the worst case, as for introsort.
+  /// Sorted, reversed and mostly equal ranges take linear time.
+  /// Does not allocate. Not stable.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/sort"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    if (first != last)
+    {
+      etl::private_algorithm::pdqsort(first, last, compare, etl::private_algorithm::log2(last - first) + 1, true);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/sort"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    etl::sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range, using heap sort.
+  /// O(n log n) in all cases, and does not allocate. Not stable.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void heap_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    etl::private_algorithm::make_heap(first, last, compare);
+    etl::private_algorithm::sort_heap(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range, using heap sort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void heap_sort(TIterator first, TIterator last)
+  {
+    etl::heap_sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range, keeping the order of equal elements.
+  /// An in-place merge sort. It does not allocate or need a buffer, at the
+  /// cost of O(n log^2 n) moves.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/stable_sort"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+    const difference_type length = last - first;
+    const difference_type run    = etl::private_algorithm::STABLE_SORT_RUN;
+
+    // Insertion sort short runs.
+    for (difference_type i = 0; i < length; i += run)
+    {
+      const difference_type end = ((length - i) > run) ? i + run : length;
+
+      etl::private_algorithm::insertion_sort(first + i, first + end, compare);
+    }
+
+    // Merge pairs of runs, doubling the run length each pass.
+    for (difference_type width = run; width < length; width *= 2)
+    {
+      for (difference_type i = 0; (i + width) < length; i += 2 * width)
+      {
+        const TIterator       begin  = first + i;
+        const TIterator       middle = begin + width;
+        const difference_type length2 = ((length - (i + width)) > width) ? width : length - (i + width);
+
+        // Skip runs that are already in order.
+        if (compare(*middle, *(middle - 1)))
+        {
+          etl::private_algorithm::merge_in_place(begin, middle, middle + length2, width, length2, compare);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements in the range, keeping the order of equal elements.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/stable_sort"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    etl::stable_sort(first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements of the range into
+  /// [first, middle). The order of the rest is unspecified.
+  /// Uses heap select, O(n log m) and does not allocate.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    etl::private_algorithm::heap_select(first, middle, last, compare);
+    etl::private_algorithm::sort_heap(first, middle, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements of the range into
+  /// [first, middle).
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::partial_sort(first, middle, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Puts the element that would be at 'nth' in a sorted range there, with
+  /// no greater elements before it and no smaller elements after it.
+  /// Uses quickselect, falling back to heap select if it meets too many bad
+  /// pivots. O(n) on average, O(n log n) in the worst case. Does not allocate.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
+  {
+    if ((first == last) || (nth == last))
+    {
+      return;
+    }
+
+    int depth = 2 * etl::private_algorithm::log2(last - first);
+
+    while ((last - first) > 3)
+    {
+      if (depth-- == 0)
+      {
+        etl::private_algorithm::heap_select(first, nth + 1, last, compare);
+        std::iter_swap(first, nth);
+        return;
+      }
+
+      etl::private_algorithm::sort3(first + ((last - first) / 2), first, last - 1, compare);
+
+      const TIterator pivot_position = etl::private_algorithm::partition_right(first, last, compare).first;
+
+      if (pivot_position == nth)
+      {
+        return;
+      }
+      else if ((pivot_position - nth) > 0)
+      {
+        last = pivot_position;
+      }
+      else
+      {
+        first = pivot_position + 1;
+      }
+    }
+
+    etl::private_algorithm::insertion_sort(first, last, compare);
+  }
+
+  //***************************************************************************
+  /// Puts the element that would be at 'nth' in a sorted range there.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void nth_element(TIterator first, TIterator nth, TIterator last)
+  {
+    etl::nth_element(first, nth, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
 }
 
 #endif
-
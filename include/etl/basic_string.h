@@ -48,6 +48,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "integral_limits.h"
 #include "exception.h"
+#include "private/string_search.h"
 
 #define ETL_FILE "27"
 
@@ -1049,16 +1050,7 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = std::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return search(pos, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1075,16 +1067,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return search(pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1102,16 +1085,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return search(pos, s, n);
     }
 
     //*********************************************************************
@@ -1121,16 +1095,14 @@ namespace etl
     //*********************************************************************
     size_t find(T c, size_t position = 0) const
     {
-      const_iterator i = std::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return std::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p = private_string_search::find_char(p_buffer + position, p_buffer + size(), c);
+
+      return (p != (p_buffer + size())) ? size_t(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -1562,15 +1534,11 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_t i = position; i < size(); ++i)
+        const_pointer p = private_string_search::find_first_of(p_buffer + position, p_buffer + size(), s, n, true);
+
+        if (p != (p_buffer + size()))
         {
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
+          return p - p_buffer;
         }
       }
 
@@ -1584,18 +1552,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1633,23 +1590,9 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_pointer p = private_string_search::find_last_of(p_buffer, p_buffer + position + 1, s, n, true);
 
-      while (it != rend())
-      {
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p != (p_buffer + position + 1)) ? size_t(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -1712,22 +1655,11 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_t i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
+        const_pointer p = private_string_search::find_first_of(p_buffer + position, p_buffer + size(), s, n, false);
 
-          if (!found)
-          {
-            return i;
-          }
+        if (p != (p_buffer + size()))
+        {
+          return p - p_buffer;
         }
       }
 
@@ -1790,30 +1722,9 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
+      const_pointer p = private_string_search::find_last_of(p_buffer, p_buffer + position + 1, s, n, false);
 
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p != (p_buffer + position + 1)) ? size_t(p - p_buffer) : npos;
     }
 
     //*********************************************************************
@@ -1967,6 +1878,16 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Substring search helper function
+    //*************************************************************************
+    size_t search(size_t position, const_pointer s, size_t n) const
+    {
+      const_pointer p = private_string_search::search(p_buffer + position, p_buffer + size(), s, n);
+
+      return (p != (p_buffer + size())) ? size_t(p - p_buffer) : npos;
+    }
+
     // Disable copy construction.
     ibasic_string(const ibasic_string&);
 
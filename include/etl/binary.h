@@ -50,6 +50,14 @@ SOFTWARE.
 #undef ETL_FILE
 #define ETL_FILE "50"
 
+// The population count builtins are only faster than the portable code if the
+// target has a population count instruction, otherwise they become library calls.
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED && (defined(__POPCNT__) || defined(__aarch64__))
+  #define ETL_BUILTIN_POPCOUNT_SUPPORTED 1
+#else
+  #define ETL_BUILTIN_POPCOUNT_SUPPORTED 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -183,31 +191,122 @@ namespace etl
 
   //***************************************************************************
   /// Reverse bits.
+  /// Uses a byte swap instruction for the final steps if the profile supports it.
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  uint8_t reverse_bits(uint8_t value);
-  inline int8_t reverse_bits(int8_t value) { return int8_t(reverse_bits(uint8_t(value))); }
+  inline ETL_CONSTEXPR14 uint8_t reverse_bits(uint8_t value)
+  {
+    value = ((value & 0xAA) >> 1) | ((value & 0x55) << 1);
+    value = ((value & 0xCC) >> 2) | ((value & 0x33) << 2);
+    value = (value >> 4) | (value << 4);
+
+    return value;
+  }
+
+  inline ETL_CONSTEXPR14 int8_t reverse_bits(int8_t value) { return int8_t(reverse_bits(uint8_t(value))); }
+#endif
+
+  inline ETL_CONSTEXPR14 uint16_t reverse_bits(uint16_t value)
+  {
+    value = ((value & 0xAAAA) >> 1) | ((value & 0x5555) << 1);
+    value = ((value & 0xCCCC) >> 2) | ((value & 0x3333) << 2);
+    value = ((value & 0xF0F0) >> 4) | ((value & 0x0F0F) << 4);
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    value = __builtin_bswap16(value);
+#else
+    value = (value >> 8) | (value << 8);
 #endif
-  uint16_t reverse_bits(uint16_t value);
-  inline int16_t reverse_bits(int16_t value) { return int16_t(reverse_bits(uint16_t(value))); }
-  uint32_t reverse_bits(uint32_t value);
-  inline int32_t reverse_bits(int32_t value) { return int32_t(reverse_bits(uint32_t(value))); }
-  uint64_t reverse_bits(uint64_t value);
-  inline int64_t reverse_bits(int64_t value) { return int64_t(reverse_bits(uint64_t(value))); }
+
+    return value;
+  }
+
+  inline ETL_CONSTEXPR14 int16_t reverse_bits(int16_t value) { return int16_t(reverse_bits(uint16_t(value))); }
+
+  inline ETL_CONSTEXPR14 uint32_t reverse_bits(uint32_t value)
+  {
+    value = ((value & 0xAAAAAAAA) >>  1) | ((value & 0x55555555) <<  1);
+    value = ((value & 0xCCCCCCCC) >>  2) | ((value & 0x33333333) <<  2);
+    value = ((value & 0xF0F0F0F0) >>  4) | ((value & 0x0F0F0F0F) <<  4);
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    value = __builtin_bswap32(value);
+#else
+    value = ((value & 0xFF00FF00) >>  8) | ((value & 0x00FF00FF) <<  8);
+    value = (value >> 16) | (value << 16);
+#endif
+
+    return value;
+  }
+
+  inline ETL_CONSTEXPR14 int32_t reverse_bits(int32_t value) { return int32_t(reverse_bits(uint32_t(value))); }
+
+  inline ETL_CONSTEXPR14 uint64_t reverse_bits(uint64_t value)
+  {
+    value = ((value & 0xAAAAAAAAAAAAAAAA) >>  1) | ((value & 0x5555555555555555) <<  1);
+    value = ((value & 0xCCCCCCCCCCCCCCCC) >>  2) | ((value & 0x3333333333333333) <<  2);
+    value = ((value & 0xF0F0F0F0F0F0F0F0) >>  4) | ((value & 0x0F0F0F0F0F0F0F0F) <<  4);
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    value = __builtin_bswap64(value);
+#else
+    value = ((value & 0xFF00FF00FF00FF00) >>  8) | ((value & 0x00FF00FF00FF00FF) <<  8);
+    value = ((value & 0xFFFF0000FFFF0000) >> 16) | ((value & 0x0000FFFF0000FFFF) << 16);
+    value = (value >> 32) | (value << 32);
+#endif
+
+    return value;
+  }
+
+  inline ETL_CONSTEXPR14 int64_t reverse_bits(int64_t value) { return int64_t(reverse_bits(uint64_t(value))); }
 
   //***************************************************************************
   /// Reverse bytes.
+  /// Uses a byte swap instruction if the profile supports it.
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  inline uint8_t reverse_bytes(uint8_t value) { return value; }
-  inline int8_t reverse_bytes(int8_t value) { return value; }
+  inline ETL_CONSTEXPR uint8_t reverse_bytes(uint8_t value) { return value; }
+  inline ETL_CONSTEXPR int8_t reverse_bytes(int8_t value) { return value; }
+#endif
+
+  inline ETL_CONSTEXPR14 uint16_t reverse_bytes(uint16_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return __builtin_bswap16(value);
+#else
+    value = (value >> 8) | (value << 8);
+
+    return value;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 int16_t reverse_bytes(int16_t value) { return int16_t(reverse_bytes(uint16_t(value))); }
+
+  inline ETL_CONSTEXPR14 uint32_t reverse_bytes(uint32_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return __builtin_bswap32(value);
+#else
+    value = ((value & 0xFF00FF00) >> 8) | ((value & 0x00FF00FF) << 8);
+    value = (value >> 16) | (value << 16);
+
+    return value;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 int32_t reverse_bytes(int32_t value) { return int32_t(reverse_bytes(uint32_t(value))); }
+
+  inline ETL_CONSTEXPR14 uint64_t reverse_bytes(uint64_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return __builtin_bswap64(value);
+#else
+    value = ((value & 0xFF00FF00FF00FF00) >> 8)  | ((value & 0x00FF00FF00FF00FF) << 8);
+    value = ((value & 0xFFFF0000FFFF0000) >> 16) | ((value & 0x0000FFFF0000FFFF) << 16);
+    value = (value >> 32) | (value << 32);
+
+    return value;
 #endif
-  uint16_t reverse_bytes(uint16_t value);
-  inline int16_t reverse_bytes(int16_t value) { return int16_t(reverse_bytes(uint16_t(value))); }
-  uint32_t reverse_bytes(uint32_t value);
-  inline int32_t reverse_bytes(int32_t value) { return int32_t(reverse_bytes(uint32_t(value))); }
-  uint64_t reverse_bytes(uint64_t value);
-  inline int64_t reverse_bytes(int64_t value) { return int64_t(reverse_bytes(uint64_t(value))); }
+  }
+
+  inline ETL_CONSTEXPR14 int64_t reverse_bytes(int64_t value) { return int64_t(reverse_bytes(uint64_t(value))); }
 
   //***************************************************************************
   /// Converts binary to Gray code.
@@ -236,31 +335,140 @@ namespace etl
 
   //***************************************************************************
   /// Count set bits.
+  /// Uses a population count instruction if the profile and target support it.
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  uint_least8_t count_bits(uint8_t value);
-  inline uint_least8_t count_bits(int8_t value) { return count_bits(uint8_t(value)); }
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint8_t value)
+  {
+#if ETL_BUILTIN_POPCOUNT_SUPPORTED
+    return uint_least8_t(__builtin_popcount(value));
+#else
+    uint32_t count = value - ((value >> 1) & 0x55);
+    count = ((count >> 2) & 0x33) + (count & 0x33);
+    count = ((count >> 4) + count) & 0x0F;
+
+    return uint_least8_t(count);
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int8_t value) { return count_bits(uint8_t(value)); }
 #endif
-  uint_least8_t count_bits(uint16_t value);
-  inline uint_least8_t count_bits(int16_t value) { return count_bits(uint16_t(value)); }
-  uint_least8_t count_bits(uint32_t value);
-  inline uint_least8_t count_bits(int32_t value) { return count_bits(uint32_t(value)); }
-  uint_least8_t count_bits(uint64_t value);
-  inline uint_least8_t count_bits(int64_t value) { return count_bits(uint64_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint16_t value)
+  {
+#if ETL_BUILTIN_POPCOUNT_SUPPORTED
+    return uint_least8_t(__builtin_popcount(value));
+#else
+    uint32_t count = value - ((value >> 1) & 0x5555);
+    count = ((count >> 2) & 0x3333) + (count & 0x3333);
+    count = ((count >> 4) + count) & 0x0F0F;
+    count = ((count >> 8) + count) & 0x00FF;
+
+    return uint_least8_t(count);
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int16_t value) { return count_bits(uint16_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint32_t value)
+  {
+#if ETL_BUILTIN_POPCOUNT_SUPPORTED
+    return uint_least8_t(__builtin_popcountl(value));
+#else
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+
+    return uint_least8_t((((value + (value >> 4)) & 0xF0F0F0F) * 0x1010101) >> 24);
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int32_t value) { return count_bits(uint32_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(uint64_t value)
+  {
+#if ETL_BUILTIN_POPCOUNT_SUPPORTED
+    return uint_least8_t(__builtin_popcountll(value));
+#else
+    uint64_t count = value - ((value >> 1) & 0x5555555555555555);
+    count = ((count >>  2) & 0x3333333333333333) + (count & 0x3333333333333333);
+    count = ((count >>  4) + count) & 0x0F0F0F0F0F0F0F0F;
+    count = ((count >>  8) + count) & 0x00FF00FF00FF00FF;
+    count = ((count >> 16) + count) & 0x0000FFFF0000FFFF;
+    count = ((count >> 32) + count) & 0x00000000FFFFFFFF;
+
+    return uint_least8_t(count);
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_bits(int64_t value) { return count_bits(uint64_t(value)); }
 
   //***************************************************************************
   /// Parity. 0 = even, 1 = odd
+  /// Uses a parity instruction if the profile supports it.
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  uint_least8_t parity(uint8_t value);
-  inline uint_least8_t parity(int8_t value) { return parity(uint8_t(value)); }
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint8_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return uint_least8_t(__builtin_parity(value));
+#else
+    value ^= value >> 4;
+    value &= 0x0F;
+
+    return (0x6996 >> value) & 1;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int8_t value) { return parity(uint8_t(value)); }
 #endif
-  uint_least8_t parity(uint16_t value);
-  inline uint_least8_t parity(int16_t value) { return parity(uint16_t(value)); }
-  uint_least8_t parity(uint32_t value);
-  inline uint_least8_t parity(int32_t value) { return parity(uint32_t(value)); }
-  uint_least8_t parity(uint64_t value);
-  inline uint_least8_t parity(int64_t value) { return parity(uint64_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint16_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return uint_least8_t(__builtin_parity(value));
+#else
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value &= 0x0F;
+
+    return (0x6996 >> value) & 1;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int16_t value) { return parity(uint16_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint32_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return uint_least8_t(__builtin_parityl(value));
+#else
+    value ^= value >> 16;
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value &= 0x0F;
+
+    return (0x6996 >> value) & 1;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int32_t value) { return parity(uint32_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(uint64_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return uint_least8_t(__builtin_parityll(value));
+#else
+    value ^= value >> 32;
+    value ^= value >> 16;
+    value ^= value >> 8;
+    value ^= value >> 4;
+    value &= 0x0F;
+
+    return (0x69966996 >> value) & 1;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t parity(int64_t value) { return parity(uint64_t(value)); }
 
   //***************************************************************************
   /// Fold a binary number down to a set number of bits using XOR.
@@ -371,19 +579,208 @@ namespace etl
   }
 
   //***************************************************************************
-  /// Count trailing zeros. bit.
-  /// Uses a binary search.
+  /// Count trailing zeros.
+  /// Uses a count trailing zeros instruction if the profile supports it,
+  /// otherwise a binary search.
+  /// Returns the number of bits in the type if the value is zero.
   //***************************************************************************
 #if ETL_8BIT_SUPPORT
-  uint_least8_t count_trailing_zeros(uint8_t value);
-  inline uint_least8_t count_trailing_zeros(int8_t value) { return count_trailing_zeros(uint8_t(value)); }
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint8_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return (value == 0) ? 8 : uint_least8_t(__builtin_ctz(value));
+#else
+    uint_least8_t count = 0;
+
+    if (value & 0x1)
+    {
+      count = 0;
+    }
+    else if (value == 0)
+    {
+      count = 8;
+    }
+    else
+    {
+      count = 1;
+
+      if ((value & 0xF) == 0)
+      {
+        value >>= 4;
+        count += 4;
+      }
+
+      if ((value & 0x3) == 0)
+      {
+        value >>= 2;
+        count += 2;
+      }
+
+      count -= value & 0x1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int8_t value) { return count_trailing_zeros(uint8_t(value)); }
 #endif
-  uint_least8_t count_trailing_zeros(uint16_t value);
-  inline uint_least8_t count_trailing_zeros(int16_t value) { return count_trailing_zeros(uint16_t(value)); }
-  uint_least8_t count_trailing_zeros(uint32_t value);
-  inline uint_least8_t count_trailing_zeros(int32_t value) { return count_trailing_zeros(uint32_t(value)); }
-  uint_least8_t count_trailing_zeros(uint64_t value);
-  inline uint_least8_t count_trailing_zeros(int64_t value) { return count_trailing_zeros(uint64_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint16_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return (value == 0) ? 16 : uint_least8_t(__builtin_ctz(value));
+#else
+    uint_least8_t count = 0;
+
+    if (value & 0x1)
+    {
+      count = 0;
+    }
+    else if (value == 0)
+    {
+      count = 16;
+    }
+    else
+    {
+      count = 1;
+
+      if ((value & 0xFF) == 0)
+      {
+        value >>= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF) == 0)
+      {
+        value >>= 4;
+        count += 4;
+      }
+
+      if ((value & 0x3) == 0)
+      {
+        value >>= 2;
+        count += 2;
+      }
+
+      count -= value & 0x1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int16_t value) { return count_trailing_zeros(uint16_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint32_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return (value == 0) ? 32 : uint_least8_t(__builtin_ctzl(value));
+#else
+    uint_least8_t count = 0;
+
+    if (value & 0x1)
+    {
+      count = 0;
+    }
+    else if (value == 0)
+    {
+      count = 32;
+    }
+    else
+    {
+      count = 1;
+
+      if ((value & 0xFFFF) == 0)
+      {
+        value >>= 16;
+        count += 16;
+      }
+
+      if ((value & 0xFF) == 0)
+      {
+        value >>= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF) == 0)
+      {
+        value >>= 4;
+        count += 4;
+      }
+
+      if ((value & 0x3) == 0)
+      {
+        value >>= 2;
+        count += 2;
+      }
+
+      count -= value & 0x1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int32_t value) { return count_trailing_zeros(uint32_t(value)); }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(uint64_t value)
+  {
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+    return (value == 0) ? 64 : uint_least8_t(__builtin_ctzll(value));
+#else
+    uint_least8_t count = 0;
+
+    if (value & 0x1)
+    {
+      count = 0;
+    }
+    else if (value == 0)
+    {
+      count = 64;
+    }
+    else
+    {
+      count = 1;
+
+      if ((value & 0xFFFFFFFF) == 0)
+      {
+        value >>= 32;
+        count += 32;
+      }
+
+      if ((value & 0xFFFF) == 0)
+      {
+        value >>= 16;
+        count += 16;
+      }
+
+      if ((value & 0xFF) == 0)
+      {
+        value >>= 8;
+        count += 8;
+      }
+
+      if ((value & 0xF) == 0)
+      {
+        value >>= 4;
+        count += 4;
+      }
+
+      if ((value & 0x3) == 0)
+      {
+        value >>= 2;
+        count += 2;
+      }
+
+      count -= value & 0x1;
+    }
+
+    return count;
+#endif
+  }
+
+  inline ETL_CONSTEXPR14 uint_least8_t count_trailing_zeros(int64_t value) { return count_trailing_zeros(uint64_t(value)); }
 
   //***************************************************************************
   /// Find the position of the first set bit.
@@ -431,7 +431,7 @@ namespace etl
     //*************************************************************************
     /// Finds the first bit in the specified state.
     ///\param state The state to search for.
-    ///\returns The position of the bit or SIZE if none were found.
+    ///\returns The position of the bit or npos if none were found.
     //*************************************************************************
     size_t find_first(bool state) const
     {
@@ -440,12 +440,18 @@ namespace etl
 
     //*************************************************************************
     /// Finds the next bit in the specified state.
+    /// Searches a whole element at a time.
     ///\param state    The state to search for.
     ///\param position The position to start from.
-    ///\returns The position of the bit or SIZE if none were found.
+    ///\returns The position of the bit or npos if none were found.
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
+      if (position >= NBITS)
+      {
+        return ibitset::npos;
+      }
+
       // Where to start.
       size_t index;
       size_t bit;
@@ -461,42 +467,92 @@ namespace etl
         bit = position & (BITS_PER_ELEMENT - 1);
       }
 
-      element_t mask = 1 << bit;
+      // Ignore the bits below the start position in the first element.
+      element_t value = element_t(get_element(index, state) & element_t(ALL_SET << bit));
 
       // For each element in the bitset...
-      while (index < SIZE)
+      while (true)
       {
-        element_t value = pdata[index];
-
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
+        if (value != ALL_CLEAR)
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
+          position = (index * BITS_PER_ELEMENT) + etl::count_trailing_zeros(value);
 
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          return (position < NBITS) ? position : size_t(ibitset::npos);
         }
-        else
+
+        if (++index == SIZE)
         {
-          position += BITS_PER_ELEMENT;
+          return ibitset::npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+        value = get_element(index, state);
+      }
+    }
+
+    //*************************************************************************
+    /// Counts the number of set bits below a position.
+    ///\param position The position to count up to, but not including.
+    ///\returns The number of set bits in the range [0, position).
+    //*************************************************************************
+    size_t rank(size_t position) const
+    {
+      if (position >= NBITS)
+      {
+        return count();
+      }
+
+      size_t index;
+      size_t bit;
+
+      if (SIZE == 1)
+      {
+        index = 0;
+        bit = position;
+      }
+      else
+      {
+        index = position >> log2<BITS_PER_ELEMENT>::value;
+        bit = position & (BITS_PER_ELEMENT - 1);
+      }
+
+      size_t n = 0;
+
+      // The whole elements.
+      for (size_t i = 0; i < index; ++i)
+      {
+        n += etl::count_bits(pdata[i]);
+      }
+
+      // The partial element.
+      n += etl::count_bits(element_t(pdata[index] & element_t(~element_t(ALL_SET << bit))));
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Finds the position of the nth set bit.
+    ///\param n The zero based index of the set bit to find.
+    ///\returns The position of the bit or npos if fewer than n + 1 bits are set.
+    //*************************************************************************
+    size_t select(size_t n) const
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        element_t value = pdata[i];
+        size_t    bits  = etl::count_bits(value);
+
+        if (n < bits)
+        {
+          // Clear the lower set bits that precede the one we want.
+          while (n-- != 0)
+          {
+            value &= element_t(value - 1);
+          }
+
+          return (i * BITS_PER_ELEMENT) + etl::count_trailing_zeros(value);
+        }
 
-        ++index;
+        n -= bits;
       }
 
       return ibitset::npos;
@@ -559,27 +615,60 @@ namespace etl
 
     //*************************************************************************
     /// operator <<=
+    /// Shifts a whole element at a time.
     //*************************************************************************
     ibitset& operator<<=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
+      {
+        reset();
+      }
+      else if (SIZE == 1)
       {
         pdata[0] <<= shift;
+        pdata[0] &= TOP_MASK;
       }
       else
       {
-        size_t source = NBITS - shift - 1;
-        size_t destination = NBITS - 1;
+        const size_t element_shift = shift >> log2<BITS_PER_ELEMENT>::value;
+        const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+        size_t destination = SIZE - 1;
+
+        if (bit_shift == 0)
         {
-          set(destination--, test(source--));
+          while (destination >= element_shift)
+          {
+            pdata[destination] = pdata[destination - element_shift];
+
+            if (destination-- == 0)
+            {
+              break;
+            }
+          }
         }
+        else
+        {
+          const size_t carry_shift = BITS_PER_ELEMENT - bit_shift;
 
-        for (size_t i = 0; i < shift; ++i)
+          while (destination > element_shift)
+          {
+            const size_t source = destination - element_shift;
+
+            pdata[destination] = element_t((pdata[source] << bit_shift) | (pdata[source - 1] >> carry_shift));
+            --destination;
+          }
+
+          pdata[element_shift] = element_t(pdata[0] << bit_shift);
+        }
+
+        // Clear the vacated elements.
+        for (size_t i = 0; i < element_shift; ++i)
         {
-          reset(destination--);
+          pdata[i] = ALL_CLEAR;
         }
+
+        pdata[SIZE - 1] &= TOP_MASK;
       }
 
       return *this;
@@ -587,26 +676,49 @@ namespace etl
 
     //*************************************************************************
     /// operator >>=
+    /// Shifts a whole element at a time.
     //*************************************************************************
     ibitset& operator>>=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
+      {
+        reset();
+      }
+      else if (SIZE == 1)
       {
         pdata[0] >>= shift;
       }
       else
       {
-        size_t source = shift;
-        size_t destination = 0;
+        const size_t element_shift = shift >> log2<BITS_PER_ELEMENT>::value;
+        const size_t bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+        const size_t last          = SIZE - 1 - element_shift;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+        if (bit_shift == 0)
+        {
+          for (size_t destination = 0; destination <= last; ++destination)
+          {
+            pdata[destination] = pdata[destination + element_shift];
+          }
+        }
+        else
         {
-          set(destination++, test(source++));
+          const size_t carry_shift = BITS_PER_ELEMENT - bit_shift;
+
+          for (size_t destination = 0; destination < last; ++destination)
+          {
+            const size_t source = destination + element_shift;
+
+            pdata[destination] = element_t((pdata[source] >> bit_shift) | (pdata[source + 1] << carry_shift));
+          }
+
+          pdata[last] = element_t(pdata[SIZE - 1] >> bit_shift);
         }
 
-        for (size_t i = 0; i < shift; ++i)
+        // Clear the vacated elements.
+        for (size_t i = last + 1; i < SIZE; ++i)
         {
-          reset(destination++);
+          pdata[i] = ALL_CLEAR;
         }
       }
 
@@ -677,6 +789,14 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Gets the element at the index, inverted if searching for clear bits.
+    //*************************************************************************
+    element_t get_element(size_t index, bool state) const
+    {
+      return state ? pdata[index] : element_t(~pdata[index]);
+    }
+
     //*************************************************************************
     /// Gets a reference to the specified bit.
     //*************************************************************************
@@ -0,0 +1,334 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include <stddef.h>
+#include <functional>
+#include <algorithm>
+#include <utility>
+
+#include "platform.h"
+#include "pool.h"
+#include "error_handler.h"
+#include "parameter_type.h"
+#include "private/btree_base.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map based on a B+tree, with a capacity defined at compile time.
+/// Values are held in cache sized leaves, making lookups touch fewer cache
+/// lines than etl::map and range scans run through contiguous memory.
+/// Inserts and erases invalidate all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// Gets the key from a map value.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct map_key
+    {
+      const TKey& operator()(const std::pair<const TKey, TMapped>& value) const
+      {
+        return value.first;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for all etl::btree_map types.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  class ibtree_map : public etl::ibtree<TKey, std::pair<const TKey, TMapped>, private_btree::map_key<TKey, TMapped>, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree<TKey, std::pair<const TKey, TMapped>, private_btree::map_key<TKey, TMapped>, TKeyCompare> base_t;
+
+  public:
+
+    typedef TMapped                        mapped_type;
+    typedef typename base_t::iterator       iterator;
+    typedef typename base_t::const_iterator const_iterator;
+
+  protected:
+
+    typedef typename base_t::key_parameter_t key_parameter_t;
+
+  public:
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default value if the key does not exist.
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(std::make_pair(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not in the range.
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits an etl::btree_out_of_bounds if the key is not in the range.
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated B+tree map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = std::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The pools of leaf and inner nodes.
+    etl::pool<typename base_t::leaf_t,  base_t::template leaf_count<MAX_SIZE>::value>  leaf_pool;
+    etl::pool<typename base_t::inner_t, base_t::template inner_count<MAX_SIZE>::value> inner_pool;
+  };
+}
+
+//***************************************************************************
+/// Equal operator.
+///\param lhs Reference to the first btree_map.
+///\param rhs Reference to the second btree_map.
+///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+///\ingroup btree_map
+//***************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator ==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+//***************************************************************************
+/// Not equal operator.
+///\param lhs Reference to the first btree_map.
+///\param rhs Reference to the second btree_map.
+///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+///\ingroup btree_map
+//***************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator !=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+//*************************************************************************
+/// Less than operator.
+///\param lhs Reference to the first btree_map.
+///\param rhs Reference to the second btree_map.
+///\return <b>true</b> if the first map is lexicographically less than the
+/// second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator <(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+//*************************************************************************
+/// Greater than operator.
+//*************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator >(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return (rhs < lhs);
+}
+
+//*************************************************************************
+/// Less than or equal operator.
+//*************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator <=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return !(lhs > rhs);
+}
+
+//*************************************************************************
+/// Greater than or equal operator.
+//*************************************************************************
+template <typename TKey, typename TMapped, typename TKeyCompare>
+bool operator >=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+{
+  return !(lhs < rhs);
+}
+
+#endif
@@ -0,0 +1,289 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include <stddef.h>
+#include <functional>
+#include <algorithm>
+
+#include "platform.h"
+#include "pool.h"
+#include "private/btree_base.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  #include <initializer_list>
+#endif
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set based on a B+tree, with a capacity defined at compile time.
+/// Values are held in cache sized leaves, making lookups touch fewer cache
+/// lines than etl::set and range scans run through contiguous memory.
+/// Inserts and erases invalidate all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// Gets the key from a set value.
+    //*************************************************************************
+    template <typename T>
+    struct set_key
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for all etl::btree_set types.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename T, typename TCompare>
+  class ibtree_set : public etl::ibtree<T, const T, private_btree::set_key<T>, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree<T, const T, private_btree::set_key<T>, TCompare> base_t;
+
+  public:
+
+    typedef TCompare value_compare;
+
+    //*************************************************************************
+    /// Returns the value comparison.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->key_comp();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (const ibtree_set& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : base_t(leaf_pool, inner_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated B+tree set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = std::less<T> >
+  class btree_set : public etl::ibtree_set<T, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<T, TCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<T> init)
+      : base_t(leaf_pool, inner_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator = (const btree_set& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The pools of leaf and inner nodes.
+    etl::pool<typename base_t::leaf_t,  base_t::template leaf_count<MAX_SIZE>::value>  leaf_pool;
+    etl::pool<typename base_t::inner_t, base_t::template inner_count<MAX_SIZE>::value> inner_pool;
+  };
+}
+
+//***************************************************************************
+/// Equal operator.
+///\param lhs Reference to the first btree_set.
+///\param rhs Reference to the second btree_set.
+///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+///\ingroup btree_set
+//***************************************************************************
+template <typename T, typename TCompare>
+bool operator ==(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+//***************************************************************************
+/// Not equal operator.
+///\param lhs Reference to the first btree_set.
+///\param rhs Reference to the second btree_set.
+///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+///\ingroup btree_set
+//***************************************************************************
+template <typename T, typename TCompare>
+bool operator !=(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+//*************************************************************************
+/// Less than operator.
+///\param lhs Reference to the first btree_set.
+///\param rhs Reference to the second btree_set.
+///\return <b>true</b> if the first set is lexicographically less than the
+/// second, otherwise <b>false</b>.
+//*************************************************************************
+template <typename T, typename TCompare>
+bool operator <(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+//*************************************************************************
+/// Greater than operator.
+//*************************************************************************
+template <typename T, typename TCompare>
+bool operator >(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return (rhs < lhs);
+}
+
+//*************************************************************************
+/// Less than or equal operator.
+//*************************************************************************
+template <typename T, typename TCompare>
+bool operator <=(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return !(lhs > rhs);
+}
+
+//*************************************************************************
+/// Greater than or equal operator.
+//*************************************************************************
+template <typename T, typename TCompare>
+bool operator >=(const etl::ibtree_set<T, TCompare>& lhs, const etl::ibtree_set<T, TCompare>& rhs)
+{
+  return !(lhs < rhs);
+}
+
+#endif
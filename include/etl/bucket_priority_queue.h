@@ -0,0 +1,467 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BUCKET_PRIORITY_QUEUE_INCLUDED
+#define ETL_BUCKET_PRIORITY_QUEUE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <utility>
+
+#include "platform.h"
+#include "alignment.h"
+#include "binary.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "58"
+
+//*****************************************************************************
+///\defgroup bucket_priority_queue bucket_priority_queue
+/// A fixed capacity priority queue for small integer priorities.
+/// Each priority has a FIFO bucket, and a bitmap records the non-empty
+/// buckets, so push and pop are O(1) for a bounded number of priorities.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for bucket_priority_queue exceptions.
+  ///\ingroup bucket_priority_queue
+  //***************************************************************************
+  class bucket_priority_queue_exception : public etl::exception
+  {
+  public:
+
+    bucket_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup bucket_priority_queue
+  //***************************************************************************
+  class bucket_priority_queue_full : public etl::bucket_priority_queue_exception
+  {
+  public:
+
+    bucket_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : bucket_priority_queue_exception(ETL_ERROR_TEXT("bucket_priority_queue:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a priority is not less than N_PRIORITIES.
+  ///\ingroup bucket_priority_queue
+  //***************************************************************************
+  class bucket_priority_queue_priority : public etl::bucket_priority_queue_exception
+  {
+  public:
+
+    bucket_priority_queue_priority(string_type file_name_, numeric_type line_number_)
+      : bucket_priority_queue_exception(ETL_ERROR_TEXT("bucket_priority_queue:priority", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup bucket_priority_queue
+  ///\brief The base for bucket priority queues of a particular type.
+  ///\details Priority 0 is the highest. Values of equal priority are popped
+  /// in the order that they were pushed.
+  /// \warning This queue cannot be used for concurrent access from multiple threads.
+  /// \tparam T            The type of value that the queue holds.
+  /// \tparam N_PRIORITIES The number of priorities, 0 to N_PRIORITIES - 1.
+  //***************************************************************************
+  template <typename T, const size_t N_PRIORITIES>
+  class ibucket_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_PRIORITIES > 0U, "There must be at least one priority");
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+    typedef size_t   size_type;       ///< The type used for determining the size of the queue.
+    typedef size_t   priority_type;   ///< The type of a priority.
+
+  private:
+
+    static const size_t NONE  = ~size_t(0U);
+    static const size_t WORDS = (N_PRIORITIES + 31U) / 32U;
+
+  public:
+
+    //*************************************************************************
+    /// Gets a reference to the highest priority value.
+    //*************************************************************************
+    reference top()
+    {
+      return p_values[head[top_priority()]];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[head[top_priority()]];
+    }
+
+    //*************************************************************************
+    /// Gets the priority of the highest priority value.
+    /// Returns N_PRIORITIES if the queue is empty.
+    //*************************************************************************
+    priority_type top_priority() const
+    {
+      // Everything below 'lowest_word' is empty.
+      for (size_t word = lowest_word; word < WORDS; ++word)
+      {
+        if (bitmap[word] != 0U)
+        {
+          lowest_word = word;
+          return (word * 32U) + etl::count_trailing_zeros(bitmap[word]);
+        }
+      }
+
+      lowest_word = WORDS;
+
+      return N_PRIORITIES;
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::bucket_priority_queue_full
+    /// if the queue is already full, or an etl::bucket_priority_queue_priority
+    /// if the priority is not less than N_PRIORITIES.
+    //*************************************************************************
+    void push(priority_type priority, const_reference value)
+    {
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::bucket_priority_queue_full));
+      }
+      else if (priority >= N_PRIORITIES)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::bucket_priority_queue_priority));
+      }
+      else
+      {
+        const size_t slot = allocate();
+        ::new (&p_values[slot]) T(value);
+        append(priority, slot);
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the queue by moving it.
+    //*************************************************************************
+    void push(priority_type priority, T&& value)
+    {
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::bucket_priority_queue_full));
+      }
+      else if (priority >= N_PRIORITIES)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::bucket_priority_queue_priority));
+      }
+      else
+      {
+        const size_t slot = allocate();
+        ::new (&p_values[slot]) T(std::move(value));
+        append(priority, slot);
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        const size_t priority = top_priority();
+        const size_t slot     = head[priority];
+
+        head[priority] = p_next[slot];
+
+        if (head[priority] == NONE)
+        {
+          bitmap[priority / 32U] &= ~(uint32_t(1U) << (priority % 32U));
+        }
+
+        p_values[slot].~T();
+        release(slot);
+        --current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value, assigns it to destination and
+    /// removes it from the queue.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = ETL_MOVE(top());
+      pop();
+    }
+
+    //*************************************************************************
+    /// Returns the current number of items in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    //*************************************************************************
+    void clear()
+    {
+      while (!empty())
+      {
+        pop();
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    ibucket_priority_queue(T* p_values_, size_t* p_next_, size_t capacity_)
+      : p_values(p_values_),
+        p_next(p_next_),
+        capacity(capacity_),
+        current_size(0U),
+        free_head(NONE),
+        lowest_word(WORDS)
+    {
+      for (size_t i = 0U; i < N_PRIORITIES; ++i)
+      {
+        head[i] = NONE;
+        tail[i] = NONE;
+      }
+
+      for (size_t i = 0U; i < WORDS; ++i)
+      {
+        bitmap[i] = 0U;
+      }
+
+      for (size_t i = capacity; i > 0U; --i)
+      {
+        release(i - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Make this a clone of the supplied queue.
+    /// Values of equal priority keep their order.
+    //*************************************************************************
+    void clone(const ibucket_priority_queue& other)
+    {
+      clear();
+
+      for (size_t priority = 0U; priority < N_PRIORITIES; ++priority)
+      {
+        for (size_t slot = other.head[priority]; slot != NONE; slot = other.p_next[slot])
+        {
+          push(priority, other.p_values[slot]);
+        }
+      }
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibucket_priority_queue(const ibucket_priority_queue&);
+
+    //*************************************************************************
+    size_t allocate()
+    {
+      const size_t slot = free_head;
+      free_head = p_next[slot];
+
+      return slot;
+    }
+
+    //*************************************************************************
+    void release(size_t slot)
+    {
+      p_next[slot] = free_head;
+      free_head    = slot;
+    }
+
+    //*************************************************************************
+    /// Adds the slot to the back of the bucket.
+    //*************************************************************************
+    void append(size_t priority, size_t slot)
+    {
+      p_next[slot] = NONE;
+
+      if (head[priority] == NONE)
+      {
+        head[priority] = slot;
+        bitmap[priority / 32U] |= (uint32_t(1U) << (priority % 32U));
+
+        if ((priority / 32U) < lowest_word)
+        {
+          lowest_word = priority / 32U;
+        }
+      }
+      else
+      {
+        p_next[tail[priority]] = slot;
+      }
+
+      tail[priority] = slot;
+      ++current_size;
+    }
+
+    T*             p_values;             ///< The value slots.
+    size_t*        p_next;               ///< The next slot in a bucket, or in the free list.
+    size_t         capacity;
+    size_t         current_size;
+    size_t         free_head;            ///< The first free slot.
+    mutable size_t lowest_word;          ///< No bitmap word below this has a bit set.
+    size_t         head[N_PRIORITIES];   ///< The first slot of each bucket.
+    size_t         tail[N_PRIORITIES];   ///< The last slot of each bucket.
+    uint32_t       bitmap[WORDS];        ///< A bit for each non-empty bucket.
+  };
+
+  //***************************************************************************
+  ///\ingroup bucket_priority_queue
+  /// A fixed capacity bucket priority queue.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam N_PRIORITIES The number of priorities, 0 (highest) to N_PRIORITIES - 1.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, const size_t N_PRIORITIES>
+  class bucket_priority_queue : public etl::ibucket_priority_queue<T, N_PRIORITIES>
+  {
+  public:
+
+    typedef etl::ibucket_priority_queue<T, N_PRIORITIES> base_t;
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    bucket_priority_queue()
+      : base_t(reinterpret_cast<T*>(&buffer), next, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    bucket_priority_queue(const bucket_priority_queue& rhs)
+      : base_t(reinterpret_cast<T*>(&buffer), next, SIZE)
+    {
+      base_t::clone(rhs);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~bucket_priority_queue()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    bucket_priority_queue& operator = (const bucket_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(T) * SIZE, etl::alignment_of<T>::value>::type buffer;
+    size_t next[SIZE];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "platform.h"
 #include "nullptr.h"
 #include "function.h"
+#include "delegate.h"
 #include "static_assert.h"
 #include "timer.h"
 #include "atomic.h"
@@ -121,6 +122,27 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*******************************************
+    /// ETL delegate callback
+    //*******************************************
+    callback_timer_data(etl::timer::id::type             id_,
+                        const etl::delegate<void()>&     callback_,
+                        uint32_t                         period_,
+                        bool                             repeating_)
+      : p_callback(nullptr),
+        delegate_callback(callback_),
+        period(period_),
+        delta(etl::timer::state::INACTIVE),
+        id(id_),
+        previous(etl::timer::id::NO_TIMER),
+        next(etl::timer::id::NO_TIMER),
+        repeating(repeating_),
+        has_c_callback(false)
+    {
+    }
+#endif
+
     //*******************************************
     /// Returns true if the timer is active.
     //*******************************************
@@ -138,6 +160,9 @@ namespace etl
     }
 
     void*                 p_callback;
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    etl::delegate<void()> delegate_callback;
+#endif
     uint32_t              period;
     uint32_t              delta;
     etl::timer::id::type  id;
@@ -362,6 +387,7 @@ namespace etl
           if (timer.id == etl::timer::id::NO_TIMER)
           {
             // Create in-place.
+            timer.~callback_timer_data();
             new (&timer) callback_timer_data(i, p_callback_, period_, repeating_);
             ++registered_timers;
             id = i;
@@ -394,6 +420,7 @@ namespace etl
           if (timer.id == etl::timer::id::NO_TIMER)
           {
             // Create in-place.
+            timer.~callback_timer_data();
             new (&timer) callback_timer_data(i, callback_, period_, repeating_);
             ++registered_timers;
             id = i;
@@ -405,6 +432,41 @@ namespace etl
       return id;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*******************************************
+    /// Register a timer with a delegate callback.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::delegate<void()>& callback_,
+                                        uint32_t                     period_,
+                                        bool                         repeating_)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      bool is_space = (registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // Search for the free space.
+        for (uint_least8_t i = 0; i < MAX_TIMERS; ++i)
+        {
+          etl::callback_timer_data& timer = timer_array[i];
+
+          if (timer.id == etl::timer::id::NO_TIMER)
+          {
+            // Create in-place.
+            timer.~callback_timer_data();
+            new (&timer) callback_timer_data(i, callback_, period_, repeating_);
+            ++registered_timers;
+            id = i;
+            break;
+          }
+        }
+      }
+
+      return id;
+    }
+#endif
+
     //*******************************************
     /// Unregister a timer.
     //*******************************************
@@ -426,6 +488,7 @@ namespace etl
           }
 
           // Reset in-place.
+          timer.~callback_timer_data();
           new (&timer) callback_timer_data();
           --registered_timers;
 
@@ -463,6 +526,7 @@ namespace etl
 
       for (int i = 0; i < MAX_TIMERS; ++i)
       {
+        timer_array[i].~callback_timer_data();
         new (&timer_array[i]) callback_timer_data();
       }
 
@@ -514,6 +578,13 @@ namespace etl
                   (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
                 }
               }
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+              else if (timer.delegate_callback.is_valid())
+              {
+                // Call the delegate callback.
+                timer.delegate_callback();
+              }
+#endif
 
               has_active = !active_list.empty();
             }
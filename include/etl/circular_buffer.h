@@ -0,0 +1,1378 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CIRCULAR_BUFFER_INCLUDED
+#define ETL_CIRCULAR_BUFFER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <iterator>
+#include <algorithm>
+#include <new>
+
+#include "platform.h"
+#include "container.h"
+#include "alignment.h"
+#include "array_view.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  #include <initializer_list>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+//*****************************************************************************
+///\defgroup circular_buffer circular_buffer
+/// A fixed capacity ring buffer with random access.
+/// The contents occupy at most two contiguous runs of the internal buffer,
+/// which are available as array_one() and array_two(), so that they may be
+/// passed directly to functions that take a pointer and a length.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for circular buffers
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_exception : public etl::exception
+  {
+  public:
+
+    circular_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Circular buffer full exception.
+  /// Raised when pushing to a full buffer that is not in overwrite mode.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_full : public etl::circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_full(string_type file_name_, numeric_type line_number_)
+      : circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Circular buffer empty exception.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_empty : public etl::circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_empty(string_type file_name_, numeric_type line_number_)
+      : circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Circular buffer out of bounds exception.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_out_of_bounds : public etl::circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:bounds", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all templated circular buffer types.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  class circular_buffer_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the current size of the buffer.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the buffer.
+    ///\return <b>true</b> if empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the buffer.
+    ///\return <b>true</b> if full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the buffer.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the buffer.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Sets the overwrite mode.
+    /// If set, a push to a full buffer overwrites the value at the other end.
+    /// If not, it is an error. The default is to overwrite.
+    //*************************************************************************
+    void set_overwrite(bool overwrite_)
+    {
+      overwrite = overwrite_;
+    }
+
+    //*************************************************************************
+    /// Gets the overwrite mode.
+    //*************************************************************************
+    bool get_overwrite() const
+    {
+      return overwrite;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the contents are in one contiguous run.
+    //*************************************************************************
+    bool is_linearized() const
+    {
+      return (CAPACITY - out) >= current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    circular_buffer_base(size_type max_size_)
+      : out(0),
+        current_size(0),
+        CAPACITY(max_size_),
+        overwrite(true)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~circular_buffer_base()
+    {
+    }
+
+    //*************************************************************************
+    /// Converts a position from the front to an index in the buffer.
+    /// A compare and subtract, rather than a division.
+    //*************************************************************************
+    size_type physical(size_type index) const
+    {
+      index += out;
+
+      return (index >= CAPACITY) ? index - CAPACITY : index;
+    }
+
+    //*************************************************************************
+    /// The index of the slot after the back.
+    //*************************************************************************
+    size_type in() const
+    {
+      return physical(current_size);
+    }
+
+    size_type       out;          ///< The index of the front.
+    size_type       current_size; ///< The current number of elements.
+    const size_type CAPACITY;     ///< The maximum number of elements.
+    bool            overwrite;    ///< Overwrite when full.
+    ETL_DECLARE_DEBUG_COUNT;      ///< Internal debugging.
+  };
+
+  //***************************************************************************
+  /// The base class for all etl::circular_buffer classes.
+  ///\tparam T The type of values this buffer should hold.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  template <typename T>
+  class icircular_buffer : public etl::circular_buffer_base
+  {
+  public:
+
+    typedef T        value_type;
+    typedef size_t   size_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef typename std::iterator_traits<pointer>::difference_type difference_type;
+
+    typedef etl::array_view<T>       array_range;
+    typedef etl::const_array_view<T> const_array_range;
+
+  protected:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+    //*************************************************************************
+    /// Test for an iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_iterator : public etl::integral_constant<bool, !etl::is_integral<TIterator>::value && !etl::is_floating_point<TIterator>::value>
+    {
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// Iterator.
+    /// Holds the position from the front, so that the iterators compare and
+    /// subtract as plain numbers.
+    //*************************************************************************
+    class iterator : public std::iterator<std::random_access_iterator_tag, T>
+    {
+    public:
+
+      friend class icircular_buffer;
+      friend class const_iterator;
+
+      //***************************************************
+      iterator()
+        : p_buffer(nullptr),
+          index(0)
+      {
+      }
+
+      //***************************************************
+      iterator(const iterator& other)
+        : p_buffer(other.p_buffer),
+          index(other.index)
+      {
+      }
+
+      //***************************************************
+      iterator& operator =(const iterator& other)
+      {
+        p_buffer = other.p_buffer;
+        index    = other.index;
+        return *this;
+      }
+
+      //***************************************************
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      //***************************************************
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      //***************************************************
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      //***************************************************
+      iterator& operator +=(difference_type offset)
+      {
+        index += offset;
+        return *this;
+      }
+
+      //***************************************************
+      iterator& operator -=(difference_type offset)
+      {
+        index -= offset;
+        return *this;
+      }
+
+      //***************************************************
+      reference operator *() const
+      {
+        return (*p_buffer)[index];
+      }
+
+      //***************************************************
+      pointer operator ->() const
+      {
+        return &(*p_buffer)[index];
+      }
+
+      //***************************************************
+      reference operator [](difference_type offset) const
+      {
+        return (*p_buffer)[index + offset];
+      }
+
+      //***************************************************
+      friend iterator operator +(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator +(difference_type offset, const iterator& rhs)
+      {
+        iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend iterator operator -(const iterator& lhs, difference_type offset)
+      {
+        iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index - rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //***************************************************
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      iterator(icircular_buffer* p_buffer_, difference_type index_)
+        : p_buffer(p_buffer_),
+          index(index_)
+      {
+      }
+
+      icircular_buffer* p_buffer;
+      difference_type   index;
+    };
+
+    //*************************************************************************
+    /// Const Iterator.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::random_access_iterator_tag, const T>
+    {
+    public:
+
+      friend class icircular_buffer;
+
+      //***************************************************
+      const_iterator()
+        : p_buffer(nullptr),
+          index(0)
+      {
+      }
+
+      //***************************************************
+      const_iterator(const const_iterator& other)
+        : p_buffer(other.p_buffer),
+          index(other.index)
+      {
+      }
+
+      //***************************************************
+      const_iterator(const typename icircular_buffer::iterator& other)
+        : p_buffer(other.p_buffer),
+          index(other.index)
+      {
+      }
+
+      //***************************************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_buffer = other.p_buffer;
+        index    = other.index;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      //***************************************************
+      const_iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      //***************************************************
+      const_iterator& operator +=(difference_type offset)
+      {
+        index += offset;
+        return *this;
+      }
+
+      //***************************************************
+      const_iterator& operator -=(difference_type offset)
+      {
+        index -= offset;
+        return *this;
+      }
+
+      //***************************************************
+      const_reference operator *() const
+      {
+        return (*p_buffer)[index];
+      }
+
+      //***************************************************
+      const_pointer operator ->() const
+      {
+        return &(*p_buffer)[index];
+      }
+
+      //***************************************************
+      const_reference operator [](difference_type offset) const
+      {
+        return (*p_buffer)[index + offset];
+      }
+
+      //***************************************************
+      friend const_iterator operator +(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator +(difference_type offset, const const_iterator& rhs)
+      {
+        const_iterator result(rhs);
+        result += offset;
+        return result;
+      }
+
+      //***************************************************
+      friend const_iterator operator -(const const_iterator& lhs, difference_type offset)
+      {
+        const_iterator result(lhs);
+        result -= offset;
+        return result;
+      }
+
+      //***************************************************
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index - rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //***************************************************
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      //***************************************************
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //***************************************************
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //***************************************************
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      //***************************************************
+      const_iterator(const icircular_buffer* p_buffer_, difference_type index_)
+        : p_buffer(p_buffer_),
+          index(index_)
+      {
+      }
+
+      const icircular_buffer* p_buffer;
+      difference_type         index;
+    };
+
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets an iterator to the front.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(this, 0);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the front.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, 0);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the front.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, 0);
+    }
+
+    //*************************************************************************
+    /// Gets an iterator to the end.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a const iterator to the end.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the back.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the back.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the back.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets a reverse iterator to the end.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets a const reverse iterator to the end.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the value at the index from the front.
+    //*************************************************************************
+    reference operator [](size_t index)
+    {
+      return p_buffer[physical(index)];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value at the index from the front.
+    //*************************************************************************
+    const_reference operator [](size_t index) const
+    {
+      return p_buffer[physical(index)];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the value at the index from the front.
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_out_of_bounds
+    /// if the index is out of range.
+    //*************************************************************************
+    reference at(size_t index)
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(circular_buffer_out_of_bounds));
+
+      return p_buffer[physical(index)];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value at the index from the front.
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_out_of_bounds
+    /// if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t index) const
+    {
+      ETL_ASSERT(index < current_size, ETL_ERROR(circular_buffer_out_of_bounds));
+
+      return p_buffer[physical(index)];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the oldest value.
+    //*************************************************************************
+    reference front()
+    {
+      return p_buffer[out];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the oldest value.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return p_buffer[out];
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the newest value.
+    //*************************************************************************
+    reference back()
+    {
+      return p_buffer[physical(current_size - 1)];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the newest value.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return p_buffer[physical(current_size - 1)];
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of values, starting at the front.
+    //*************************************************************************
+    array_range array_one()
+    {
+      return array_range(p_buffer + out, size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of values, starting at the front.
+    //*************************************************************************
+    const_array_range array_one() const
+    {
+      return const_array_range(p_buffer + out, size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of values, ending at the back.
+    /// Empty if the contents do not wrap.
+    //*************************************************************************
+    array_range array_two()
+    {
+      return array_range(p_buffer, current_size - size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of values, ending at the back.
+    /// Empty if the contents do not wrap.
+    //*************************************************************************
+    const_array_range array_two() const
+    {
+      return const_array_range(p_buffer, current_size - size_one());
+    }
+
+    //*************************************************************************
+    /// Moves the values so that they are in one contiguous run.
+    /// Iterators remain valid, but references and array ranges do not.
+    ///\return A pointer to the front value.
+    //*************************************************************************
+    pointer linearize()
+    {
+      if (!is_linearized())
+      {
+        const size_type length_one = size_one();
+        const size_type length_two = current_size - length_one;
+
+        if (full())
+        {
+          std::rotate(p_buffer, p_buffer + out, p_buffer + CAPACITY);
+        }
+        else
+        {
+          // Move the first run down, into the gap after the second.
+          for (size_type i = 0; i < length_one; ++i)
+          {
+            relocate(out + i, length_two + i);
+          }
+
+          std::rotate(p_buffer, p_buffer + length_two, p_buffer + current_size);
+        }
+
+        out = 0;
+      }
+
+      return p_buffer + out;
+    }
+
+    //*************************************************************************
+    /// Adds a value to the back.
+    /// If the buffer is full and in overwrite mode, the front value is replaced.
+    /// If not in overwrite mode, emits an etl::circular_buffer_full.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      if (make_room_back())
+      {
+        ::new (&p_buffer[in()]) T(value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the back by moving it.
+    //*************************************************************************
+    void push_back(T&& value)
+    {
+      if (make_room_back())
+      {
+        ::new (&p_buffer[in()]) T(std::move(value));
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value at the back.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+      if (make_room_back())
+      {
+        ::new (&p_buffer[in()]) T(std::forward<Args>(args)...);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Adds a value to the front.
+    /// If the buffer is full and in overwrite mode, the back value is replaced.
+    /// If not in overwrite mode, emits an etl::circular_buffer_full.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      if (make_room_front())
+      {
+        ::new (&p_buffer[out]) T(value);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the front by moving it.
+    //*************************************************************************
+    void push_front(T&& value)
+    {
+      if (make_room_front())
+      {
+        ::new (&p_buffer[out]) T(std::move(value));
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value at the front.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args&& ... args)
+    {
+      if (make_room_front())
+      {
+        ::new (&p_buffer[out]) T(std::forward<Args>(args)...);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the oldest value.
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_empty if empty.
+    //*************************************************************************
+    void pop_front()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+#endif
+      destroy_front();
+    }
+
+    //*************************************************************************
+    /// Removes the 'n' oldest values, such as after writing out array_one().
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_empty
+    /// if there are fewer than 'n'.
+    //*************************************************************************
+    void pop_front(size_t n)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(n <= current_size, ETL_ERROR(circular_buffer_empty));
+#endif
+      while (n-- > 0)
+      {
+        destroy_front();
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the newest value.
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_empty if empty.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+#endif
+      destroy_back();
+    }
+
+    //*************************************************************************
+    /// Removes the 'n' newest values.
+    /// If asserts or exceptions are enabled, emits an etl::circular_buffer_empty
+    /// if there are fewer than 'n'.
+    //*************************************************************************
+    void pop_back(size_t n)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(n <= current_size, ETL_ERROR(circular_buffer_empty));
+#endif
+      while (n-- > 0)
+      {
+        destroy_back();
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values.
+    /// In overwrite mode, only the last capacity() values are kept.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<is_iterator<TIterator>::value, void>::type
+      assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first++);
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value.
+    //*************************************************************************
+    void assign(size_t n, parameter_t value)
+    {
+      clear();
+
+      while (n-- > 0)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the buffer.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        current_size = 0;
+        ETL_RESET_DEBUG_COUNT;
+      }
+      else
+      {
+        while (current_size > 0)
+        {
+          destroy_front();
+        }
+      }
+
+      out = 0;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    icircular_buffer& operator =(const icircular_buffer& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    icircular_buffer& operator =(icircular_buffer&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icircular_buffer(pointer p_buffer_, size_t max_size_)
+      : circular_buffer_base(max_size_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Moves the values of another buffer in to this one.
+    /// The values live in each buffer's own storage, so they are moved one by one.
+    //*************************************************************************
+    void move_container(icircular_buffer&& other)
+    {
+      clear();
+
+      for (size_t i = 0; i < other.size(); ++i)
+      {
+        push_back(std::move(other[i]));
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// The length of the run from the front to the end of the buffer.
+    //*************************************************************************
+    size_type size_one() const
+    {
+      return (CAPACITY - out) < current_size ? CAPACITY - out : current_size;
+    }
+
+    //*************************************************************************
+    /// Makes room for a value at the back.
+    /// Returns <b>false</b> if there is none.
+    //*************************************************************************
+    bool make_room_back()
+    {
+      if (full())
+      {
+        ETL_ASSERT(overwrite, ETL_ERROR(circular_buffer_full));
+
+        if (!overwrite || (CAPACITY == 0))
+        {
+          return false;
+        }
+
+        destroy_front();
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Makes room for a value at the front and moves the front to it.
+    /// Returns <b>false</b> if there is none.
+    //*************************************************************************
+    bool make_room_front()
+    {
+      if (full())
+      {
+        ETL_ASSERT(overwrite, ETL_ERROR(circular_buffer_full));
+
+        if (!overwrite || (CAPACITY == 0))
+        {
+          return false;
+        }
+
+        destroy_back();
+      }
+
+      out = (out == 0) ? CAPACITY - 1 : out - 1;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Destroys the front value.
+    //*************************************************************************
+    void destroy_front()
+    {
+      p_buffer[out].~T();
+      out = (out == (CAPACITY - 1)) ? 0 : out + 1;
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Destroys the back value.
+    //*************************************************************************
+    void destroy_back()
+    {
+      p_buffer[physical(current_size - 1)].~T();
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Moves the value at one buffer index to an unused one.
+    //*************************************************************************
+    void relocate(size_type from, size_type to)
+    {
+      ::new (&p_buffer[to]) T(ETL_MOVE(p_buffer[from]));
+      p_buffer[from].~T();
+    }
+
+    // Disable copy construction.
+    icircular_buffer(const icircular_buffer&);
+
+    pointer p_buffer; ///< The internal buffer.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_CIRCULAR_BUFFER) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~icircular_buffer()
+    {
+    }
+#else
+  protected:
+    ~icircular_buffer()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A fixed capacity circular buffer.
+  ///\tparam T        The type of values this buffer should hold.
+  ///\tparam MAX_SIZE_ The maximum number of values that can be stored.
+  ///\ingroup circular_buffer
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class circular_buffer : public etl::icircular_buffer<T>
+  {
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    circular_buffer()
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    circular_buffer(const circular_buffer& other)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->set_overwrite(other.get_overwrite());
+      this->assign(other.begin(), other.end());
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor.
+    /// The values are moved and 'other' is left empty.
+    //*************************************************************************
+    circular_buffer(circular_buffer&& other)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->set_overwrite(other.get_overwrite());
+      this->move_container(std::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructs from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    circular_buffer(TIterator first, TIterator last)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Constructs from an initializer_list.
+    //*************************************************************************
+    circular_buffer(std::initializer_list<T> init)
+      : etl::icircular_buffer<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~circular_buffer()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    circular_buffer& operator =(const circular_buffer& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    circular_buffer& operator =(circular_buffer&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The uninitialised buffer of T used in the circular_buffer.
+    typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
+  };
+}
+
+//***************************************************************************
+/// Equal operator.
+///\param lhs  Reference to the first circular buffer.
+///\param rhs  Reference to the second circular buffer.
+///\return <b>true</b> if the buffers are equal, otherwise <b>false</b>
+///\ingroup circular_buffer
+//***************************************************************************
+template <typename T>
+bool operator ==(const etl::icircular_buffer<T>& lhs, const etl::icircular_buffer<T>& rhs)
+{
+  return (lhs.size() == rhs.size()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+//***************************************************************************
+/// Not equal operator.
+///\param lhs  Reference to the first circular buffer.
+///\param rhs  Reference to the second circular buffer.
+///\return <b>true</b> if the buffers are not equal, otherwise <b>false</b>
+///\ingroup circular_buffer
+//***************************************************************************
+template <typename T>
+bool operator !=(const etl::icircular_buffer<T>& lhs, const etl::icircular_buffer<T>& rhs)
+{
+  return !(lhs == rhs);
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,1878 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPRESSED_BITMAP_INCLUDED
+#define ETL_COMPRESSED_BITMAP_INCLUDED
+
+#include <algorithm>
+#include <iterator>
+#include <string.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "bitset.h"
+#include "vector.h"
+#include "pool.h"
+#include "nullptr.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#undef ETL_FILE
+#define ETL_FILE "51"
+
+//*****************************************************************************
+///\defgroup compressed_bitmap compressed_bitmap
+/// A fixed capacity compressed bitmap of 32 bit values.
+/// The value space is split into chunks of 65536 values, each of which is stored
+/// as a sorted array, a list of runs or a dense etl::bitset, whichever suits
+/// the contents of the chunk.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for compressed_bitmap
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class compressed_bitmap_exception : public etl::exception
+  {
+  public:
+
+    compressed_bitmap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Compressed bitmap full exception.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class compressed_bitmap_full : public etl::compressed_bitmap_exception
+  {
+  public:
+
+    compressed_bitmap_full(string_type file_name_, numeric_type line_number_)
+      : compressed_bitmap_exception(ETL_ERROR_TEXT("compressed_bitmap:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for etl::compressed_bitmap
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  class icompressed_bitmap
+  {
+  public:
+
+    typedef uint32_t value_type;
+    typedef size_t   size_type;
+
+    /// The number of values in each chunk.
+    static const uint32_t CHUNK_SIZE = 65536;
+
+  protected:
+
+    /// The dense representation of a chunk.
+    typedef etl::bitset<CHUNK_SIZE> dense_t;
+
+    //*************************************************************************
+    /// The way in which a chunk is stored.
+    //*************************************************************************
+    struct container_type
+    {
+      enum enum_type
+      {
+        ARRAY,  ///< A sorted array of values.
+        RUN,    ///< A sorted array of first/last pairs.
+        BITMAP  ///< A dense bitset.
+      };
+    };
+
+    //*************************************************************************
+    /// The header for a chunk of 65536 values.
+    //*************************************************************************
+    struct chunk_t
+    {
+      uint16_t* block() const
+      {
+        return static_cast<uint16_t*>(p_data);
+      }
+
+      dense_t& dense() const
+      {
+        return *static_cast<dense_t*>(p_data);
+      }
+
+      uint16_t key;   ///< The upper 16 bits of the values in the chunk.
+      uint8_t  type;  ///< The container_type.
+      uint16_t size;  ///< The number of values in an array or runs in a run list.
+      uint32_t count; ///< The number of values in the chunk.
+      void*    p_data;
+    };
+
+    typedef etl::ivector<chunk_t> chunk_list_t;
+
+  public:
+
+    //*************************************************************************
+    /// Iterates the values in ascending order.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::forward_iterator_tag, const uint32_t>
+    {
+    public:
+
+      friend class icompressed_bitmap;
+
+      const_iterator()
+        : p_chunks(nullptr),
+          chunk_index(0),
+          index(0),
+          low(0)
+      {
+      }
+
+      uint32_t operator *() const
+      {
+        return (uint32_t((*p_chunks)[chunk_index].key) << 16) | low;
+      }
+
+      const_iterator& operator ++()
+      {
+        const chunk_t& chunk = (*p_chunks)[chunk_index];
+
+        switch (chunk.type)
+        {
+          case container_type::ARRAY:
+          {
+            if (++index < chunk.size)
+            {
+              low = chunk.block()[index];
+            }
+            else
+            {
+              next_chunk();
+            }
+            break;
+          }
+
+          case container_type::RUN:
+          {
+            if (low < chunk.block()[(2 * index) + 1])
+            {
+              ++low;
+            }
+            else if (++index < chunk.size)
+            {
+              low = chunk.block()[2 * index];
+            }
+            else
+            {
+              next_chunk();
+            }
+            break;
+          }
+
+          default:
+          {
+            size_t next = chunk.dense().find_next(true, low + 1);
+
+            if (next == dense_t::npos)
+            {
+              next_chunk();
+            }
+            else
+            {
+              low = uint32_t(next);
+            }
+            break;
+          }
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_chunks == rhs.p_chunks) && (lhs.chunk_index == rhs.chunk_index) && (lhs.low == rhs.low);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const chunk_list_t& chunks, size_t chunk_index_)
+        : p_chunks(&chunks),
+          chunk_index(chunk_index_),
+          index(0),
+          low(0)
+      {
+        first_in_chunk();
+      }
+
+      void next_chunk()
+      {
+        ++chunk_index;
+        index = 0;
+        low   = 0;
+        first_in_chunk();
+      }
+
+      void first_in_chunk()
+      {
+        if (chunk_index < p_chunks->size())
+        {
+          const chunk_t& chunk = (*p_chunks)[chunk_index];
+
+          if (chunk.type == container_type::BITMAP)
+          {
+            low = uint32_t(chunk.dense().find_first(true));
+          }
+          else
+          {
+            low = chunk.block()[0];
+          }
+        }
+      }
+
+      const chunk_list_t* p_chunks;
+      size_t              chunk_index;
+      size_t              index;
+      uint32_t            low;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the values.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(chunks, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the values.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(chunks, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the values.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(chunks, chunks.size());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the values.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(chunks, chunks.size());
+    }
+
+    //*************************************************************************
+    /// The number of values in the bitmap.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0;
+
+      for (size_t i = 0; i < chunks.size(); ++i)
+      {
+        n += chunks[i].count;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no values in the bitmap.
+    //*************************************************************************
+    bool empty() const
+    {
+      return chunks.empty();
+    }
+
+    //*************************************************************************
+    /// The number of chunks in use.
+    //*************************************************************************
+    size_t chunk_count() const
+    {
+      return chunks.size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of chunks.
+    //*************************************************************************
+    size_t max_chunks() const
+    {
+      return chunks.max_size();
+    }
+
+    //*************************************************************************
+    /// Tests for a value.
+    //*************************************************************************
+    bool test(uint32_t value) const
+    {
+      size_t index = find_chunk(uint16_t(value >> 16));
+
+      if (index == chunks.size())
+      {
+        return false;
+      }
+
+      return contains(chunks[index], value & 0xFFFF);
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    icompressed_bitmap& set(uint32_t value)
+    {
+      const uint16_t key = uint16_t(value >> 16);
+      const uint16_t low = uint16_t(value);
+
+      size_t index = lower_bound(key);
+
+      // A new chunk?
+      if ((index == chunks.size()) || (chunks[index].key != key))
+      {
+        ETL_ASSERT(!chunks.full(), ETL_ERROR(compressed_bitmap_full));
+
+        chunk_t chunk;
+        chunk.key    = key;
+        chunk.type   = container_type::ARRAY;
+        chunk.size   = 1;
+        chunk.count  = 1;
+        chunk.p_data = allocate_block();
+        chunk.block()[0] = low;
+
+        chunks.insert(chunks.begin() + index, chunk);
+
+        return *this;
+      }
+
+      chunk_t& chunk = chunks[index];
+
+      switch (chunk.type)
+      {
+        case container_type::ARRAY:
+        {
+          uint16_t* const p_first = chunk.block();
+          uint16_t* const p_last  = p_first + chunk.size;
+          uint16_t* const p_value = std::lower_bound(p_first, p_last, low);
+
+          if ((p_value != p_last) && (*p_value == low))
+          {
+            return *this;
+          }
+
+          if (chunk.size < array_size)
+          {
+            memmove(p_value + 1, p_value, (p_last - p_value) * sizeof(uint16_t));
+            *p_value = low;
+            ++chunk.size;
+            ++chunk.count;
+
+            return *this;
+          }
+          break;
+        }
+
+        case container_type::RUN:
+        {
+          uint16_t* const runs = chunk.block();
+          const size_t    i    = upper_run(chunk, low);
+
+          if ((i != 0) && (low <= runs[(2 * i) - 1]))
+          {
+            return *this;
+          }
+
+          const bool join_previous = (i != 0) && (low == (runs[(2 * i) - 1] + 1U));
+          const bool join_next     = (i != chunk.size) && ((low + 1U) == runs[2 * i]);
+
+          if (join_previous && join_next)
+          {
+            // Merge the two runs.
+            runs[(2 * i) - 1] = runs[(2 * i) + 1];
+            memmove(runs + (2 * i), runs + (2 * i) + 2, (chunk.size - i - 1) * 2 * sizeof(uint16_t));
+            --chunk.size;
+          }
+          else if (join_previous)
+          {
+            runs[(2 * i) - 1] = low;
+          }
+          else if (join_next)
+          {
+            runs[2 * i] = low;
+          }
+          else if (chunk.size < max_runs)
+          {
+            memmove(runs + (2 * i) + 2, runs + (2 * i), (chunk.size - i) * 2 * sizeof(uint16_t));
+            runs[2 * i]       = low;
+            runs[(2 * i) + 1] = low;
+            ++chunk.size;
+          }
+          else
+          {
+            break;
+          }
+
+          ++chunk.count;
+
+          return *this;
+        }
+
+        default:
+        {
+          dense_t& dense = chunk.dense();
+
+          if (!dense.test(low))
+          {
+            dense.set(low);
+            ++chunk.count;
+          }
+
+          return *this;
+        }
+      }
+
+      // The chunk must be rebuilt.
+      modify(index, low, operation::OR);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Removes a value.
+    //*************************************************************************
+    icompressed_bitmap& reset(uint32_t value)
+    {
+      const uint16_t key = uint16_t(value >> 16);
+      const uint16_t low = uint16_t(value);
+
+      size_t index = find_chunk(key);
+
+      if (index == chunks.size())
+      {
+        return *this;
+      }
+
+      chunk_t& chunk = chunks[index];
+
+      if (!contains(chunk, low))
+      {
+        return *this;
+      }
+
+      if (chunk.count == 1)
+      {
+        release_chunk(chunk);
+        chunks.erase(chunks.begin() + index);
+
+        return *this;
+      }
+
+      switch (chunk.type)
+      {
+        case container_type::ARRAY:
+        {
+          uint16_t* const p_first = chunk.block();
+          uint16_t* const p_last  = p_first + chunk.size;
+          uint16_t* const p_value = std::lower_bound(p_first, p_last, low);
+
+          memmove(p_value, p_value + 1, (p_last - p_value - 1) * sizeof(uint16_t));
+          --chunk.size;
+          --chunk.count;
+          break;
+        }
+
+        case container_type::RUN:
+        {
+          uint16_t* const runs = chunk.block();
+          const size_t    i    = upper_run(chunk, low) - 1;
+
+          uint16_t& first = runs[2 * i];
+          uint16_t& last  = runs[(2 * i) + 1];
+
+          if (first == last)
+          {
+            memmove(runs + (2 * i), runs + (2 * i) + 2, (chunk.size - i - 1) * 2 * sizeof(uint16_t));
+            --chunk.size;
+          }
+          else if (low == first)
+          {
+            ++first;
+          }
+          else if (low == last)
+          {
+            --last;
+          }
+          else if (chunk.size < max_runs)
+          {
+            // Split the run.
+            memmove(runs + (2 * i) + 2, runs + (2 * i), (chunk.size - i) * 2 * sizeof(uint16_t));
+            runs[(2 * i) + 1] = uint16_t(low - 1);
+            runs[(2 * i) + 2] = uint16_t(low + 1);
+            ++chunk.size;
+          }
+          else
+          {
+            modify(index, low, operation::AND_NOT);
+            break;
+          }
+
+          --chunk.count;
+          break;
+        }
+
+        default:
+        {
+          chunk.dense().reset(low);
+          --chunk.count;
+
+          // Switch to a smaller representation?
+          if (chunk.count <= array_size)
+          {
+            chunk_t result;
+
+            if (rebuild(chunk, result))
+            {
+              release_chunk(chunk);
+              chunk = result;
+            }
+          }
+          break;
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Removes all values.
+    //*************************************************************************
+    icompressed_bitmap& reset()
+    {
+      for (size_t i = 0; i < chunks.size(); ++i)
+      {
+        release_chunk(chunks[i]);
+      }
+
+      chunks.clear();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with a copy of another compressed bitmap.
+    //*************************************************************************
+    void assign(const icompressed_bitmap& other)
+    {
+      if (&other != this)
+      {
+        reset();
+
+        ETL_ASSERT(other.chunks.size() <= chunks.max_size(), ETL_ERROR(compressed_bitmap_full));
+
+        for (size_t i = 0; i < other.chunks.size(); ++i)
+        {
+          chunks.push_back(copy_chunk(other.chunks[i]));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Keeps the values that are also in the other bitmap.
+    //*************************************************************************
+    icompressed_bitmap& operator &=(const icompressed_bitmap& other)
+    {
+      apply(other, operation::AND);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Adds the values in the other bitmap.
+    //*************************************************************************
+    icompressed_bitmap& operator |=(const icompressed_bitmap& other)
+    {
+      apply(other, operation::OR);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Keeps the values that are in one bitmap but not both.
+    //*************************************************************************
+    icompressed_bitmap& operator ^=(const icompressed_bitmap& other)
+    {
+      apply(other, operation::XOR);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Removes the values that are in the other bitmap.
+    //*************************************************************************
+    icompressed_bitmap& and_not(const icompressed_bitmap& other)
+    {
+      apply(other, operation::AND_NOT);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The number of bytes required by serialize.
+    //*************************************************************************
+    size_t serialized_size() const
+    {
+      size_t length = HEADER_SIZE;
+
+      for (size_t i = 0; i < chunks.size(); ++i)
+      {
+        length += CHUNK_HEADER_SIZE + payload_size(chunks[i]);
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Writes the bitmap to a buffer in a portable, little endian format.
+    ///\param buffer The buffer to write to.
+    ///\param length The length of the buffer.
+    ///\return The number of bytes written, or zero if the buffer is too small.
+    //*************************************************************************
+    size_t serialize(uint8_t* buffer, size_t length) const
+    {
+      const size_t required = serialized_size();
+
+      if (length < required)
+      {
+        return 0;
+      }
+
+      uint8_t* p = buffer;
+
+      p = write(p, uint32_t(chunks.size()));
+
+      for (size_t i = 0; i < chunks.size(); ++i)
+      {
+        const chunk_t& chunk = chunks[i];
+
+        p = write(p, chunk.key);
+        *p++ = chunk.type;
+        p = write(p, chunk.count);
+        p = write(p, chunk.size);
+
+        switch (chunk.type)
+        {
+          case container_type::ARRAY:
+          {
+            for (size_t j = 0; j < chunk.size; ++j)
+            {
+              p = write(p, chunk.block()[j]);
+            }
+            break;
+          }
+
+          case container_type::RUN:
+          {
+            for (size_t j = 0; j < (2U * chunk.size); ++j)
+            {
+              p = write(p, chunk.block()[j]);
+            }
+            break;
+          }
+
+          default:
+          {
+            memset(p, 0, DENSE_SIZE);
+
+            const dense_t& dense = chunk.dense();
+            size_t position = dense.find_first(true);
+
+            while (position != dense_t::npos)
+            {
+              p[position >> 3] |= uint8_t(1U << (position & 7));
+              position = dense.find_next(true, position + 1);
+            }
+
+            p += DENSE_SIZE;
+            break;
+          }
+        }
+      }
+
+      return required;
+    }
+
+    //*************************************************************************
+    /// Reads a bitmap written by serialize.
+    /// The chunks are rebuilt to suit the capacity of this bitmap.
+    ///\param buffer The buffer to read from.
+    ///\param length The length of the buffer.
+    ///\return <b>true</b> if the buffer was valid, otherwise the bitmap is left empty.
+    //*************************************************************************
+    bool deserialize(const uint8_t* buffer, size_t length)
+    {
+      reset();
+
+      const uint8_t* p     = buffer;
+      const uint8_t* p_end = buffer + length;
+
+      if (length < HEADER_SIZE)
+      {
+        return false;
+      }
+
+      uint32_t n_chunks;
+      p = read(p, n_chunks);
+
+      int32_t previous_key = -1;
+
+      for (uint32_t i = 0; i < n_chunks; ++i)
+      {
+        if (size_t(p_end - p) < CHUNK_HEADER_SIZE)
+        {
+          reset();
+          return false;
+        }
+
+        chunk_t chunk;
+        p = read(p, chunk.key);
+        chunk.type = *p++;
+        p = read(p, chunk.count);
+        p = read(p, chunk.size);
+
+        if ((int32_t(chunk.key) <= previous_key) ||
+            (chunk.type > container_type::BITMAP) ||
+            (size_t(p_end - p) < payload_size(chunk)))
+        {
+          reset();
+          return false;
+        }
+
+        previous_key = chunk.key;
+
+        if (!read_chunk(p, chunk))
+        {
+          reset();
+          return false;
+        }
+
+        p += payload_size(chunk);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    friend bool operator ==(const icompressed_bitmap& lhs, const icompressed_bitmap& rhs)
+    {
+      return (lhs.count() == rhs.count()) && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    friend bool operator !=(const icompressed_bitmap& lhs, const icompressed_bitmap& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icompressed_bitmap(chunk_list_t& chunks_, etl::ipool& blocks_, etl::ipool& bitmaps_, size_t array_size_, size_t max_bitmaps_)
+      : chunks(chunks_),
+        blocks(blocks_),
+        bitmaps(bitmaps_),
+        array_size(array_size_),
+        max_runs(array_size_ / 2),
+        max_bitmaps(max_bitmaps_)
+    {
+    }
+
+  private:
+
+    static const size_t HEADER_SIZE       = 4;    // Chunk count.
+    static const size_t CHUNK_HEADER_SIZE = 9;    // Key, type, count, size.
+    static const size_t DENSE_SIZE        = CHUNK_SIZE / 8;
+
+    //*************************************************************************
+    /// The set operations.
+    //*************************************************************************
+    struct operation
+    {
+      enum enum_type
+      {
+        AND,
+        OR,
+        XOR,
+        AND_NOT
+      };
+
+      static bool apply(int op, bool a, bool b)
+      {
+        switch (op)
+        {
+          case AND: return a && b;
+          case OR:  return a || b;
+          case XOR: return a != b;
+          default:  return a && !b;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// Reads a chunk as a sequence of ascending, inclusive ranges.
+    //*************************************************************************
+    class range_cursor
+    {
+    public:
+
+      range_cursor(const chunk_t& chunk_)
+        : chunk(chunk_),
+          index(0),
+          position(0)
+      {
+      }
+
+      bool next(uint32_t& first, uint32_t& last)
+      {
+        switch (chunk.type)
+        {
+          case container_type::ARRAY:
+          {
+            if (index == chunk.size)
+            {
+              return false;
+            }
+
+            const uint16_t* const values = chunk.block();
+
+            first = last = values[index++];
+
+            // Join consecutive values.
+            while ((index < chunk.size) && (values[index] == (last + 1)))
+            {
+              last = values[index++];
+            }
+
+            return true;
+          }
+
+          case container_type::RUN:
+          {
+            if (index == chunk.size)
+            {
+              return false;
+            }
+
+            first = chunk.block()[2 * index];
+            last  = chunk.block()[(2 * index) + 1];
+            ++index;
+
+            return true;
+          }
+
+          default:
+          {
+            if (position >= CHUNK_SIZE)
+            {
+              return false;
+            }
+
+            const dense_t& dense = chunk.dense();
+
+            size_t start = dense.find_next(true, position);
+
+            if (start == dense_t::npos)
+            {
+              position = CHUNK_SIZE;
+              return false;
+            }
+
+            size_t stop = dense.find_next(false, start);
+
+            first    = uint32_t(start);
+            last     = (stop == dense_t::npos) ? (CHUNK_SIZE - 1) : uint32_t(stop - 1);
+            position = last + 1;
+
+            return true;
+          }
+        }
+      }
+
+    private:
+
+      const chunk_t& chunk;
+      size_t         index;
+      uint32_t       position;
+    };
+
+    //*************************************************************************
+    /// Builds a chunk from a sequence of ascending, non-overlapping ranges.
+    /// Starts as a run list, then becomes an array if there are too many runs,
+    /// then a bitmap if there are too many values.
+    //*************************************************************************
+    class chunk_builder
+    {
+    public:
+
+      chunk_builder(icompressed_bitmap& owner_, uint16_t key)
+        : owner(owner_),
+          last_value(0)
+      {
+        chunk.key    = key;
+        chunk.type   = container_type::RUN;
+        chunk.size   = 0;
+        chunk.count  = 0;
+        chunk.p_data = nullptr;
+      }
+
+      //***********************************
+      /// Adds a range that lies above all previous ranges.
+      //***********************************
+      void add(uint32_t first, uint32_t last)
+      {
+        const bool     join = (chunk.count != 0) && (first == (last_value + 1));
+        const uint32_t n    = last - first + 1;
+
+        if (chunk.p_data == nullptr)
+        {
+          chunk.p_data = owner.allocate_block();
+        }
+
+        if ((chunk.type == container_type::RUN) && !join && (chunk.size == owner.max_runs))
+        {
+          if ((chunk.count + n) <= owner.array_size)
+          {
+            to_array();
+          }
+          else
+          {
+            to_bitmap();
+          }
+        }
+
+        if ((chunk.type == container_type::ARRAY) && ((chunk.count + n) > owner.array_size))
+        {
+          to_bitmap();
+        }
+
+        switch (chunk.type)
+        {
+          case container_type::RUN:
+          {
+            uint16_t* const runs = chunk.block();
+
+            if (join)
+            {
+              runs[(2 * chunk.size) - 1] = uint16_t(last);
+            }
+            else
+            {
+              runs[2 * chunk.size]       = uint16_t(first);
+              runs[(2 * chunk.size) + 1] = uint16_t(last);
+              ++chunk.size;
+            }
+            break;
+          }
+
+          case container_type::ARRAY:
+          {
+            uint16_t* const values = chunk.block();
+
+            for (uint32_t value = first; value <= last; ++value)
+            {
+              values[chunk.size++] = uint16_t(value);
+            }
+            break;
+          }
+
+          default:
+          {
+            dense_t& dense = chunk.dense();
+
+            for (uint32_t value = first; value <= last; ++value)
+            {
+              dense.set(value);
+            }
+            break;
+          }
+        }
+
+        chunk.count += n;
+        last_value   = last;
+      }
+
+      //***********************************
+      /// The last value added.
+      //***********************************
+      uint32_t back() const
+      {
+        return last_value;
+      }
+
+      //***********************************
+      /// Completes the chunk.
+      /// Returns <b>false</b> if the chunk is empty.
+      //***********************************
+      bool finish(chunk_t& result)
+      {
+        if (chunk.count == 0)
+        {
+          return false;
+        }
+
+        // An array is smaller than the runs?
+        if ((chunk.type == container_type::RUN) && (chunk.count <= owner.array_size) && (chunk.count <= (2U * chunk.size)))
+        {
+          to_array();
+        }
+
+        result = chunk;
+
+        return true;
+      }
+
+    private:
+
+      //***********************************
+      void to_array()
+      {
+        uint16_t* const runs   = chunk.block();
+        uint16_t* const values = owner.allocate_block();
+
+        size_t n = 0;
+
+        for (size_t i = 0; i < chunk.size; ++i)
+        {
+          for (uint32_t value = runs[2 * i]; value <= runs[(2 * i) + 1]; ++value)
+          {
+            values[n++] = uint16_t(value);
+          }
+        }
+
+        owner.blocks.release(runs);
+
+        chunk.type   = container_type::ARRAY;
+        chunk.size   = uint16_t(n);
+        chunk.p_data = values;
+      }
+
+      //***********************************
+      void to_bitmap()
+      {
+        uint16_t* const block = chunk.block();
+        dense_t&        dense = owner.allocate_dense();
+
+        if (chunk.type == container_type::RUN)
+        {
+          for (size_t i = 0; i < chunk.size; ++i)
+          {
+            for (uint32_t value = block[2 * i]; value <= block[(2 * i) + 1]; ++value)
+            {
+              dense.set(value);
+            }
+          }
+        }
+        else
+        {
+          for (size_t i = 0; i < chunk.size; ++i)
+          {
+            dense.set(block[i]);
+          }
+        }
+
+        owner.blocks.release(block);
+
+        chunk.type   = container_type::BITMAP;
+        chunk.size   = 0;
+        chunk.p_data = &dense;
+      }
+
+      icompressed_bitmap& owner;
+      chunk_t             chunk;
+      uint32_t            last_value;
+    };
+
+    friend class chunk_builder;
+
+    //*************************************************************************
+    /// Finds the index of the first chunk with a key not less than the key.
+    //*************************************************************************
+    size_t lower_bound(uint16_t key) const
+    {
+      size_t n = chunks.size();
+
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      // Branchless, as the chunk searched for is rarely predictable.
+      const chunk_t* const p_first = &chunks[0];
+      const chunk_t*       p_base  = p_first;
+
+      while (n > 1)
+      {
+        const size_t half = n / 2;
+        p_base = (p_base[half].key < key) ? p_base + half : p_base;
+        n -= half;
+      }
+
+      return size_t(p_base - p_first) + ((p_base->key < key) ? 1 : 0);
+    }
+
+    //*************************************************************************
+    /// Finds the index of the chunk with the key, or the number of chunks if not found.
+    //*************************************************************************
+    size_t find_chunk(uint16_t key) const
+    {
+      size_t index = lower_bound(key);
+
+      if ((index != chunks.size()) && (chunks[index].key != key))
+      {
+        index = chunks.size();
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Finds the index of the first run that starts after the value.
+    //*************************************************************************
+    static size_t upper_run(const chunk_t& chunk, uint32_t low)
+    {
+      const uint16_t* const runs = chunk.block();
+
+      size_t first = 0;
+      size_t count = chunk.size;
+
+      while (count > 0)
+      {
+        size_t step = count / 2;
+
+        if (runs[2 * (first + step)] <= low)
+        {
+          first += step + 1;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Tests for a value in a chunk.
+    //*************************************************************************
+    static bool contains(const chunk_t& chunk, uint32_t low)
+    {
+      switch (chunk.type)
+      {
+        case container_type::ARRAY:
+        {
+          const uint16_t* p_base = chunk.block();
+          size_t          n      = chunk.size;
+
+          while (n > 1)
+          {
+            const size_t half = n / 2;
+            p_base = (p_base[half] <= low) ? p_base + half : p_base;
+            n -= half;
+          }
+
+          return *p_base == low;
+        }
+
+        case container_type::RUN:
+        {
+          const size_t i = upper_run(chunk, low);
+
+          return (i != 0) && (low <= chunk.block()[(2 * i) - 1]);
+        }
+
+        default:
+        {
+          return chunk.dense().test(low);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Combines a chunk with a single value and replaces it with the result.
+    //*************************************************************************
+    void modify(size_t index, uint16_t low, int op)
+    {
+      uint16_t value = low;
+
+      chunk_t single;
+      single.key    = chunks[index].key;
+      single.type   = container_type::ARRAY;
+      single.size   = 1;
+      single.count  = 1;
+      single.p_data = &value;
+
+      replace(index, single, op);
+    }
+
+    //*************************************************************************
+    /// Combines the chunk at the index with another and replaces it with the result.
+    /// Removes the chunk if the result is empty.
+    //*************************************************************************
+    void replace(size_t index, const chunk_t& other, int op)
+    {
+      chunk_t result;
+
+      const bool not_empty = combine(chunks[index], other, op, result);
+
+      release_chunk(chunks[index]);
+
+      if (not_empty)
+      {
+        chunks[index] = result;
+      }
+      else
+      {
+        chunks.erase(chunks.begin() + index);
+      }
+
+      ETL_ASSERT(bitmaps.size() <= max_bitmaps, ETL_ERROR(compressed_bitmap_full));
+    }
+
+    //*************************************************************************
+    /// Applies a set operation with another bitmap.
+    //*************************************************************************
+    void apply(const icompressed_bitmap& other, int op)
+    {
+      if (&other == this)
+      {
+        if ((op == operation::XOR) || (op == operation::AND_NOT))
+        {
+          reset();
+        }
+
+        return;
+      }
+
+      size_t i = 0;
+      size_t j = 0;
+
+      while ((i < chunks.size()) || (j < other.chunks.size()))
+      {
+        if ((j == other.chunks.size()) || ((i < chunks.size()) && (chunks[i].key < other.chunks[j].key)))
+        {
+          // Only in this bitmap.
+          if (op == operation::AND)
+          {
+            release_chunk(chunks[i]);
+            chunks.erase(chunks.begin() + i);
+          }
+          else
+          {
+            ++i;
+          }
+        }
+        else if ((i == chunks.size()) || (other.chunks[j].key < chunks[i].key))
+        {
+          // Only in the other bitmap.
+          if ((op == operation::OR) || (op == operation::XOR))
+          {
+            ETL_ASSERT(!chunks.full(), ETL_ERROR(compressed_bitmap_full));
+
+            chunks.insert(chunks.begin() + i, copy_chunk(other.chunks[j]));
+            ++i;
+          }
+
+          ++j;
+        }
+        else
+        {
+          // In both.
+          size_t size = chunks.size();
+
+          replace(i, other.chunks[j], op);
+
+          if (chunks.size() == size)
+          {
+            ++i;
+          }
+
+          ++j;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Combines two chunks with the same key.
+    /// Returns <b>false</b> if the result is empty.
+    //*************************************************************************
+    bool combine(const chunk_t& a, const chunk_t& b, int op, chunk_t& result)
+    {
+      const bool a_dense = (a.type == container_type::BITMAP);
+      const bool b_dense = (b.type == container_type::BITMAP);
+
+      if (a_dense && b_dense)
+      {
+        // Whole element operations.
+        dense_t& dense = allocate_dense(a.dense());
+
+        switch (op)
+        {
+          case operation::AND: dense &= b.dense(); break;
+          case operation::OR:  dense |= b.dense(); break;
+          case operation::XOR: dense ^= b.dense(); break;
+          default:
+          {
+            // a & ~b == ~(~a | b)
+            dense.flip();
+            dense |= b.dense();
+            dense.flip();
+            break;
+          }
+        }
+
+        result.key    = a.key;
+        result.type   = container_type::BITMAP;
+        result.size   = 0;
+        result.count  = uint32_t(dense.count());
+        result.p_data = &dense;
+
+        return normalise(result);
+      }
+
+      if ((a_dense || b_dense) && (op == operation::AND))
+      {
+        // Keep the values of the sparse chunk that are in the dense one.
+        return filter(a_dense ? b : a, a_dense ? a.dense() : b.dense(), true, result);
+      }
+
+      if (b_dense && (op == operation::AND_NOT))
+      {
+        // Keep the values of the sparse chunk that are not in the dense one.
+        return filter(a, b.dense(), false, result);
+      }
+
+      if (a_dense || b_dense)
+      {
+        // Apply the ranges of the sparse chunk to a copy of the dense one.
+        const chunk_t& sparse = a_dense ? b : a;
+        dense_t&       dense  = allocate_dense(a_dense ? a.dense() : b.dense());
+
+        range_cursor cursor(sparse);
+        uint32_t first;
+        uint32_t last;
+
+        while (cursor.next(first, last))
+        {
+          for (uint32_t value = first; value <= last; ++value)
+          {
+            switch (op)
+            {
+              case operation::OR:  dense.set(value);   break;
+              case operation::XOR: dense.flip(value);  break;
+              default:             dense.reset(value); break;
+            }
+          }
+        }
+
+        result.key    = a.key;
+        result.type   = container_type::BITMAP;
+        result.size   = 0;
+        result.count  = uint32_t(dense.count());
+        result.p_data = &dense;
+
+        return normalise(result);
+      }
+
+      // Merge the ranges of both chunks.
+      chunk_builder builder(*this, a.key);
+
+      range_cursor cursor_a(a);
+      range_cursor cursor_b(b);
+
+      uint32_t a_first = 0;
+      uint32_t a_last  = 0;
+      uint32_t b_first = 0;
+      uint32_t b_last  = 0;
+
+      bool a_valid = cursor_a.next(a_first, a_last);
+      bool b_valid = cursor_b.next(b_first, b_last);
+
+      uint32_t position = 0;
+
+      while (a_valid || b_valid)
+      {
+        const bool in_a = a_valid && (position >= a_first);
+        const bool in_b = b_valid && (position >= b_first);
+
+        const uint32_t a_next = !a_valid ? CHUNK_SIZE : (in_a ? a_last + 1 : a_first);
+        const uint32_t b_next = !b_valid ? CHUNK_SIZE : (in_b ? b_last + 1 : b_first);
+        const uint32_t next   = std::min(a_next, b_next);
+
+        if (operation::apply(op, in_a, in_b))
+        {
+          builder.add(position, next - 1);
+        }
+
+        position = next;
+
+        if (a_valid && (position > a_last))
+        {
+          a_valid = cursor_a.next(a_first, a_last);
+        }
+
+        if (b_valid && (position > b_last))
+        {
+          b_valid = cursor_b.next(b_first, b_last);
+        }
+      }
+
+      return builder.finish(result);
+    }
+
+    //*************************************************************************
+    /// Builds a chunk from the values of a sparse chunk that are, or are not, in a dense one.
+    //*************************************************************************
+    bool filter(const chunk_t& sparse, const dense_t& dense, bool state, chunk_t& result)
+    {
+      chunk_builder builder(*this, sparse.key);
+
+      range_cursor cursor(sparse);
+      uint32_t first;
+      uint32_t last;
+
+      while (cursor.next(first, last))
+      {
+        for (uint32_t value = first; value <= last; ++value)
+        {
+          if (dense.test(value) == state)
+          {
+            builder.add(value, value);
+          }
+        }
+      }
+
+      return builder.finish(result);
+    }
+
+    //*************************************************************************
+    /// Converts a bitmap chunk to a smaller representation if possible.
+    /// Returns <b>false</b> if the chunk is empty.
+    //*************************************************************************
+    bool normalise(chunk_t& chunk)
+    {
+      if (chunk.count > array_size)
+      {
+        return true;
+      }
+
+      chunk_t result;
+      const bool not_empty = rebuild(chunk, result);
+
+      release_chunk(chunk);
+      chunk = result;
+
+      return not_empty;
+    }
+
+    //*************************************************************************
+    /// Rebuilds a chunk in the best representation.
+    //*************************************************************************
+    bool rebuild(const chunk_t& chunk, chunk_t& result)
+    {
+      chunk_builder builder(*this, chunk.key);
+
+      range_cursor cursor(chunk);
+      uint32_t first;
+      uint32_t last;
+
+      while (cursor.next(first, last))
+      {
+        builder.add(first, last);
+      }
+
+      return builder.finish(result);
+    }
+
+    //*************************************************************************
+    /// Reads the payload of a serialized chunk.
+    //*************************************************************************
+    bool read_chunk(const uint8_t* p, const chunk_t& header)
+    {
+      chunk_builder builder(*this, header.key);
+
+      bool valid = true;
+
+      switch (header.type)
+      {
+        case container_type::ARRAY:
+        {
+          for (size_t i = 0; valid && (i < header.size); ++i)
+          {
+            uint16_t value;
+            p = read(p, value);
+
+            valid = (i == 0) || (value > builder.back());
+
+            if (valid)
+            {
+              builder.add(value, value);
+            }
+          }
+          break;
+        }
+
+        case container_type::RUN:
+        {
+          for (size_t i = 0; valid && (i < header.size); ++i)
+          {
+            uint16_t first;
+            uint16_t last;
+            p = read(p, first);
+            p = read(p, last);
+
+            valid = (first <= last) && ((i == 0) || (first > builder.back()));
+
+            if (valid)
+            {
+              builder.add(first, last);
+            }
+          }
+          break;
+        }
+
+        default:
+        {
+          uint32_t first = 0;
+          bool     in_range = false;
+
+          for (uint32_t value = 0; value < CHUNK_SIZE; ++value)
+          {
+            const bool bit = (p[value >> 3] & (1U << (value & 7))) != 0;
+
+            if (bit && !in_range)
+            {
+              first = value;
+            }
+            else if (!bit && in_range)
+            {
+              builder.add(first, value - 1);
+            }
+
+            in_range = bit;
+          }
+
+          if (in_range)
+          {
+            builder.add(first, CHUNK_SIZE - 1);
+          }
+          break;
+        }
+      }
+
+      chunk_t chunk;
+
+      if (!builder.finish(chunk))
+      {
+        return false;
+      }
+
+      if (!valid || (chunk.count != header.count) || chunks.full())
+      {
+        release_chunk(chunk);
+        return false;
+      }
+
+      chunks.push_back(chunk);
+
+      return bitmaps.size() <= max_bitmaps;
+    }
+
+    //*************************************************************************
+    /// The number of bytes of serialized data after a chunk header.
+    //*************************************************************************
+    static size_t payload_size(const chunk_t& chunk)
+    {
+      switch (chunk.type)
+      {
+        case container_type::ARRAY: return chunk.size * 2U;
+        case container_type::RUN:   return chunk.size * 4U;
+        default:                    return DENSE_SIZE;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies a chunk from another bitmap.
+    //*************************************************************************
+    chunk_t copy_chunk(const chunk_t& other)
+    {
+      chunk_t chunk = other;
+
+      if (other.type == container_type::BITMAP)
+      {
+        ETL_ASSERT(bitmaps.size() < max_bitmaps, ETL_ERROR(compressed_bitmap_full));
+        chunk.p_data = &allocate_dense(other.dense());
+      }
+      else
+      {
+        const size_t n = (other.type == container_type::ARRAY) ? other.size : (2U * other.size);
+
+        ETL_ASSERT(n <= array_size, ETL_ERROR(compressed_bitmap_full));
+
+        chunk.p_data = allocate_block();
+        memcpy(chunk.p_data, other.p_data, n * sizeof(uint16_t));
+      }
+
+      return chunk;
+    }
+
+    //*************************************************************************
+    /// Allocates an array block.
+    //*************************************************************************
+    uint16_t* allocate_block()
+    {
+      ETL_ASSERT(!blocks.full(), ETL_ERROR(compressed_bitmap_full));
+
+      return blocks.allocate<uint16_t>();
+    }
+
+    //*************************************************************************
+    /// Allocates a clear bitset.
+    //*************************************************************************
+    dense_t& allocate_dense()
+    {
+      ETL_ASSERT(!bitmaps.full(), ETL_ERROR(compressed_bitmap_full));
+
+      return *bitmaps.create<dense_t>();
+    }
+
+    //*************************************************************************
+    /// Allocates a copy of a bitset.
+    //*************************************************************************
+    dense_t& allocate_dense(const dense_t& other)
+    {
+      ETL_ASSERT(!bitmaps.full(), ETL_ERROR(compressed_bitmap_full));
+
+      return *bitmaps.create<dense_t>(other);
+    }
+
+    //*************************************************************************
+    /// Releases the storage used by a chunk.
+    //*************************************************************************
+    void release_chunk(const chunk_t& chunk)
+    {
+      if (chunk.type == container_type::BITMAP)
+      {
+        bitmaps.destroy<dense_t>(chunk.p_data);
+      }
+      else
+      {
+        blocks.release(chunk.p_data);
+      }
+    }
+
+    //*************************************************************************
+    /// Little endian writes.
+    //*************************************************************************
+    static uint8_t* write(uint8_t* p, uint16_t value)
+    {
+      *p++ = uint8_t(value);
+      *p++ = uint8_t(value >> 8);
+
+      return p;
+    }
+
+    static uint8_t* write(uint8_t* p, uint32_t value)
+    {
+      p = write(p, uint16_t(value));
+      return write(p, uint16_t(value >> 16));
+    }
+
+    //*************************************************************************
+    /// Little endian reads.
+    //*************************************************************************
+    static const uint8_t* read(const uint8_t* p, uint16_t& value)
+    {
+      value = uint16_t(p[0] | (p[1] << 8));
+
+      return p + 2;
+    }
+
+    static const uint8_t* read(const uint8_t* p, uint32_t& value)
+    {
+      uint16_t low;
+      uint16_t high;
+
+      p = read(p, low);
+      p = read(p, high);
+
+      value = low | (uint32_t(high) << 16);
+
+      return p;
+    }
+
+    // Disable copy construction.
+    icompressed_bitmap(const icompressed_bitmap&);
+
+    chunk_list_t& chunks;
+    etl::ipool&   blocks;
+    etl::ipool&   bitmaps;
+    const size_t  array_size;
+    const size_t  max_runs;
+    const size_t  max_bitmaps;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_COMPRESSED_BITMAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~icompressed_bitmap()
+    {
+    }
+#else
+  protected:
+    ~icompressed_bitmap()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A compressed bitmap with a fixed capacity.
+  ///\tparam MAX_CHUNKS_  The maximum number of 65536 value chunks.
+  ///\tparam MAX_BITMAPS_ The maximum number of chunks that may be stored as a dense bitset.
+  ///\tparam ARRAY_SIZE_  The maximum number of values in an array chunk. Also
+  ///                     allows up to ARRAY_SIZE_ / 2 runs in a run chunk.
+  ///\ingroup compressed_bitmap
+  //***************************************************************************
+  template <const size_t MAX_CHUNKS_, const size_t MAX_BITMAPS_, const size_t ARRAY_SIZE_>
+  class compressed_bitmap : public etl::icompressed_bitmap
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_CHUNKS_ <= 65536, "No more than 65536 chunks");
+    ETL_STATIC_ASSERT((ARRAY_SIZE_ >= 2) && (ARRAY_SIZE_ <= 65535), "Array size must be 2 to 65535");
+
+    static const size_t MAX_CHUNKS  = MAX_CHUNKS_;
+    static const size_t MAX_BITMAPS = MAX_BITMAPS_;
+    static const size_t ARRAY_SIZE  = ARRAY_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    compressed_bitmap()
+      : etl::icompressed_bitmap(chunk_list, blocks, bitmaps, ARRAY_SIZE, MAX_BITMAPS)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    compressed_bitmap(const compressed_bitmap& other)
+      : etl::icompressed_bitmap(chunk_list, blocks, bitmaps, ARRAY_SIZE, MAX_BITMAPS)
+    {
+      assign(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~compressed_bitmap()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compressed_bitmap& operator =(const compressed_bitmap& other)
+    {
+      assign(other);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compressed_bitmap& operator =(const icompressed_bitmap& other)
+    {
+      assign(other);
+      return *this;
+    }
+
+  private:
+
+    struct block_t
+    {
+      uint16_t values[ARRAY_SIZE];
+    };
+
+    // The chunk headers, sorted by key.
+    etl::vector<chunk_t, MAX_CHUNKS> chunk_list;
+
+    // Array and run storage. Two extra blocks are used while building chunks.
+    etl::pool<block_t, MAX_CHUNKS + 2> blocks;
+
+    // Dense storage. One extra bitset is used while combining chunks.
+    etl::pool<dense_t, MAX_BITMAPS + 1> bitmaps;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -0,0 +1,479 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DELEGATE_INCLUDED
+#define ETL_DELEGATE_INCLUDED
+
+#include <stddef.h>
+#include <string.h>
+#include <new>
+#include <utility>
+
+#include "platform.h"
+#include "alignment.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#undef ETL_FILE
+#define ETL_FILE "54"
+
+//*****************************************************************************
+///\defgroup delegate delegate
+/// A fixed size, non-allocating callable wrapper.
+/// Free functions and member functions that are known at compile time are
+/// bound into the call stub, so that a call is a single indirect call with
+/// no virtual dispatch. Lambdas and other function objects are stored inline,
+/// up to ETL_DELEGATE_STORAGE_SIZE bytes.
+/// Requires C++11.
+///\ingroup utilities
+//*****************************************************************************
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+
+#if !defined(ETL_DELEGATE_STORAGE_SIZE)
+  /// Room for an object pointer and a member function pointer.
+  #define ETL_DELEGATE_STORAGE_SIZE (3 * sizeof(void*))
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for delegate exceptions.
+  ///\ingroup delegate
+  //***************************************************************************
+  class delegate_exception : public exception
+  {
+  public:
+
+    delegate_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an empty delegate is called.
+  ///\ingroup delegate
+  //***************************************************************************
+  class delegate_uninitialised : public delegate_exception
+  {
+  public:
+
+    delegate_uninitialised(string_type file_name_, numeric_type line_number_)
+      : delegate_exception(ETL_ERROR_TEXT("delegate:uninitialised", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Declaration.
+  //***************************************************************************
+  template <typename T>
+  class delegate;
+
+  //***************************************************************************
+  /// Delegate for a function signature.
+  ///\code
+  /// etl::delegate<void(int)> d1 = etl::delegate<void(int)>::create<&free_function>();
+  /// etl::delegate<void(int)> d2 = etl::delegate<void(int)>::create<Test, &Test::member>(test);
+  /// etl::delegate<void(int)> d3([&](int i) { total += i; });
+  ///\endcode
+  ///\ingroup delegate
+  //***************************************************************************
+  template <typename TReturn, typename... TParams>
+  class delegate<TReturn(TParams...)>
+  {
+  public:
+
+    static const size_t STORAGE_SIZE = ETL_DELEGATE_STORAGE_SIZE;
+
+    //*************************************************************************
+    /// Default constructor. The delegate is empty.
+    //*************************************************************************
+    delegate()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer to a free function, bound at run time.
+    //*************************************************************************
+    delegate(TReturn (*function)(TParams...))
+    {
+      initialise();
+
+      if (function != nullptr)
+      {
+        store(function);
+        stub = &function_pointer_stub;
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from a lambda or other function object, stored inline.
+    //*************************************************************************
+    template <typename TFunctor,
+              typename TDecayed = typename etl::decay<TFunctor>::type,
+              typename = typename etl::enable_if<!etl::is_same<TDecayed, delegate>::value &&
+                                                 !etl::is_pointer<TDecayed>::value, void>::type>
+    delegate(TFunctor&& functor)
+    {
+      ETL_STATIC_ASSERT(sizeof(TDecayed) <= STORAGE_SIZE, "Function object too large for the delegate storage");
+      ETL_STATIC_ASSERT(etl::alignment_of<TDecayed>::value <= etl::alignment_of<storage_t>::value, "Function object alignment too large for the delegate storage");
+
+      initialise();
+
+      ::new (static_cast<void*>(&storage)) TDecayed(std::forward<TFunctor>(functor));
+      stub = &functor_stub<TDecayed>;
+
+      if (!etl::is_trivially_copyable<TDecayed>::value || !etl::is_trivially_destructible<TDecayed>::value)
+      {
+        manager = &functor_manager<TDecayed>;
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    delegate(const delegate& other)
+    {
+      copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~delegate()
+    {
+      destroy();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    delegate& operator =(const delegate& rhs)
+    {
+      if (&rhs != this)
+      {
+        destroy();
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Creates a delegate for a free function bound at compile time.
+    //*************************************************************************
+    template <TReturn(*Function)(TParams...)>
+    static delegate create()
+    {
+      delegate d;
+      d.stub = &function_stub<Function>;
+      return d;
+    }
+
+    //*************************************************************************
+    /// Creates a delegate for a member function bound at compile time, called
+    /// on the supplied instance.
+    //*************************************************************************
+    template <typename T, TReturn(T::*Method)(TParams...)>
+    static delegate create(T& instance)
+    {
+      delegate d;
+      d.store(&instance);
+      d.stub = &method_stub<T, Method>;
+      return d;
+    }
+
+    //*************************************************************************
+    /// Creates a delegate for a const member function bound at compile time,
+    /// called on the supplied instance.
+    //*************************************************************************
+    template <typename T, TReturn(T::*Method)(TParams...) const>
+    static delegate create(const T& instance)
+    {
+      delegate d;
+      d.store(&instance);
+      d.stub = &const_method_stub<T, Method>;
+      return d;
+    }
+
+    //*************************************************************************
+    /// Creates a delegate for a member function and instance that are both
+    /// bound at compile time.
+    //*************************************************************************
+    template <typename T, T& Instance, TReturn(T::*Method)(TParams...)>
+    static delegate create()
+    {
+      delegate d;
+      d.stub = &instance_method_stub<T, Instance, Method>;
+      return d;
+    }
+
+    //*************************************************************************
+    /// Creates a delegate for a member function bound at run time.
+    //*************************************************************************
+    template <typename T>
+    static delegate create(T& instance, TReturn(T::*method)(TParams...))
+    {
+      delegate d;
+      d.store(runtime_method<T>(instance, method));
+      d.stub = &runtime_method_stub<T>;
+      return d;
+    }
+
+    //*************************************************************************
+    /// Calls the delegate.
+    /// If asserts or exceptions are enabled, emits an etl::delegate_uninitialised
+    /// if the delegate is empty.
+    //*************************************************************************
+    TReturn operator ()(TParams... args) const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(delegate_uninitialised));
+
+      return (*stub)(&storage, std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    /// Calls the delegate if it is not empty.
+    ///\return <b>true</b> if it was called.
+    //*************************************************************************
+    bool call_if(TParams... args) const
+    {
+      if (is_valid())
+      {
+        (*stub)(&storage, std::forward<TParams>(args)...);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the delegate is bound to something.
+    //*************************************************************************
+    bool is_valid() const
+    {
+      return stub != nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the delegate is bound to something.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// Empties the delegate.
+    //*************************************************************************
+    void clear()
+    {
+      destroy();
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Delegates are equal if they call the same function on the same object.
+    /// Function objects are compared by their bytes.
+    //*************************************************************************
+    friend bool operator ==(const delegate& lhs, const delegate& rhs)
+    {
+      return (lhs.stub == rhs.stub) && (memcmp(&lhs.storage, &rhs.storage, sizeof(storage_t)) == 0);
+    }
+
+    //*************************************************************************
+    friend bool operator !=(const delegate& lhs, const delegate& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<STORAGE_SIZE, etl::alignment_of<void*>::value>::type storage_t;
+
+    /// Calls the bound function with the storage.
+    typedef TReturn (*stub_t)(void* storage, TParams... args);
+
+    /// Copies a stored function object to 'destination', or destroys it if 'source' is null.
+    typedef void (*manager_t)(void* destination, const void* source);
+
+    //*************************************************************************
+    /// An object and a member function pointer.
+    //*************************************************************************
+    template <typename T>
+    struct runtime_method
+    {
+      runtime_method(T& object_, TReturn(T::*method_)(TParams...))
+        : object(&object_),
+          method(method_)
+      {
+      }
+
+      T* object;
+      TReturn(T::*method)(TParams...);
+    };
+
+    //*************************************************************************
+    /// Clears the storage so that equal bindings compare equal.
+    //*************************************************************************
+    void initialise()
+    {
+      memset(&storage, 0, sizeof(storage_t));
+      stub    = nullptr;
+      manager = nullptr;
+    }
+
+    //*************************************************************************
+    /// Stores a trivially copyable value.
+    //*************************************************************************
+    template <typename T>
+    void store(const T& value)
+    {
+      ETL_STATIC_ASSERT(sizeof(T) <= STORAGE_SIZE, "Value too large for the delegate storage");
+
+      ::new (static_cast<void*>(&storage)) T(value);
+    }
+
+    //*************************************************************************
+    /// Copies the binding from another delegate.
+    //*************************************************************************
+    void copy_from(const delegate& other)
+    {
+      stub    = other.stub;
+      manager = other.manager;
+
+      if (manager == nullptr)
+      {
+        memcpy(&storage, &other.storage, sizeof(storage_t));
+      }
+      else
+      {
+        memset(&storage, 0, sizeof(storage_t));
+        (*manager)(&storage, &other.storage);
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys a stored function object.
+    //*************************************************************************
+    void destroy()
+    {
+      if (manager != nullptr)
+      {
+        (*manager)(&storage, nullptr);
+      }
+    }
+
+    //*************************************************************************
+    template <TReturn(*Function)(TParams...)>
+    static TReturn function_stub(void*, TParams... args)
+    {
+      return Function(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    static TReturn function_pointer_stub(void* storage, TParams... args)
+    {
+      TReturn (*function)(TParams...) = *static_cast<TReturn (**)(TParams...)>(storage);
+
+      return function(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename T, TReturn(T::*Method)(TParams...)>
+    static TReturn method_stub(void* storage, TParams... args)
+    {
+      T* object = *static_cast<T**>(storage);
+
+      return (object->*Method)(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename T, TReturn(T::*Method)(TParams...) const>
+    static TReturn const_method_stub(void* storage, TParams... args)
+    {
+      const T* object = *static_cast<const T**>(storage);
+
+      return (object->*Method)(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename T, T& Instance, TReturn(T::*Method)(TParams...)>
+    static TReturn instance_method_stub(void*, TParams... args)
+    {
+      return (Instance.*Method)(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename T>
+    static TReturn runtime_method_stub(void* storage, TParams... args)
+    {
+      runtime_method<T>& binding = *static_cast<runtime_method<T>*>(storage);
+
+      return (binding.object->*binding.method)(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename TFunctor>
+    static TReturn functor_stub(void* storage, TParams... args)
+    {
+      return (*static_cast<TFunctor*>(storage))(std::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    template <typename TFunctor>
+    static void functor_manager(void* destination, const void* source)
+    {
+      if (source == nullptr)
+      {
+        static_cast<TFunctor*>(destination)->~TFunctor();
+      }
+      else
+      {
+        ::new (destination) TFunctor(*static_cast<const TFunctor*>(source));
+      }
+    }
+
+    mutable storage_t storage; ///< The bound object, function pointer or function object.
+    stub_t            stub;    ///< Calls the binding. Null if empty.
+    manager_t         manager; ///< Copies or destroys a function object. Null if bitwise copyable.
+  };
+}
+
+#endif
+
+#undef ETL_FILE
+
+#endif
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "alignment.h"
 #include "array.h"
 #include "memory.h"
+#include "array_view.h"
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
@@ -233,6 +234,9 @@ namespace etl
     typedef const T* const_pointer;
     typedef typename std::iterator_traits<pointer>::difference_type difference_type;
 
+    typedef etl::array_view<T>       array_range;
+    typedef etl::const_array_view<T> const_array_range;
+
   protected:
 
     typedef typename etl::parameter_type<T>::type parameter_t;
@@ -290,15 +294,8 @@ namespace etl
       //***************************************************
       iterator& operator +=(difference_type offset)
       {
-        if (offset > 0)
-        {
-          index += offset;
-          index = (static_cast<size_t>(index) > p_deque->BUFFER_SIZE - 1) ? index - p_deque->BUFFER_SIZE : index;
-        }
-        else if (offset < 0)
-        {
-          operator -= (-offset);
-        }
+        index += offset;
+        wrap();
 
         return *this;
       }
@@ -306,15 +303,8 @@ namespace etl
       //***************************************************
       iterator& operator -=(difference_type offset)
       {
-        if (offset > 0)
-        {
-          index -= offset;
-          index = (index < 0) ? index + p_deque->BUFFER_SIZE : index;
-        }
-        else if (offset < 0)
-        {
-          operator += (-offset);
-        }
+        index -= offset;
+        wrap();
 
         return *this;
       }
@@ -420,6 +410,18 @@ namespace etl
 
     private:
 
+      //***************************************************
+      /// Brings the index back into the buffer after a step of at most
+      /// one buffer length in either direction.
+      //***************************************************
+      void wrap()
+      {
+        const difference_type buffer_size = difference_type(p_deque->BUFFER_SIZE);
+
+        index = (index >= buffer_size) ? index - buffer_size : index;
+        index = (index < 0) ? index + buffer_size : index;
+      }
+
       //***************************************************
       iterator(difference_type index_, ideque& the_deque, pointer p_buffer_)
         : index(index_),
@@ -484,15 +486,8 @@ namespace etl
       //***************************************************
       const_iterator& operator +=(difference_type offset)
       {
-        if (offset > 0)
-        {
-          index += offset;
-          index = (static_cast<size_t>(index) > p_deque->BUFFER_SIZE - 1) ? index - p_deque->BUFFER_SIZE : index;
-        }
-        else if (offset < 0)
-        {
-          operator -= (-offset);
-        }
+        index += offset;
+        wrap();
 
         return *this;
       }
@@ -500,15 +495,8 @@ namespace etl
       //***************************************************
       const_iterator& operator -=(difference_type offset)
       {
-        if (offset > 0)
-        {
-          index -= offset;
-          index = (index < 0) ? static_cast<size_t>(index) + p_deque->BUFFER_SIZE : index;
-        }
-        else if (offset < 0)
-        {
-          operator += (-offset);
-        }
+        index -= offset;
+        wrap();
 
         return *this;
       }
@@ -602,6 +590,18 @@ namespace etl
 
     private:
 
+      //***************************************************
+      /// Brings the index back into the buffer after a step of at most
+      /// one buffer length in either direction.
+      //***************************************************
+      void wrap()
+      {
+        const difference_type buffer_size = difference_type(p_deque->BUFFER_SIZE);
+
+        index = (index >= buffer_size) ? index - buffer_size : index;
+        index = (index < 0) ? index + buffer_size : index;
+      }
+
       //***************************************************
       difference_type distance(difference_type firstIndex, difference_type index_)
       {
@@ -638,12 +638,12 @@ namespace etl
     typename etl::enable_if<is_iterator<TIterator>::value, void>::type
       assign(TIterator range_begin, TIterator range_end)
     {
-      initialise();
+      const size_t n = std::distance(range_begin, range_end);
 
-      while (range_begin != range_end)
-      {
-        push_back(*range_begin++);
-      }
+      ETL_ASSERT(n <= CAPACITY, ETL_ERROR(deque_full));
+
+      initialise();
+      create_element_back(n, range_begin);
     }
 
     //*************************************************************************
@@ -677,10 +677,7 @@ namespace etl
     {
       ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
 
-      iterator result(_begin);
-      result += index;
-
-      return *result;
+      return p_buffer[buffer_index(index)];
     }
 
     //*************************************************************************
@@ -692,10 +689,7 @@ namespace etl
     {
       ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
 
-      iterator result(_begin);
-      result += index;
-
-      return *result;
+      return p_buffer[buffer_index(index)];
     }
 
     //*************************************************************************
@@ -704,10 +698,7 @@ namespace etl
     //*************************************************************************
     reference operator [](size_t index)
     {
-      iterator result(_begin);
-      result += index;
-
-      return *result;
+      return p_buffer[buffer_index(index)];
     }
 
     //*************************************************************************
@@ -716,10 +707,7 @@ namespace etl
     //*************************************************************************
     const_reference operator [](size_t index) const
     {
-      iterator result(_begin);
-      result += index;
-
-      return *result;
+      return p_buffer[buffer_index(index)];
     }
 
     //*************************************************************************
@@ -854,6 +842,40 @@ namespace etl
       return const_reverse_iterator(cbegin());
     }
 
+    //*************************************************************************
+    /// Gets the first contiguous run of elements, starting at the front.
+    //*************************************************************************
+    array_range array_one()
+    {
+      return array_range(p_buffer + _begin.index, size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the first contiguous run of elements, starting at the front.
+    //*************************************************************************
+    const_array_range array_one() const
+    {
+      return const_array_range(p_buffer + _begin.index, size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of elements, ending at the back.
+    /// Empty if the contents do not wrap around the end of the buffer.
+    //*************************************************************************
+    array_range array_two()
+    {
+      return array_range(p_buffer, current_size - size_one());
+    }
+
+    //*************************************************************************
+    /// Gets the second contiguous run of elements, ending at the back.
+    /// Empty if the contents do not wrap around the end of the buffer.
+    //*************************************************************************
+    const_array_range array_two() const
+    {
+      return const_array_range(p_buffer, current_size - size_one());
+    }
+
     //*************************************************************************
     /// Clears the deque.
     //*************************************************************************
@@ -886,34 +908,53 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
+        // 'value' may refer to an element that is about to be shifted.
+        T copy(value);
+        position = shift_for_insert(position);
 
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
+        // Write the new value.
+        *position = ETL_MOVE(copy);
+      }
 
-          // Write the new value.
-          *--position = value;
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
+      return position;
+    }
 
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Inserts data into the deque by moving it.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    ///\param value>The value to insert.
+    //*************************************************************************
+    iterator insert(const_iterator insert_position, value_type&& value)
+    {
+      iterator position(insert_position.index, *this, p_buffer);
 
-          // Write the new value.
-          *position = value;
-        }
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+
+      if (insert_position == begin())
+      {
+        create_element_front(std::move(value));
+        position = _begin;
+      }
+      else if (insert_position == end())
+      {
+        create_element_back(std::move(value));
+        position = _end - 1;
+      }
+      else
+      {
+        position = shift_for_insert(position);
+
+        // Write the new value.
+        *position = std::move(value);
       }
 
       return position;
     }
+#endif
 
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     /// Emplaces data into the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
@@ -946,32 +987,11 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
-
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
-
-          // Write the new value.
-          --position;
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
+        position = shift_for_insert(position);
 
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
-
-          // Write the new value.
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
+        // Write the new value.
+        (*position).~T();
+        p = etl::addressof(*position);
       }
 
       ::new (p) T(value1);
@@ -1011,32 +1031,11 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
-
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
+        position = shift_for_insert(position);
 
-          // Write the new value.
-          --position;
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
-
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
-
-          // Write the new value.
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
+        // Write the new value.
+        (*position).~T();
+        p = etl::addressof(*position);
       }
 
       ::new (p) T(value1, value2);
@@ -1076,32 +1075,11 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
-
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
-
-          // Write the new value.
-          --position;
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
-
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
+        position = shift_for_insert(position);
 
-          // Write the new value.
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
+        // Write the new value.
+        (*position).~T();
+        p = etl::addressof(*position);
       }
 
       ::new (p) T(value1, value2, value3);
@@ -1141,38 +1119,63 @@ namespace etl
       }
       else
       {
-        // Are we closer to the front?
-        if (std::distance(_begin, position) < std::distance(position, _end - 1))
-        {
-          // Construct the _begin.
-          create_element_front(*_begin);
+        position = shift_for_insert(position);
 
-          // Move the values.
-          std::copy(_begin + 1, position, _begin);
+        // Write the new value.
+        (*position).~T();
+        p = etl::addressof(*position);
+      }
 
-          // Write the new value.
-          --position;
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
-        else
-        {
-          // Construct the _end.
-          create_element_back(*(_end - 1));
+      ::new (p) T(value1, value2, value3, value4);
 
-          // Move the values.
-          std::copy_backward(position, _end - 2, _end - 1);
+      return position;
+    }
+#else
+    //*************************************************************************
+    /// Emplaces data into the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is full.
+    ///\param insert_position>The insert position.
+    ///\param args The constructor arguments.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator insert_position, Args&& ... args)
+    {
+      iterator position(insert_position.index, *this, p_buffer);
 
-          // Write the new value.
-          (*position).~T();
-          p = etl::addressof(*position);
-        }
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+
+      void* p;
+
+      if (insert_position == begin())
+      {
+        --_begin;
+        p = etl::addressof(*_begin);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        position = _begin;
+      }
+      else if (insert_position == end())
+      {
+        p = etl::addressof(*_end);
+        ++_end;
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+        position = _end - 1;
       }
+      else
+      {
+        position = shift_for_insert(position);
 
-      ::new (p) T(value1, value2, value3, value4);
+        // Write the new value.
+        (*position).~T();
+        p = etl::addressof(*position);
+      }
+
+      ::new (p) T(std::forward<Args>(args)...);
 
       return position;
     }
+#endif
 
     //*************************************************************************
     /// Inserts 'n' copies of a value into the deque.
@@ -1187,6 +1190,11 @@ namespace etl
 
       ETL_ASSERT((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
 
+      if (n == 0)
+      {
+        return iterator(insert_position.index, *this, p_buffer);
+      }
+
       if (insert_position == begin())
       {
         for (size_t i = 0; i < n; ++i)
@@ -1210,6 +1218,9 @@ namespace etl
         // Non-const insert iterator.
         position = iterator(insert_position.index, *this, p_buffer);
 
+        // 'value' may refer to an element that is about to be moved.
+        const T copy(value);
+
         // Are we closer to the front?
         if (distance(_begin, insert_position) <= difference_type(current_size / 2))
         {
@@ -1227,23 +1238,23 @@ namespace etl
           // Create new.
           for (size_t i = 0; i < n_create_new; ++i)
           {
-            create_element_front(value);
+            create_element_front(copy);
           }
 
           // Create copy.
           for (size_t i = 0; i < n_create_copy; ++i)
           {
-            create_element_front(*from--);
+            create_element_front(ETL_MOVE(*from--));
           }
 
-          // Copy old.
+          // Move old.
           from = position - n_copy_old;
           to = _begin + n_create_copy;
-          etl::copy_n(from, n_copy_old, to);
+          move_range(from, from + n_copy_old, to);
 
           // Copy new.
           to = position - n_create_copy;
-          std::fill_n(to, n_copy_new, value);
+          std::fill_n(to, n_copy_new, copy);
 
           position = _begin + n_move;
         }
@@ -1259,22 +1270,22 @@ namespace etl
           // Create new.
           for (size_t i = 0; i < n_create_new; ++i)
           {
-            create_element_back(value);
+            create_element_back(copy);
           }
 
           // Create copy.
-          const_iterator from = position + n_copy_old;
+          iterator from = position + n_copy_old;
 
           for (size_t i = 0; i < n_create_copy; ++i)
           {
-            create_element_back(*from++);
+            create_element_back(ETL_MOVE(*from++));
           }
 
-          // Copy old.
-          std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
+          // Move old.
+          move_range_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
 
           // Copy new.
-          std::fill_n(position, n_copy_new, value);
+          std::fill_n(position, n_copy_new, copy);
         }
       }
 
@@ -1298,6 +1309,11 @@ namespace etl
 
       ETL_ASSERT((current_size + n) <= CAPACITY, ETL_ERROR(deque_full));
 
+      if (n == 0)
+      {
+        return iterator(insert_position.index, *this, p_buffer);
+      }
+
       if (insert_position == begin())
       {
         create_element_front(n, range_begin);
@@ -1306,10 +1322,7 @@ namespace etl
       }
       else if (insert_position == end())
       {
-        for (difference_type i = 0; i < n; ++i)
-        {
-          create_element_back(*range_begin++);
-        }
+        create_element_back(n, range_begin);
 
         position = _end - n;
       }
@@ -1338,15 +1351,15 @@ namespace etl
           // Create copy.
           create_element_front(n_create_copy, _begin + n_create_new);
 
-          // Copy old.
+          // Move old.
           from = position - n_copy_old;
           to = _begin + n_create_copy;
-          etl::copy_n(from, n_copy_old, to);
+          move_range(from, from + n_copy_old, to);
 
           // Copy new.
           to = position - n_create_copy;
           range_begin += n_create_new;
-          etl::copy_n(range_begin, n_copy_new, to);
+          copy_range(range_begin, n_copy_new, to);
 
           position = _begin + n_move;
         }
@@ -1360,26 +1373,21 @@ namespace etl
           size_t n_copy_old = n_move - n_create_copy;
 
           // Create new.
-          TIterator item = range_begin + (n - n_create_new);
-          for (size_t i = 0; i < n_create_new; ++i)
-          {
-            create_element_back(*item++);
-          }
+          create_element_back(n_create_new, range_begin + (n - n_create_new));
 
           // Create copy.
-          const_iterator from = position + n_copy_old;
+          iterator from = position + n_copy_old;
 
           for (size_t i = 0; i < n_create_copy; ++i)
           {
-            create_element_back(*from++);
+            create_element_back(ETL_MOVE(*from++));
           }
 
-          // Copy old.
-          std::copy_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
+          // Move old.
+          move_range_backward(position, position + n_copy_old, position + n_insert + n_copy_old);
 
           // Copy new.
-          item = range_begin;
-          etl::copy_n(item, n_copy_new, position);
+          copy_range(range_begin, n_copy_new, position);
         }
       }
 
@@ -1412,13 +1420,13 @@ namespace etl
         // Are we closer to the front?
         if (distance(_begin, position) < difference_type(current_size / 2))
         {
-          std::copy_backward(_begin, position, position + 1);
+          move_range_backward(_begin, position, position + 1);
           destroy_element_front();
           ++position;
         }
         else
         {
-          std::copy(position + 1, _end, position);
+          move_range(position + 1, _end, position);
           destroy_element_back();
         }
       }
@@ -1441,23 +1449,23 @@ namespace etl
       // How many to erase?
       size_t length = std::distance(range_begin, range_end);
 
+      // Nothing to erase?
+      if (length == 0)
+      {
+        return position;
+      }
+
       // At the beginning?
       if (position == _begin)
       {
-        for (size_t i = 0; i < length; ++i)
-        {
-          destroy_element_front();
-        }
+        destroy_element_front(length);
 
         position = begin();
       }
       // At the end?
       else if (position == _end - length)
       {
-        for (size_t i = 0; i < length; ++i)
-        {
-          destroy_element_back();
-        }
+        destroy_element_back(length);
 
         position = end();
       }
@@ -1468,12 +1476,9 @@ namespace etl
         if (distance(_begin, position) < difference_type(current_size / 2))
         {
           // Move the items.
-          std::copy_backward(_begin, position, position + length);
+          move_range_backward(_begin, position, position + length);
 
-          for (size_t i = 0; i < length; ++i)
-          {
-            destroy_element_front();
-          }
+          destroy_element_front(length);
 
           position += length;
         }
@@ -1481,12 +1486,9 @@ namespace etl
           // Must be closer to the back.
         {
           // Move the items.
-          std::copy(position + length, _end, position);
+          move_range(position + length, _end, position);
 
-          for (size_t i = 0; i < length; ++i)
-          {
-            destroy_element_back();
-          }
+          destroy_element_back(length);
         }
       }
 
@@ -1498,7 +1500,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
     ///\param item The item to push to the deque.
     //*************************************************************************
-    void push_back(parameter_t item)
+    void push_back(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1506,6 +1508,21 @@ namespace etl
       create_element_back(item);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds an item to the back of the deque by moving it.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_back(T&& item)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+      create_element_back(std::move(item));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1522,6 +1539,7 @@ namespace etl
       return r;
     }
 
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     /// Emplaces an item to the back of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1589,6 +1607,25 @@ namespace etl
       ++current_size;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#else
+    //*************************************************************************
+    /// Emplaces an item to the back of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param args The constructor arguments.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+
+      ::new (&(*_end)) T(std::forward<Args>(args)...);
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#endif
 
     //*************************************************************************
     /// Removes the oldest item from the deque.
@@ -1606,7 +1643,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
     ///\param item The item to push to the deque.
     //*************************************************************************
-    void push_front(parameter_t item)
+    void push_front(const_reference item)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(deque_full));
@@ -1614,6 +1651,21 @@ namespace etl
       create_element_front(item);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds an item to the front of the deque by moving it.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param item The item to push to the deque.
+    //*************************************************************************
+    void push_front(T&& item)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+      create_element_front(std::move(item));
+    }
+#endif
+
     //*************************************************************************
     /// Adds one to the front of the deque and returns a reference to the new element.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1629,6 +1681,7 @@ namespace etl
       return *_begin;
     }
 
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     /// Emplaces an item to the front of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1696,6 +1749,25 @@ namespace etl
       ++current_size;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#else
+    //*************************************************************************
+    /// Emplaces an item to the front of the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
+    ///\param args The constructor arguments.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+#endif
+
+      --_begin;
+      ::new (&(*_begin)) T(std::forward<Args>(args)...);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#endif
 
     //*************************************************************************
     /// Removes the oldest item from the deque.
@@ -1783,6 +1855,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    /// The elements are moved and 'rhs' is left empty.
+    //*************************************************************************
+    ideque& operator =(ideque&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
 #ifdef ETL_IDEQUE_REPAIR_ENABLE
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
@@ -1801,6 +1889,26 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Moves the elements of 'other' to this deque and clears 'other'.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if 'other' is larger than the capacity.
+    //*********************************************************************
+    void move_container(ideque&& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(deque_full));
+
+      initialise();
+
+      for (iterator itr = other.begin(); itr != other.end(); ++itr)
+      {
+        create_element_back(std::move(*itr));
+      }
+
+      other.initialise();
+    }
+#endif
+
     //*********************************************************************
     /// Initialise the deque.
     //*********************************************************************
@@ -1852,36 +1960,95 @@ namespace etl
     }
 
     //*********************************************************************
-    /// Create a new elements from a range at the front.
+    /// Create new elements from a range at the front.
     //*********************************************************************
     template <typename TIterator>
     void create_element_front(size_t n, TIterator from)
+    {
+      _begin -= n;
+      create_range(_begin, n, from);
+    }
+
+    //*********************************************************************
+    /// Create new elements from a range at the back.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_element_back(size_t n, TIterator from)
+    {
+      iterator to = _end;
+      _end += n;
+      create_range(to, n, from);
+    }
+
+    //*********************************************************************
+    /// Constructs 'n' elements from a range in the unused slots from 'to'.
+    /// The slots form at most two contiguous runs of the buffer, so
+    /// trivially copyable elements from a pointer range are copied with at
+    /// most two memcpys.
+    //*********************************************************************
+    template <typename TIterator>
+    void create_range(iterator to, size_t n, TIterator from)
     {
       if (n == 0)
       {
         return;
       }
 
-      if (!empty())
-      {
-        --_begin;
-        --n;
-      }
+      const size_t n_one = std::min(n, BUFFER_SIZE - size_t(to.index));
 
-      if (n > 0)
+      TIterator middle = from;
+      std::advance(middle, n_one);
+      etl::uninitialized_copy(from, middle, p_buffer + to.index);
+
+      TIterator last = middle;
+      std::advance(last, n - n_one);
+      etl::uninitialized_copy(middle, last, p_buffer);
+
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
+    //*********************************************************************
+    /// Copies 'n' elements from a range over the elements from 'to'.
+    /// As create_range, in at most two contiguous runs.
+    //*********************************************************************
+    template <typename TIterator>
+    void copy_range(TIterator from, size_t n, iterator to)
+    {
+      if (n == 0)
       {
-        _begin -= n;
+        return;
       }
 
-      iterator item = _begin;
+      const size_t n_one = std::min(n, BUFFER_SIZE - size_t(to.index));
 
-      do
-      {
-        ::new (&(*item++)) T(*from);
-        ++from;
-        ++current_size;
-        ETL_INCREMENT_DEBUG_COUNT;
-      } while (n-- != 0);
+      TIterator middle = from;
+      std::advance(middle, n_one);
+      std::copy(from, middle, p_buffer + to.index);
+
+      TIterator last = middle;
+      std::advance(last, n - n_one);
+      std::copy(middle, last, p_buffer);
+    }
+
+    //*********************************************************************
+    /// Converts an index from the front to an index in the buffer.
+    //*********************************************************************
+    size_t buffer_index(size_t index) const
+    {
+      index += _begin.index;
+
+      return (index >= BUFFER_SIZE) ? index - BUFFER_SIZE : index;
+    }
+
+    //*********************************************************************
+    /// The length of the run from the front to the end of the buffer.
+    //*********************************************************************
+    size_t size_one() const
+    {
+      const size_t to_end = BUFFER_SIZE - size_t(_begin.index);
+
+      return (to_end < current_size) ? to_end : current_size;
     }
 
     //*********************************************************************
@@ -1898,7 +2065,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a default value at the front.
     //*********************************************************************
-    void create_element_front(parameter_t value)
+    void create_element_front(const_reference value)
     {
       --_begin;
       ::new (&(*_begin)) T(value);
@@ -1909,7 +2076,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a value at the back
     //*********************************************************************
-    void create_element_back(parameter_t value)
+    void create_element_back(const_reference value)
     {
       ::new (&(*_end)) T(value);
       ++_end;
@@ -1917,6 +2084,94 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Create a new element at the front by moving a value.
+    //*********************************************************************
+    void create_element_front(T&& value)
+    {
+      --_begin;
+      ::new (&(*_begin)) T(std::move(value));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*********************************************************************
+    /// Create a new element at the back by moving a value.
+    //*********************************************************************
+    void create_element_back(T&& value)
+    {
+      ::new (&(*_end)) T(std::move(value));
+      ++_end;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#endif
+
+    //*********************************************************************
+    /// Moves the elements on the shorter side of 'position' out by one.
+    /// Returns the position of the gap, which holds a moved from element.
+    //*********************************************************************
+    iterator shift_for_insert(iterator position)
+    {
+      // Are we closer to the front?
+      if (std::distance(_begin, position) < std::distance(position, _end - 1))
+      {
+        create_element_front(ETL_MOVE(*_begin));
+        move_range(_begin + 2, position, _begin + 1);
+        --position;
+      }
+      else
+      {
+        create_element_back(ETL_MOVE(*(_end - 1)));
+        move_range_backward(position, _end - 2, _end - 1);
+      }
+
+      return position;
+    }
+
+    //*********************************************************************
+    /// Moves [first, last) to the range starting at destination.
+    /// Trivially copyable elements are moved as a single block if neither
+    /// range wraps around the end of the buffer.
+    //*********************************************************************
+    void move_range(iterator first, iterator last, iterator destination)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_copyable<T>::value)
+      {
+        const size_t n = std::distance(first, last);
+
+        if (((size_t(first.index) + n) <= BUFFER_SIZE) && ((size_t(destination.index) + n) <= BUFFER_SIZE))
+        {
+          etl::move(p_buffer + first.index, p_buffer + first.index + n, p_buffer + destination.index);
+          return;
+        }
+      }
+
+      etl::move(first, last, destination);
+    }
+
+    //*********************************************************************
+    /// Moves [first, last) to the range ending at destination.
+    /// Trivially copyable elements are moved as a single block if neither
+    /// range wraps around the end of the buffer.
+    //*********************************************************************
+    void move_range_backward(iterator first, iterator last, iterator destination)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_copyable<T>::value)
+      {
+        const size_t n = std::distance(first, last);
+
+        if (((size_t(first.index) + n) <= BUFFER_SIZE) && (size_t(destination.index) >= n))
+        {
+          etl::move_backward(p_buffer + first.index, p_buffer + first.index + n, p_buffer + destination.index);
+          return;
+        }
+      }
+
+      etl::move_backward(first, last, destination);
+    }
+
     //*********************************************************************
     /// Destroy an element at the front.
     //*********************************************************************
@@ -1939,6 +2194,46 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Destroy 'n' elements at the front.
+    //*********************************************************************
+    void destroy_element_front(size_t n)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        _begin += n;
+        current_size -= n;
+        ETL_SUBTRACT_DEBUG_COUNT(n);
+      }
+      else
+      {
+        while (n-- > 0)
+        {
+          destroy_element_front();
+        }
+      }
+    }
+
+    //*********************************************************************
+    /// Destroy 'n' elements at the back.
+    //*********************************************************************
+    void destroy_element_back(size_t n)
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        _end -= n;
+        current_size -= n;
+        ETL_SUBTRACT_DEBUG_COUNT(n);
+      }
+      else
+      {
+        while (n-- > 0)
+        {
+          destroy_element_back();
+        }
+      }
+    }
+
     //*************************************************************************
     /// Measures the distance between two iterators.
     //*************************************************************************
@@ -2047,6 +2342,19 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor.
+    /// The elements are moved and 'other' is left empty.
+    //*************************************************************************
+    deque(deque&& other)
+      : etl::ideque<T>(reinterpret_cast<T*>(&buffer[0]), MAX_SIZE, BUFFER_SIZE)
+    {
+      this->initialise();
+      this->move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Assigns data to the deque.
     //*************************************************************************
@@ -2090,6 +2398,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    deque& operator =(deque&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
@@ -64,6 +64,7 @@ namespace etl
 
     typedef etl::ireference_flat_map<TKey, TMapped, TKeyCompare> refmap_t;
     typedef typename refmap_t::lookup_t lookup_t;
+    typedef typename refmap_t::key_lookup_t key_lookup_t;
     typedef etl::ipool storage_t;
 
   public:
@@ -281,11 +282,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the flat_map from a range sorted by key.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If ETL_THROW_EXCEPTIONS & ETL_DEBUG are defined, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_map_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -326,18 +342,31 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Of several values in the range with the same key, the first is inserted, as by single inserts.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, sorted by key, to the flat_map.
+    /// The range is merged with the existing elements in one pass.
+    /// Of several values in the range with the same key, the first is inserted.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -679,6 +708,34 @@ namespace etl
       return refmap_t::equal_range(key);
     }
 
+    //*********************************************************************
+    /// Freezes the flat_map for read only use.
+    /// The key array is reordered into an Eytzinger layout, so that the first
+    /// levels of every search share the same few cache lines.
+    /// Inserting or erasing elements thaws the map again.
+    //*********************************************************************
+    void freeze()
+    {
+      refmap_t::freeze();
+    }
+
+    //*********************************************************************
+    /// Restores the sorted key array of a frozen flat_map.
+    //*********************************************************************
+    void thaw()
+    {
+      refmap_t::thaw();
+    }
+
+    //*********************************************************************
+    /// Checks the 'frozen' state of the flat_map.
+    ///\return <b>true</b> if frozen.
+    //*********************************************************************
+    bool frozen() const
+    {
+      return refmap_t::frozen();
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -751,8 +808,8 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iflat_map(lookup_t& lookup_, storage_t& storage_)
-      : refmap_t(lookup_),
+    iflat_map(lookup_t& lookup_, key_lookup_t& keys_, storage_t& storage_)
+      : refmap_t(lookup_, keys_),
         storage(storage_)
     {
     }
@@ -762,6 +819,45 @@ namespace etl
     // Disable copy construction.
     iflat_map(const iflat_map&);
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = refmap_t::size();
+
+      while ((first != last) && !refmap_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+      }
+
+      const size_t skip = refmap_t::sort_appended(n, sorted);
+
+      // Destroy the duplicates.
+      iterator itr = begin();
+      std::advance(itr, n);
+
+      for (size_t i = 0; i < skip; ++i)
+      {
+        itr->~value_type();
+        storage.release(etl::addressof(*itr));
+        ++itr;
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      refmap_t::merge_appended(n, skip);
+
+      // Any that did not fit may still be duplicates, so insert one at a time.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     storage_t& storage;
 
     /// Internal debugging.
@@ -828,7 +924,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     flat_map()
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, keys, storage)
     {
     }
 
@@ -836,7 +932,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     flat_map(const flat_map& other)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, keys, storage)
     {
       this->assign(other.cbegin(), other.cend());
     }
@@ -849,7 +945,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     flat_map(TIterator first, TIterator last)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, keys, storage)
     {
       this->assign(first, last);
     }
@@ -859,7 +955,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     flat_map(std::initializer_list<typename etl::iflat_map<TKey, TValue, TCompare>::value_type> init)
-      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, keys, storage)
     {
       this->assign(init.begin(), init.end());
     }
@@ -895,6 +991,9 @@ namespace etl
 
     /// The vector that stores pointers to the nodes.
     etl::vector<node_t*, MAX_SIZE> lookup;
+
+    /// The vector that stores a copy of the keys.
+    etl::vector<TKey, MAX_SIZE> keys;
   };
 }
 
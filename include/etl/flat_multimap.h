@@ -238,11 +238,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the flat_multimap from a range sorted by key.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_multimap_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -279,18 +294,30 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multimap.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// New values are placed before existing ones with the same key.
     /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, sorted by key, to the flat_multimap.
+    /// The range is merged with the existing elements in one pass.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multimap_full if the flat_multimap does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -643,6 +670,32 @@ namespace etl
     // Disable copy construction.
     iflat_multimap(const iflat_multimap&);
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = refmap_t::size();
+
+      while ((first != last) && !refmap_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refmap_t::append(*pvalue);
+      }
+
+      refmap_t::sort_appended(n, sorted);
+      refmap_t::merge_appended(n);
+
+      // Any that did not fit are inserted one at a time, to report the overflow.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     storage_t& storage;
 
     /// Internal debugging.
@@ -214,11 +214,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the flat_multiset from a sorted range.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_multiset_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -255,18 +270,30 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multiset.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// New values are placed before existing equal ones.
     /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the flat_multiset.
+    /// The range is merged with the existing elements in one pass.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*************************************************************************
@@ -603,6 +630,32 @@ namespace etl
     // Disable copy construction.
     iflat_multiset(const iflat_multiset&);
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = refset_t::size();
+
+      while ((first != last) && !refset_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT;
+        refset_t::append(*pvalue);
+      }
+
+      refset_t::sort_appended(n, sorted);
+      refset_t::merge_appended(n);
+
+      // Any that did not fit are inserted one at a time, to report the overflow.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     storage_t& storage;
 
     /// Internal debugging.
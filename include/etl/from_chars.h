@@ -0,0 +1,641 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROM_CHARS_INCLUDED
+#define ETL_FROM_CHARS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <limits>
+
+#include "platform.h"
+#include "string_view.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "enum_type.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "59"
+
+//*****************************************************************************
+///\defgroup from_chars from_chars
+/// Parses integral and floating point values from characters, in the style
+/// of std::from_chars. No memory is allocated, leading white space and '+'
+/// are not accepted, and the value is only changed if the parse succeeds.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup from_chars
+  /// Exception base for from_chars
+  //***************************************************************************
+  class from_chars_exception : public etl::exception
+  {
+  public:
+
+    from_chars_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup from_chars
+  /// Invalid base exception.
+  //***************************************************************************
+  class from_chars_invalid_base : public etl::from_chars_exception
+  {
+  public:
+
+    from_chars_invalid_base(string_type file_name_, numeric_type line_number_)
+      : from_chars_exception(ETL_ERROR_TEXT("from_chars:base", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The status of a from_chars call.
+  ///\ingroup from_chars
+  //***************************************************************************
+  struct from_chars_status
+  {
+    enum enum_type
+    {
+      ok,
+      invalid_argument,
+      result_out_of_range
+    };
+
+    ETL_DECLARE_ENUM_TYPE(from_chars_status, int)
+    ETL_ENUM_TYPE(ok,                  "ok")
+    ETL_ENUM_TYPE(invalid_argument,    "invalid_argument")
+    ETL_ENUM_TYPE(result_out_of_range, "result_out_of_range")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a from_chars call.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T>
+  struct from_chars_result
+  {
+    const T*               ptr;    ///< The first character not parsed. The start of the text if it was invalid.
+    etl::from_chars_status status;
+  };
+
+  namespace private_from_chars
+  {
+    //*************************************************************************
+    /// The unsigned type used to parse an integral type.
+    //*************************************************************************
+    template <typename TValue>
+    struct unsigned_type
+    {
+      typedef typename etl::conditional<(sizeof(TValue) <= sizeof(uint32_t)), uint32_t, uint64_t>::type type;
+    };
+
+    //*************************************************************************
+    /// The value of a digit in any base up to 36, or 36 if it is not a digit.
+    //*************************************************************************
+    template <typename T>
+    uint32_t digit_value(T c)
+    {
+      if ((c >= T('0')) && (c <= T('9')))
+      {
+        return uint32_t(c - T('0'));
+      }
+      else if ((c >= T('a')) && (c <= T('z')))
+      {
+        return uint32_t(c - T('a')) + 10U;
+      }
+      else if ((c >= T('A')) && (c <= T('Z')))
+      {
+        return uint32_t(c - T('A')) + 10U;
+      }
+      else
+      {
+        return 36U;
+      }
+    }
+
+    //*************************************************************************
+    /// Matches a lower case word, ignoring case.
+    ///\return The end of the match, or 'first' if it did not match.
+    //*************************************************************************
+    template <typename T>
+    const T* match(const T* first, const T* last, const char* word)
+    {
+      const T* p = first;
+
+      while (*word != 0)
+      {
+        if ((p == last) || ((*p != T(*word)) && (*p != T(*word - ('a' - 'A')))))
+        {
+          return first;
+        }
+
+        ++p;
+        ++word;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Powers of ten that are exact as doubles.
+    //*************************************************************************
+    inline const double* exact_powers_of_10()
+    {
+      static const double powers[] =
+      {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+      };
+
+      return powers;
+    }
+
+    //*************************************************************************
+    /// The limits of the exact conversion of mantissa * 10^exponent.
+    //*************************************************************************
+    template <typename TFloat>
+    struct exact_limits
+    {
+      static const uint64_t MAX_MANTISSA = 0x0020000000000000; // 2^53
+      static const int      MAX_EXPONENT = 22;
+    };
+
+    template <>
+    struct exact_limits<float>
+    {
+      static const uint64_t MAX_MANTISSA = 0x01000000; // 2^24
+      static const int      MAX_EXPONENT = 10;
+    };
+
+    //*************************************************************************
+    /// Writes 'e', the sign and the digits of the exponent, and a terminator.
+    ///\return The end of the written characters.
+    //*************************************************************************
+    inline char* write_exponent(char* p, int exponent)
+    {
+      // Far beyond any representable value, and short enough for the buffer.
+      exponent = (exponent < -99999) ? -99999 : ((exponent > 99999) ? 99999 : exponent);
+
+      *p++ = 'e';
+      *p++ = (exponent < 0) ? '-' : '+';
+
+      uint32_t e = (exponent < 0) ? uint32_t(-exponent) : uint32_t(exponent);
+      char digits[5];
+      int  n = 0;
+
+      do
+      {
+        digits[n++] = char('0' + (e % 10U));
+        e /= 10U;
+      } while (e != 0U);
+
+      while (n > 0)
+      {
+        *p++ = digits[--n];
+      }
+
+      *p = 0;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Converts mantissa * 10^exponent, where the mantissa holds every
+    /// significant digit.
+    /// When both are small enough the conversion is exact, with a single
+    /// multiply or divide. Otherwise the digits are passed to strtod.
+    /// The digits are written with no decimal point, so the C locale does not
+    /// affect the result.
+    //*************************************************************************
+    template <typename TFloat>
+    TFloat convert(uint64_t mantissa, int exponent)
+    {
+      typedef typename etl::conditional<etl::is_same<TFloat, float>::value, float, double>::type float_t;
+
+      if ((mantissa <= exact_limits<float_t>::MAX_MANTISSA) &&
+          (exponent >= -exact_limits<float_t>::MAX_EXPONENT) &&
+          (exponent <= exact_limits<float_t>::MAX_EXPONENT))
+      {
+        const float_t m = float_t(mantissa);
+
+        return (exponent < 0) ? TFloat(m / float_t(exact_powers_of_10()[-exponent]))
+                              : TFloat(m * float_t(exact_powers_of_10()[exponent]));
+      }
+
+      // Mantissa, 'e', sign, exponent, terminator.
+      char buffer[20 + 1 + 1 + 5 + 1];
+      char digits[20];
+      int  n = 0;
+
+      do
+      {
+        digits[n++] = char('0' + (mantissa % 10U));
+        mantissa /= 10U;
+      } while (mantissa != 0U);
+
+      char* p = buffer;
+
+      while (n > 0)
+      {
+        *p++ = digits[--n];
+      }
+
+      write_exponent(p, exponent);
+
+      return TFloat(strtod(buffer, 0));
+    }
+
+    //*************************************************************************
+    /// Converts the digits in [first, last), with an optional decimal point,
+    /// times 10^exponent, with strtod.
+    /// Used when there are too many significant digits for the mantissa.
+    /// The halfway point between two doubles has at most 767 significant
+    /// digits, so any beyond MAX_SIGNIFICANT can be replaced by a single
+    /// trailing '1' without changing the rounding.
+    //*************************************************************************
+    template <typename T>
+    double convert_digits(const T* first, const T* last, int exponent)
+    {
+      static const int MAX_SIGNIFICANT = 800;
+
+      // Digits, sticky digit, 'e', sign, exponent, terminator.
+      char  buffer[MAX_SIGNIFICANT + 1 + 1 + 1 + 5 + 1];
+      char* p        = buffer;
+      int   n        = 0;
+      bool  fraction = false;
+      bool  sticky   = false;
+
+      for (; first != last; ++first)
+      {
+        if (*first == T('.'))
+        {
+          fraction = true;
+          continue;
+        }
+
+        const char digit = char(*first - T('0'));
+
+        if (n < MAX_SIGNIFICANT)
+        {
+          if ((n != 0) || (digit != 0))
+          {
+            *p++ = char('0' + digit);
+            ++n;
+          }
+
+          if (fraction)
+          {
+            --exponent;
+          }
+        }
+        else
+        {
+          if (!fraction)
+          {
+            ++exponent;
+          }
+
+          sticky = sticky || (digit != 0);
+        }
+      }
+
+      if (sticky)
+      {
+        *p++ = '1';
+        --exponent;
+      }
+
+      write_exponent(p, exponent);
+
+      return strtod(buffer, 0);
+    }
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from [first, last).
+  /// A leading '-' is accepted for signed types.
+  ///\ingroup from_chars
+  ///\param first The first character.
+  ///\param last  One past the last character.
+  ///\param value Set to the parsed value, if successful.
+  ///\param base  The base, 2 to 36. Letters for digits above 9 may be either case.
+  /// If asserts or exceptions are enabled, emits etl::from_chars_invalid_base
+  /// if the base is not 2 to 36. Otherwise returns invalid_argument.
+  ///\return The end of the parsed characters and the status.
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_integral<TValue>::value && !etl::is_same<TValue, bool>::value, etl::from_chars_result<T> >::type
+    from_chars(const T* first, const T* last, TValue& value, uint32_t base = 10U)
+  {
+    typedef typename private_from_chars::unsigned_type<TValue>::type unsigned_t;
+
+    etl::from_chars_result<T> result;
+    result.ptr    = first;
+    result.status = etl::from_chars_status::invalid_argument;
+
+    if ((base < 2U) || (base > 36U))
+    {
+      ETL_ASSERT(false, ETL_ERROR(from_chars_invalid_base));
+      return result;
+    }
+
+    const T* p = first;
+    bool negative = false;
+
+    if (etl::is_signed<TValue>::value && (p != last) && (*p == T('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    const unsigned_t limit  = negative ? unsigned_t(unsigned_t(etl::integral_limits<TValue>::max) + 1U)
+                                       : unsigned_t(etl::integral_limits<TValue>::max);
+    const unsigned_t cutoff = limit / base;
+    const uint32_t   cutlim = uint32_t(limit % base);
+
+    const T*   digits     = p;
+    unsigned_t magnitude  = 0U;
+    bool       overflow   = false;
+
+    while (p != last)
+    {
+      const uint32_t digit = private_from_chars::digit_value(*p);
+
+      if (digit >= base)
+      {
+        break;
+      }
+
+      if ((magnitude > cutoff) || ((magnitude == cutoff) && (digit > cutlim)))
+      {
+        overflow = true;
+      }
+      else
+      {
+        magnitude = unsigned_t(magnitude * base) + digit;
+      }
+
+      ++p;
+    }
+
+    if (p == digits)
+    {
+      return result;
+    }
+
+    result.ptr = p;
+
+    if (overflow)
+    {
+      result.status = etl::from_chars_status::result_out_of_range;
+    }
+    else
+    {
+      value         = negative ? TValue(unsigned_t(0U) - magnitude) : TValue(magnitude);
+      result.status = etl::from_chars_status::ok;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from [first, last).
+  /// Accepts [-]digits[.digits][(e|E)[+|-]digits], "inf", "infinity" and "nan",
+  /// ignoring case. At least one digit is required before or after the point.
+  /// Double results are correctly rounded. A float that is not converted
+  /// exactly is rounded through double, and long double is parsed as double.
+  ///\ingroup from_chars
+  ///\param first The first character.
+  ///\param last  One past the last character.
+  ///\param value Set to the parsed value, if successful.
+  ///\return The end of the parsed characters and the status.
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::from_chars_result<T> >::type
+    from_chars(const T* first, const T* last, TValue& value)
+  {
+    etl::from_chars_result<T> result;
+    result.ptr    = first;
+    result.status = etl::from_chars_status::invalid_argument;
+
+    const T* p = first;
+    bool negative = false;
+
+    if ((p != last) && (*p == T('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    // Infinity and not-a-number.
+    const T* word_end = private_from_chars::match(p, last, "inf");
+
+    if (word_end != p)
+    {
+      const T* long_end = private_from_chars::match(word_end, last, "inity");
+
+      result.ptr    = (long_end != word_end) ? long_end : word_end;
+      result.status = etl::from_chars_status::ok;
+      value         = negative ? -std::numeric_limits<TValue>::infinity() : std::numeric_limits<TValue>::infinity();
+      return result;
+    }
+
+    word_end = private_from_chars::match(p, last, "nan");
+
+    if (word_end != p)
+    {
+      result.ptr    = word_end;
+      result.status = etl::from_chars_status::ok;
+      value         = negative ? -std::numeric_limits<TValue>::quiet_NaN() : std::numeric_limits<TValue>::quiet_NaN();
+      return result;
+    }
+
+    // Up to 19 significant digits fit in the mantissa. If there are more, the
+    // digits are read again by convert_digits.
+    const int MAX_DIGITS = 19;
+
+    const T* digits_first = p;
+
+    uint64_t mantissa   = 0U;
+    int      n_digits   = 0;
+    int      exponent   = 0;
+    bool     has_digits = false;
+    bool     sticky     = false;
+
+    while ((p != last) && (*p >= T('0')) && (*p <= T('9')))
+    {
+      const uint32_t digit = uint32_t(*p - T('0'));
+      has_digits = true;
+
+      if (n_digits < MAX_DIGITS)
+      {
+        if ((mantissa != 0U) || (digit != 0U))
+        {
+          mantissa = (mantissa * 10U) + digit;
+          ++n_digits;
+        }
+      }
+      else
+      {
+        ++exponent;
+        sticky = sticky || (digit != 0U);
+      }
+
+      ++p;
+    }
+
+    if ((p != last) && (*p == T('.')))
+    {
+      ++p;
+
+      while ((p != last) && (*p >= T('0')) && (*p <= T('9')))
+      {
+        const uint32_t digit = uint32_t(*p - T('0'));
+        has_digits = true;
+
+        if (n_digits < MAX_DIGITS)
+        {
+          if ((mantissa != 0U) || (digit != 0U))
+          {
+            mantissa = (mantissa * 10U) + digit;
+            ++n_digits;
+          }
+
+          --exponent;
+        }
+        else
+        {
+          sticky = sticky || (digit != 0U);
+        }
+
+        ++p;
+      }
+    }
+
+    if (!has_digits)
+    {
+      return result;
+    }
+
+    const T* digits_last       = p;
+    int      explicit_exponent = 0;
+
+    // The exponent is only consumed if it has at least one digit.
+    if ((p != last) && ((*p == T('e')) || (*p == T('E'))))
+    {
+      const T* q = p + 1;
+      bool negative_exponent = false;
+
+      if ((q != last) && ((*q == T('-')) || (*q == T('+'))))
+      {
+        negative_exponent = (*q == T('-'));
+        ++q;
+      }
+
+      if ((q != last) && (*q >= T('0')) && (*q <= T('9')))
+      {
+        int e = 0;
+
+        while ((q != last) && (*q >= T('0')) && (*q <= T('9')))
+        {
+          // Far beyond any representable value, but clear of int overflow.
+          if (e < 100000)
+          {
+            e = (e * 10) + int(*q - T('0'));
+          }
+
+          ++q;
+        }
+
+        explicit_exponent = negative_exponent ? -e : e;
+        exponent += explicit_exponent;
+        p = q;
+      }
+    }
+
+    result.ptr = p;
+
+    TValue magnitude = TValue(0);
+
+    if (mantissa != 0U)
+    {
+      magnitude = sticky ? TValue(private_from_chars::convert_digits(digits_first, digits_last, explicit_exponent))
+                         : private_from_chars::convert<TValue>(mantissa, exponent);
+
+      if ((magnitude == TValue(0)) || (magnitude > std::numeric_limits<TValue>::max()))
+      {
+        result.status = etl::from_chars_status::result_out_of_range;
+        return result;
+      }
+    }
+
+    value         = negative ? -magnitude : magnitude;
+    result.status = etl::from_chars_status::ok;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from a string view.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_integral<TValue>::value && !etl::is_same<TValue, bool>::value, etl::from_chars_result<T> >::type
+    from_chars(const etl::basic_string_view<T>& view, TValue& value, uint32_t base = 10U)
+  {
+    return etl::from_chars(view.begin(), view.end(), value, base);
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from a string view.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::from_chars_result<T> >::type
+    from_chars(const etl::basic_string_view<T>& view, TValue& value)
+  {
+    return etl::from_chars(view.begin(), view.end(), value);
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -74,6 +74,9 @@ cog.outl("//********************************************************************
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "pool.h"
+#include "queue.h"
+#include "packet.h"
 
 #undef ETL_FILE
 #define ETL_FILE "34"
@@ -146,6 +149,19 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Exception for a full event queue.
+  //***************************************************************************
+  class fsm_queue_full_exception : public etl::fsm_exception
+  {
+  public:
+
+    fsm_queue_full_exception(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("fsm:queue full", ETL_FILE"D"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   /// Interface class for FSM states.
   //***************************************************************************
@@ -379,6 +395,373 @@ namespace etl
     etl::fsm_state_id_t number_of_states; ///< The number of states.
   };
 
+  //***************************************************************************
+  /// An FSM that queues the events that are sent to it while it is handling
+  /// an event, and handles them when the current event has completed.
+  /// This is run-to-completion. Events sent from within a state are not
+  /// handled recursively on the stack, so the stack depth is bounded.
+  ///
+  /// Events are posted as their concrete types, and are copied to an internal
+  /// pool. Urgent events are handled before the other queued events. An event
+  /// that a state cannot handle yet may be deferred. It is handled again after
+  /// the next change of state, before the other queued events.
+  ///
+  /// The number of events handled in each state is counted.
+  ///
+  /// \warning Queued messages are destroyed through etl::imessage. Unless
+  /// ETL_POLYMORPHIC_MESSAGES is defined, they should not need their destructors called.
+  /// \tparam MAX_STATES            The maximum number of states.
+  /// \tparam QUEUE_SIZE            The maximum number of queued and deferred events.
+  /// \tparam MAX_MESSAGE_SIZE      The size of the largest message that may be queued.
+  /// \tparam MAX_MESSAGE_ALIGNMENT The largest alignment of a message that may be queued.
+  ///\code
+  /// typedef etl::largest<Start, Stop, SetSpeed> Largest;
+  /// class MotorControl : public etl::queued_fsm<4, 8, Largest::size, Largest::alignment>
+  ///\endcode
+  //***************************************************************************
+  template <const size_t MAX_STATES, const size_t QUEUE_SIZE, const size_t MAX_MESSAGE_SIZE, const size_t MAX_MESSAGE_ALIGNMENT>
+  class queued_fsm : public etl::fsm
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_fsm(etl::message_router_id_t id)
+      : fsm(id),
+        is_running(false),
+        ready_deferred(0)
+    {
+      clear_event_counts();
+    }
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~queued_fsm()
+    {
+      clear_queues();
+    }
+
+    //*******************************************
+    /// Set the states for the FSM
+    //*******************************************
+    template <typename TSize>
+    void set_states(etl::ifsm_state** p_states, TSize size)
+    {
+      ETL_ASSERT((size_t(size) <= MAX_STATES), ETL_ERROR(etl::fsm_state_list_exception));
+      fsm::set_states(p_states, size);
+    }
+
+    //*******************************************
+    /// Starts the FSM.
+    /// Events posted by on_enter_state() are handled when it has completed.
+    ///\param call_on_enter_state If true will call on_enter_state() for the first state. Default = true.
+    //*******************************************
+    void start(bool call_on_enter_state = true)
+    {
+      if (!is_started())
+      {
+        is_running = true;
+        fsm::start(call_on_enter_state);
+        handle_queued_events();
+        is_running = false;
+      }
+    }
+
+    //*******************************************
+    /// Top level message handler for the FSM.
+    //*******************************************
+    void receive(const etl::imessage& message)
+    {
+      receive(get_null_router(), message);
+    }
+
+    //*******************************************
+    /// Top level message handler for the FSM.
+    /// Handles the message, then any events that were posted while handling it.
+    /// If called from within a state, the message is handled immediately, as
+    /// it cannot be copied through etl::imessage. Use post() instead.
+    //*******************************************
+    void receive(etl::imessage_router& source, const etl::imessage& message)
+    {
+      if (is_running)
+      {
+        handle(source, message);
+      }
+      else
+      {
+        is_running = true;
+        handle(source, message);
+        handle_queued_events();
+        is_running = false;
+      }
+    }
+
+    //*******************************************
+    /// Handles a sequence of messages, such as those from one read of a
+    /// network connection. Each message runs to completion before the next.
+    /// The iterators may refer to messages, pointers to messages, or etl::packet.
+    //*******************************************
+    template <typename TIterator>
+    void receive(TIterator first, TIterator last)
+    {
+      etl::imessage_router& source = get_null_router();
+
+      if (is_running)
+      {
+        while (first != last)
+        {
+          handle(source, get_message(*first));
+          ++first;
+        }
+      }
+      else
+      {
+        is_running = true;
+
+        while (first != last)
+        {
+          handle(source, get_message(*first));
+          handle_queued_events();
+          ++first;
+        }
+
+        is_running = false;
+      }
+    }
+
+    //*******************************************
+    /// Posts an event to the back of the queue.
+    /// If no event is being handled, it is handled immediately.
+    /// If asserts or exceptions are enabled, throws an etl::fsm_queue_full_exception
+    /// if the queue is full.
+    ///\return true if the event was queued.
+    //*******************************************
+    template <typename TMessage>
+    bool post(const TMessage& message)
+    {
+      return enqueue(events, message);
+    }
+
+    //*******************************************
+    /// Posts an event that is handled before the other queued events.
+    ///\return true if the event was queued.
+    //*******************************************
+    template <typename TMessage>
+    bool post_urgent(const TMessage& message)
+    {
+      return enqueue(urgent_events, message);
+    }
+
+    //*******************************************
+    /// Defers an event until the next change of state.
+    /// Called by a state for an event that it cannot handle yet.
+    ///\return true if the event was deferred.
+    //*******************************************
+    template <typename TMessage>
+    bool defer(const TMessage& message)
+    {
+      if (pool.full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::fsm_queue_full_exception));
+        return false;
+      }
+
+      deferred_events.push(pool.template create<TMessage>(message));
+
+      return true;
+    }
+
+    //*******************************************
+    /// Gets the number of queued and deferred events.
+    //*******************************************
+    size_t queued_events() const
+    {
+      return pool.size();
+    }
+
+    //*******************************************
+    /// Gets the number of deferred events.
+    //*******************************************
+    size_t deferred_events_size() const
+    {
+      return deferred_events.size();
+    }
+
+    //*******************************************
+    /// Gets the number of events handled in a state.
+    //*******************************************
+    uint32_t get_event_count(etl::fsm_state_id_t id) const
+    {
+      return (id < MAX_STATES) ? event_counts[id] : 0U;
+    }
+
+    //*******************************************
+    /// Clears the event counts.
+    //*******************************************
+    void clear_event_counts()
+    {
+      for (size_t i = 0; i < MAX_STATES; ++i)
+      {
+        event_counts[i] = 0U;
+      }
+    }
+
+    //*******************************************
+    /// Reset the FSM to pre-started state.
+    /// The queued and deferred events are discarded.
+    ///\param call_on_exit_state If true will call on_exit_state() for the current state. Default = false.
+    //*******************************************
+    void reset(bool call_on_exit_state = false)
+    {
+      clear_queues();
+      fsm::reset(call_on_exit_state);
+    }
+
+  private:
+
+    typedef etl::queue<const etl::imessage*, QUEUE_SIZE> queue_t;
+
+    //*******************************************
+    static etl::imessage_router& get_null_router()
+    {
+      static etl::null_message_router nmr;
+      return nmr;
+    }
+
+    //*******************************************
+    static const etl::imessage& get_message(const etl::imessage& message)
+    {
+      return message;
+    }
+
+    //*******************************************
+    static const etl::imessage& get_message(const etl::imessage* p_message)
+    {
+      return *p_message;
+    }
+
+    //*******************************************
+    template <typename TBase, size_t SIZE, size_t ALIGNMENT>
+    static const etl::imessage& get_message(const etl::packet<TBase, SIZE, ALIGNMENT>& packet)
+    {
+      return packet.get();
+    }
+
+    //*******************************************
+    /// Copies the message to the pool and queues it.
+    //*******************************************
+    template <typename TMessage>
+    bool enqueue(queue_t& queue, const TMessage& message)
+    {
+      if (pool.full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::fsm_queue_full_exception));
+        return false;
+      }
+
+      queue.push(pool.template create<TMessage>(message));
+
+      if (!is_running)
+      {
+        is_running = true;
+        handle_queued_events();
+        is_running = false;
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Handles one message, counting it, and makes the deferred events
+    /// ready if the state changed.
+    //*******************************************
+    void handle(etl::imessage_router& source, const etl::imessage& message)
+    {
+      const etl::fsm_state_id_t id = get_state_id();
+
+      ++event_counts[id];
+      fsm::receive(source, message);
+
+      if (get_state_id() != id)
+      {
+        ready_deferred = deferred_events.size();
+      }
+    }
+
+    //*******************************************
+    /// Handles the queued events until there are none left.
+    //*******************************************
+    void handle_queued_events()
+    {
+      etl::imessage_router& source = get_null_router();
+
+      for (;;)
+      {
+        const etl::imessage* p_message;
+
+        if (!urgent_events.empty())
+        {
+          p_message = urgent_events.front();
+          urgent_events.pop();
+        }
+        else if (ready_deferred != 0U)
+        {
+          p_message = deferred_events.front();
+          deferred_events.pop();
+          --ready_deferred;
+        }
+        else if (!events.empty())
+        {
+          p_message = events.front();
+          events.pop();
+        }
+        else
+        {
+          break;
+        }
+
+        handle(source, *p_message);
+        destroy(p_message);
+      }
+    }
+
+    //*******************************************
+    void destroy(const etl::imessage* p_message)
+    {
+      p_message->~imessage();
+      pool.release(p_message);
+    }
+
+    //*******************************************
+    void clear_queue(queue_t& queue)
+    {
+      while (!queue.empty())
+      {
+        destroy(queue.front());
+        queue.pop();
+      }
+    }
+
+    //*******************************************
+    void clear_queues()
+    {
+      clear_queue(urgent_events);
+      clear_queue(deferred_events);
+      clear_queue(events);
+      ready_deferred = 0U;
+    }
+
+    etl::generic_pool<MAX_MESSAGE_SIZE, MAX_MESSAGE_ALIGNMENT, QUEUE_SIZE> pool; ///< The copies of the queued messages.
+    queue_t  urgent_events;            ///< Handled first.
+    queue_t  deferred_events;          ///< Handled after a change of state.
+    queue_t  events;                   ///< Handled in order.
+    bool     is_running;               ///< Is an event being handled?
+    size_t   ready_deferred;           ///< The number of deferred events to handle before the others.
+    uint32_t event_counts[MAX_STATES]; ///< The number of events handled in each state.
+  };
+
   /*[[[cog
   import cog
   ################################################
@@ -0,0 +1,801 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FSM_TABLE_INCLUDED
+#define ETL_FSM_TABLE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "fsm.h"
+
+//*****************************************************************************
+///\defgroup fsm_table fsm_table
+/// A finite state machine where the states, events and transitions are types.
+/// The transitions are compiled into a table of handlers for each event type,
+/// indexed by the current state, so that receiving an event is one indirect
+/// call, with no virtual functions and no switch on the message id.
+///
+/// States may be nested. An event that the current state does not handle is
+/// handled by its parent, and a transition to a state with children enters
+/// its first child. The search through the parents, and the exit and entry
+/// of the states, are resolved at compile time.
+///
+/// Requires C++11.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+
+namespace etl
+{
+  //***************************************************************************
+  /// Declares a state, and optionally its parent.
+  /// The state type may declare either of the following, which are called
+  /// with the context when the state is entered or exited.
+  ///\code
+  /// static void on_enter(TContext& context);
+  /// static void on_exit(TContext& context);
+  ///\endcode
+  ///\ingroup fsm_table
+  //***************************************************************************
+  template <typename TState, typename TParent = void>
+  struct fsm_table_state
+  {
+    typedef TState  state_type;
+    typedef TParent parent_type;
+  };
+
+  //***************************************************************************
+  /// The list of states.
+  /// The first top level state is the initial state.
+  /// The first child of a state is its initial state.
+  ///\ingroup fsm_table
+  //***************************************************************************
+  template <typename... TStates>
+  struct fsm_table_states
+  {
+  };
+
+  //***************************************************************************
+  /// Declares a transition.
+  /// \tparam TFrom   The state that handles the event. Its children inherit the transition.
+  /// \tparam TEvent  The event type.
+  /// \tparam TTo     The next state, or void for an internal transition, which
+  ///                 calls the action but does not exit or enter any state.
+  /// \tparam TAction A functor called as TAction()(context, event), or void.
+  /// \tparam TGuard  A functor called as TGuard()(context, event), returning
+  ///                 false if the transition should not be taken, or void.
+  /// If a guard fails, the next transition for the state and event is tried,
+  /// and then those of its parent.
+  ///\ingroup fsm_table
+  //***************************************************************************
+  template <typename TFrom, typename TEvent, typename TTo = void, typename TAction = void, typename TGuard = void>
+  struct fsm_table_transition
+  {
+    typedef TFrom   from_type;
+    typedef TEvent  event_type;
+    typedef TTo     to_type;
+    typedef TAction action_type;
+    typedef TGuard  guard_type;
+  };
+
+  //***************************************************************************
+  /// The list of transitions.
+  ///\ingroup fsm_table
+  //***************************************************************************
+  template <typename... TTransitions>
+  struct fsm_table_transitions
+  {
+  };
+
+  namespace private_fsm_table
+  {
+    //*************************************************************************
+    template <size_t... INDEXES>
+    struct index_sequence
+    {
+    };
+
+    template <size_t N, size_t... INDEXES>
+    struct make_index_sequence : make_index_sequence<N - 1U, N - 1U, INDEXES...>
+    {
+    };
+
+    template <size_t... INDEXES>
+    struct make_index_sequence<0U, INDEXES...>
+    {
+      typedef index_sequence<INDEXES...> type;
+    };
+
+    //*************************************************************************
+    /// The Nth type of a list.
+    //*************************************************************************
+    template <size_t N, typename T, typename... TRest>
+    struct type_at
+    {
+      typedef typename type_at<N - 1U, TRest...>::type type;
+    };
+
+    template <typename T, typename... TRest>
+    struct type_at<0U, T, TRest...>
+    {
+      typedef T type;
+    };
+
+    //*************************************************************************
+    /// The number of states.
+    //*************************************************************************
+    template <typename TStates>
+    struct state_count;
+
+    template <typename... TStates>
+    struct state_count<etl::fsm_table_states<TStates...> >
+    {
+      static const size_t value = sizeof...(TStates);
+    };
+
+    //*************************************************************************
+    /// The declaration of the Nth state.
+    //*************************************************************************
+    template <size_t N, typename TStates>
+    struct state_at;
+
+    template <size_t N, typename... TStates>
+    struct state_at<N, etl::fsm_table_states<TStates...> >
+    {
+      typedef typename type_at<N, TStates...>::type type;
+    };
+
+    //*************************************************************************
+    /// The index of a state, or the number of states if it is not declared.
+    //*************************************************************************
+    template <typename TState, typename TStates>
+    struct state_index;
+
+    template <typename TState>
+    struct state_index<TState, etl::fsm_table_states<> >
+    {
+      static const size_t value = 0U;
+    };
+
+    template <typename TState, typename TFirst, typename... TRest>
+    struct state_index<TState, etl::fsm_table_states<TFirst, TRest...> >
+    {
+      static const size_t value = etl::is_same<TState, typename TFirst::state_type>::value ? 0U
+                                : 1U + state_index<TState, etl::fsm_table_states<TRest...> >::value;
+    };
+
+    //*************************************************************************
+    /// The index of the parent of state N.
+    /// The root, which is the parent of the top level states, has the index
+    /// of the number of states.
+    //*************************************************************************
+    template <size_t N, typename TStates, bool IS_STATE = (N < state_count<TStates>::value)>
+    struct parent_of
+    {
+      typedef typename state_at<N, TStates>::type::parent_type parent_type;
+
+      static const size_t value = etl::is_same<parent_type, void>::value ? state_count<TStates>::value
+                                : state_index<parent_type, TStates>::value;
+    };
+
+    template <size_t N, typename TStates>
+    struct parent_of<N, TStates, false>
+    {
+      static const size_t value = state_count<TStates>::value;
+    };
+
+    //*************************************************************************
+    /// Is state ANCESTOR state N, or one of its parents?
+    //*************************************************************************
+    template <size_t ANCESTOR, size_t N, typename TStates, bool DONE = (N == ANCESTOR) || (N == state_count<TStates>::value)>
+    struct is_ancestor_or_self
+    {
+      static const bool value = is_ancestor_or_self<ANCESTOR, parent_of<N, TStates>::value, TStates>::value;
+    };
+
+    template <size_t ANCESTOR, size_t N, typename TStates>
+    struct is_ancestor_or_self<ANCESTOR, N, TStates, true>
+    {
+      static const bool value = (N == ANCESTOR);
+    };
+
+    //*************************************************************************
+    /// The first child of state N, or the number of states if it has none.
+    //*************************************************************************
+    template <size_t N, typename TStates, size_t CHILD = 0U, bool DONE = (CHILD == state_count<TStates>::value)>
+    struct first_child
+    {
+      static const size_t value = (parent_of<CHILD, TStates>::value == N) ? CHILD
+                                : first_child<N, TStates, CHILD + 1U>::value;
+    };
+
+    template <size_t N, typename TStates, size_t CHILD>
+    struct first_child<N, TStates, CHILD, true>
+    {
+      static const size_t value = state_count<TStates>::value;
+    };
+
+    //*************************************************************************
+    /// The state that is entered when state N is the target of a transition.
+    //*************************************************************************
+    template <size_t N, typename TStates, size_t CHILD = first_child<N, TStates>::value>
+    struct initial_leaf
+    {
+      static const size_t value = initial_leaf<CHILD, TStates>::value;
+    };
+
+    template <size_t N, typename TStates>
+    struct initial_leaf<N, TStates, state_count<TStates>::value>
+    {
+      static const size_t value = N;
+    };
+
+    //*************************************************************************
+    /// The lowest state that contains both FROM and TO, and is neither.
+    /// The states below it are exited and entered by the transition.
+    //*************************************************************************
+    template <size_t DOMAIN, size_t TO, typename TStates,
+              bool FOUND = is_ancestor_or_self<DOMAIN, parent_of<TO, TStates>::value, TStates>::value>
+    struct find_domain
+    {
+      static const size_t value = find_domain<parent_of<DOMAIN, TStates>::value, TO, TStates>::value;
+    };
+
+    template <size_t DOMAIN, size_t TO, typename TStates>
+    struct find_domain<DOMAIN, TO, TStates, true>
+    {
+      static const size_t value = DOMAIN;
+    };
+
+    template <size_t FROM, size_t TO, typename TStates>
+    struct domain_of : find_domain<parent_of<FROM, TStates>::value, TO, TStates>
+    {
+    };
+
+    //*************************************************************************
+    /// Calls the state's on_enter or on_exit, if it has one.
+    //*************************************************************************
+    template <typename TState, typename TContext>
+    auto call_on_enter(TContext& context, int) -> decltype(TState::on_enter(context), void())
+    {
+      TState::on_enter(context);
+    }
+
+    template <typename TState, typename TContext>
+    void call_on_enter(TContext&, long)
+    {
+    }
+
+    template <typename TState, typename TContext>
+    auto call_on_exit(TContext& context, int) -> decltype(TState::on_exit(context), void())
+    {
+      TState::on_exit(context);
+    }
+
+    template <typename TState, typename TContext>
+    void call_on_exit(TContext&, long)
+    {
+    }
+
+    //*************************************************************************
+    /// Calls the action, if there is one.
+    //*************************************************************************
+    template <typename TAction>
+    struct action
+    {
+      template <typename TContext, typename TEvent>
+      static void execute(TContext& context, const TEvent& event)
+      {
+        TAction()(context, event);
+      }
+    };
+
+    template <>
+    struct action<void>
+    {
+      template <typename TContext, typename TEvent>
+      static void execute(TContext&, const TEvent&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Calls the guard, if there is one.
+    //*************************************************************************
+    template <typename TGuard>
+    struct guard
+    {
+      template <typename TContext, typename TEvent>
+      static bool execute(TContext& context, const TEvent& event)
+      {
+        return TGuard()(context, event);
+      }
+    };
+
+    template <>
+    struct guard<void>
+    {
+      template <typename TContext, typename TEvent>
+      static bool execute(TContext&, const TEvent&)
+      {
+        return true;
+      }
+    };
+
+    //*************************************************************************
+    /// Exits the states from N up to, but not including, DOMAIN.
+    //*************************************************************************
+    template <size_t N, size_t DOMAIN, typename TStates, bool DONE = (N == DOMAIN)>
+    struct exit_to
+    {
+      template <typename TContext>
+      static void execute(TContext& context)
+      {
+        call_on_exit<typename state_at<N, TStates>::type::state_type>(context, 0);
+        exit_to<parent_of<N, TStates>::value, DOMAIN, TStates>::execute(context);
+      }
+    };
+
+    template <size_t N, size_t DOMAIN, typename TStates>
+    struct exit_to<N, DOMAIN, TStates, true>
+    {
+      template <typename TContext>
+      static void execute(TContext&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Enters the states below DOMAIN, down to and including N.
+    //*************************************************************************
+    template <size_t DOMAIN, size_t N, typename TStates, bool DONE = (N == DOMAIN)>
+    struct enter_from
+    {
+      template <typename TContext>
+      static void execute(TContext& context)
+      {
+        enter_from<DOMAIN, parent_of<N, TStates>::value, TStates>::execute(context);
+        call_on_enter<typename state_at<N, TStates>::type::state_type>(context, 0);
+      }
+    };
+
+    template <size_t DOMAIN, size_t N, typename TStates>
+    struct enter_from<DOMAIN, N, TStates, true>
+    {
+      template <typename TContext>
+      static void execute(TContext&)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Takes a transition, declared for state FROM, from the current state LEAF.
+    //*************************************************************************
+    template <size_t LEAF, size_t FROM, typename TTransition, typename TStates,
+              bool INTERNAL = etl::is_same<typename TTransition::to_type, void>::value>
+    struct take
+    {
+      static const size_t TO     = state_index<typename TTransition::to_type, TStates>::value;
+      static const size_t DOMAIN = domain_of<FROM, TO, TStates>::value;
+      static const size_t TARGET = initial_leaf<TO, TStates>::value;
+
+      template <typename TContext, typename TEvent>
+      static void execute(TContext& context, etl::fsm_state_id_t& current, const TEvent& event)
+      {
+        exit_to<LEAF, DOMAIN, TStates>::execute(context);
+        action<typename TTransition::action_type>::execute(context, event);
+        current = etl::fsm_state_id_t(TARGET);
+        enter_from<DOMAIN, TARGET, TStates>::execute(context);
+      }
+    };
+
+    template <size_t LEAF, size_t FROM, typename TTransition, typename TStates>
+    struct take<LEAF, FROM, TTransition, TStates, true>
+    {
+      template <typename TContext, typename TEvent>
+      static void execute(TContext& context, etl::fsm_state_id_t&, const TEvent& event)
+      {
+        action<typename TTransition::action_type>::execute(context, event);
+      }
+    };
+
+    //*************************************************************************
+    /// The number of transitions.
+    //*************************************************************************
+    template <typename TTransitions>
+    struct transition_count;
+
+    template <typename... TTransitions>
+    struct transition_count<etl::fsm_table_transitions<TTransitions...> >
+    {
+      static const size_t value = sizeof...(TTransitions);
+    };
+
+    //*************************************************************************
+    /// Does transition K of the list apply to state N and the event?
+    /// False if K is past the end of the list.
+    //*************************************************************************
+    template <size_t K, typename TTransitions, typename TStates, size_t N, typename TEvent,
+              bool IS_TRANSITION = (K < transition_count<TTransitions>::value)>
+    struct transition_matches;
+
+    template <size_t K, typename... TTransitions, typename TStates, size_t N, typename TEvent>
+    struct transition_matches<K, etl::fsm_table_transitions<TTransitions...>, TStates, N, TEvent, true>
+    {
+      typedef typename type_at<K, TTransitions...>::type type;
+
+      static const bool value = (state_index<typename type::from_type, TStates>::value == N) &&
+                                etl::is_same<typename type::event_type, TEvent>::value;
+    };
+
+    template <size_t K, typename TTransitions, typename TStates, size_t N, typename TEvent>
+    struct transition_matches<K, TTransitions, TStates, N, TEvent, false>
+    {
+      typedef void type;
+
+      static const bool value = false;
+    };
+
+    //*************************************************************************
+    /// Handles an event in state LEAF, trying the transitions of state N from
+    /// number K, then those of its parents.
+    ///\return false if no transition was taken.
+    //*************************************************************************
+    template <size_t LEAF, size_t N, size_t K, typename TEvent, typename TStates, typename TTransitions,
+              int KIND = (N == state_count<TStates>::value)                     ? 0   // Unhandled.
+                       : (K == transition_count<TTransitions>::value)           ? 1   // Try the parent.
+                       : transition_matches<K, TTransitions, TStates, N, TEvent>::value ? 2   // Try this transition.
+                       : 3>                                                            // Try the next transition.
+    struct handler
+    {
+      template <typename TContext>
+      static bool execute(TContext&, etl::fsm_state_id_t&, const TEvent&)
+      {
+        return false;
+      }
+    };
+
+    template <size_t LEAF, size_t N, size_t K, typename TEvent, typename TStates, typename TTransitions>
+    struct handler<LEAF, N, K, TEvent, TStates, TTransitions, 1>
+    {
+      template <typename TContext>
+      static bool execute(TContext& context, etl::fsm_state_id_t& current, const TEvent& event)
+      {
+        return handler<LEAF, parent_of<N, TStates>::value, 0U, TEvent, TStates, TTransitions>::execute(context, current, event);
+      }
+    };
+
+    template <size_t LEAF, size_t N, size_t K, typename TEvent, typename TStates, typename TTransitions>
+    struct handler<LEAF, N, K, TEvent, TStates, TTransitions, 2>
+    {
+      typedef typename transition_matches<K, TTransitions, TStates, N, TEvent>::type transition_type;
+
+      template <typename TContext>
+      static bool execute(TContext& context, etl::fsm_state_id_t& current, const TEvent& event)
+      {
+        if (guard<typename transition_type::guard_type>::execute(context, event))
+        {
+          take<LEAF, N, transition_type, TStates>::execute(context, current, event);
+          return true;
+        }
+
+        return handler<LEAF, N, K + 1U, TEvent, TStates, TTransitions>::execute(context, current, event);
+      }
+    };
+
+    template <size_t LEAF, size_t N, size_t K, typename TEvent, typename TStates, typename TTransitions>
+    struct handler<LEAF, N, K, TEvent, TStates, TTransitions, 3>
+    {
+      template <typename TContext>
+      static bool execute(TContext& context, etl::fsm_state_id_t& current, const TEvent& event)
+      {
+        return handler<LEAF, N, K + 1U, TEvent, TStates, TTransitions>::execute(context, current, event);
+      }
+    };
+
+    //*************************************************************************
+    /// Are all of the values true?
+    //*************************************************************************
+    template <bool... VALUES>
+    struct all_of;
+
+    template <>
+    struct all_of<>
+    {
+      static const bool value = true;
+    };
+
+    template <bool VALUE, bool... VALUES>
+    struct all_of<VALUE, VALUES...>
+    {
+      static const bool value = VALUE && all_of<VALUES...>::value;
+    };
+
+    //*************************************************************************
+    /// Are the states of a transition declared?
+    //*************************************************************************
+    template <typename TTransition, typename TStates>
+    struct is_valid_transition
+    {
+      static const size_t N = state_count<TStates>::value;
+
+      static const bool value = (state_index<typename TTransition::from_type, TStates>::value < N) &&
+                                (etl::is_same<typename TTransition::to_type, void>::value ||
+                                 (state_index<typename TTransition::to_type, TStates>::value < N));
+    };
+  }
+
+  //***************************************************************************
+  /// The table driven FSM.
+  ///\code
+  /// struct Idle    { static void on_enter(Motor& motor) { motor.lamp_off(); } };
+  /// struct Running { static void on_enter(Motor& motor) { motor.lamp_on(); } };
+  /// struct Start {};
+  /// struct Stop  {};
+  ///
+  /// typedef etl::fsm_table_states<etl::fsm_table_state<Idle>,
+  ///                               etl::fsm_table_state<Running> > States;
+  ///
+  /// typedef etl::fsm_table_transitions<etl::fsm_table_transition<Idle,    Start, Running>,
+  ///                                    etl::fsm_table_transition<Running, Stop,  Idle> > Transitions;
+  ///
+  /// etl::fsm_table<Motor, States, Transitions> fsm(motor);
+  /// fsm.start();
+  /// fsm.receive(Start());
+  ///\endcode
+  /// \tparam TContext     The type passed to the actions, guards, and state entry and exit functions.
+  /// \tparam TStates      An etl::fsm_table_states list.
+  /// \tparam TTransitions An etl::fsm_table_transitions list.
+  ///\ingroup fsm_table
+  //***************************************************************************
+  template <typename TContext, typename TStates, typename TTransitions>
+  class fsm_table;
+
+  template <typename TContext, typename... TStateDefinitions, typename... TTransitionDefinitions>
+  class fsm_table<TContext, etl::fsm_table_states<TStateDefinitions...>, etl::fsm_table_transitions<TTransitionDefinitions...> >
+  {
+  private:
+
+    typedef etl::fsm_table_states<TStateDefinitions...>           states_t;
+    typedef etl::fsm_table_transitions<TTransitionDefinitions...> transitions_t;
+
+  public:
+
+    typedef TContext context_type;
+
+    static const size_t NUMBER_OF_STATES      = sizeof...(TStateDefinitions);
+    static const size_t NUMBER_OF_TRANSITIONS = sizeof...(TTransitionDefinitions);
+
+    ETL_STATIC_ASSERT(NUMBER_OF_STATES > 0U, "There must be at least one state");
+    ETL_STATIC_ASSERT(NUMBER_OF_STATES < size_t(etl::integral_limits<etl::fsm_state_id_t>::max), "Too many states for fsm_state_id_t");
+    ETL_STATIC_ASSERT((private_fsm_table::all_of<private_fsm_table::is_valid_transition<TTransitionDefinitions, states_t>::value...>::value),
+                      "A transition refers to an undeclared state");
+
+    /// The state id before start() and after reset().
+    static const etl::fsm_state_id_t NO_STATE = etl::fsm_state_id_t(NUMBER_OF_STATES);
+
+    //*************************************************************************
+    /// The id of a state, which is its index in the state list.
+    //*************************************************************************
+    template <typename TState>
+    struct state_id
+    {
+      static const etl::fsm_state_id_t value = etl::fsm_state_id_t(private_fsm_table::state_index<TState, states_t>::value);
+
+      ETL_STATIC_ASSERT(value < NUMBER_OF_STATES, "Not a declared state");
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit fsm_table(TContext& context_)
+      : context(context_),
+        current(NO_STATE)
+    {
+    }
+
+    //*************************************************************************
+    /// Starts the FSM, entering the initial state.
+    /// Can only be called once. Subsequent calls will do nothing.
+    //*************************************************************************
+    void start()
+    {
+      if (!is_started())
+      {
+        static const size_t ROOT    = NUMBER_OF_STATES;
+        static const size_t INITIAL = private_fsm_table::initial_leaf<ROOT, states_t>::value;
+
+        current = etl::fsm_state_id_t(INITIAL);
+        private_fsm_table::enter_from<ROOT, INITIAL, states_t>::execute(context);
+      }
+    }
+
+    //*************************************************************************
+    /// Handles an event.
+    ///\return true if a transition was taken.
+    //*************************************************************************
+    template <typename TEvent>
+    bool receive(const TEvent& event)
+    {
+      if (!is_started())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::fsm_null_state_exception));
+        return false;
+      }
+
+      return get_handlers<TEvent>(typename private_fsm_table::make_index_sequence<NUMBER_OF_STATES>::type())[current](context, current, event);
+    }
+
+    //*************************************************************************
+    /// Gets the current state id.
+    //*************************************************************************
+    etl::fsm_state_id_t get_state_id() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// Is the current state TState, or a child of TState?
+    //*************************************************************************
+    template <typename TState>
+    bool is_in_state() const
+    {
+      etl::fsm_state_id_t id = current;
+
+      while (id != NO_STATE)
+      {
+        if (id == state_id<TState>::value)
+        {
+          return true;
+        }
+
+        id = get_parent(id);
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Checks if the FSM has been started.
+    //*************************************************************************
+    bool is_started() const
+    {
+      return current != NO_STATE;
+    }
+
+    //*************************************************************************
+    /// Reset the FSM to pre-started state.
+    ///\param call_on_exit_state If true, exits the current state and its parents. Default = false.
+    //*************************************************************************
+    void reset(bool call_on_exit_state = false)
+    {
+      if (call_on_exit_state)
+      {
+        while (current != NO_STATE)
+        {
+          get_exits(typename private_fsm_table::make_index_sequence<NUMBER_OF_STATES>::type())[current](context);
+          current = get_parent(current);
+        }
+      }
+
+      current = NO_STATE;
+    }
+
+    //*************************************************************************
+    /// Gets the context.
+    //*************************************************************************
+    TContext& get_context() const
+    {
+      return context;
+    }
+
+  private:
+
+    //*************************************************************************
+    template <typename TEvent>
+    struct handler_type
+    {
+      typedef bool (*type)(TContext&, etl::fsm_state_id_t&, const TEvent&);
+    };
+
+    typedef void (*exit_type)(TContext&);
+
+    //*************************************************************************
+    /// The column of the transition table for TEvent.
+    //*************************************************************************
+    template <typename TEvent, size_t... STATES>
+    static const typename handler_type<TEvent>::type* get_handlers(private_fsm_table::index_sequence<STATES...>)
+    {
+      static ETL_CONSTEXPR typename handler_type<TEvent>::type handlers[NUMBER_OF_STATES] =
+      {
+        &private_fsm_table::handler<STATES, STATES, 0U, TEvent, states_t, transitions_t>::template execute<TContext>...
+      };
+
+      return handlers;
+    }
+
+    //*************************************************************************
+    template <size_t... STATES>
+    static const exit_type* get_exits(private_fsm_table::index_sequence<STATES...>)
+    {
+      static ETL_CONSTEXPR exit_type exits[NUMBER_OF_STATES] =
+      {
+        &private_fsm_table::exit_to<STATES, private_fsm_table::parent_of<STATES, states_t>::value, states_t>::template execute<TContext>...
+      };
+
+      return exits;
+    }
+
+    //*************************************************************************
+    static etl::fsm_state_id_t get_parent(etl::fsm_state_id_t id)
+    {
+      return get_parents(typename private_fsm_table::make_index_sequence<NUMBER_OF_STATES>::type())[id];
+    }
+
+    //*************************************************************************
+    template <size_t... STATES>
+    static const etl::fsm_state_id_t* get_parents(private_fsm_table::index_sequence<STATES...>)
+    {
+      static ETL_CONSTEXPR etl::fsm_state_id_t parents[NUMBER_OF_STATES] =
+      {
+        etl::fsm_state_id_t(private_fsm_table::parent_of<STATES, states_t>::value)...
+      };
+
+      return parents;
+    }
+
+    TContext&           context; ///< The context passed to the actions, guards and state functions.
+    etl::fsm_state_id_t current; ///< The current state, always one without children.
+  };
+
+  template <typename TContext, typename... TStateDefinitions, typename... TTransitionDefinitions>
+  const size_t fsm_table<TContext, etl::fsm_table_states<TStateDefinitions...>, etl::fsm_table_transitions<TTransitionDefinitions...> >::NUMBER_OF_STATES;
+
+  template <typename TContext, typename... TStateDefinitions, typename... TTransitionDefinitions>
+  const size_t fsm_table<TContext, etl::fsm_table_states<TStateDefinitions...>, etl::fsm_table_transitions<TTransitionDefinitions...> >::NUMBER_OF_TRANSITIONS;
+
+  template <typename TContext, typename... TStateDefinitions, typename... TTransitionDefinitions>
+  const etl::fsm_state_id_t fsm_table<TContext, etl::fsm_table_states<TStateDefinitions...>, etl::fsm_table_transitions<TTransitionDefinitions...> >::NO_STATE;
+
+  template <typename TContext, typename... TStateDefinitions, typename... TTransitionDefinitions>
+  template <typename TState>
+  const etl::fsm_state_id_t fsm_table<TContext, etl::fsm_table_states<TStateDefinitions...>, etl::fsm_table_transitions<TTransitionDefinitions...> >::state_id<TState>::value;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,576 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include <stddef.h>
+#include <functional>
+#include <new>
+#include <utility>
+
+#include "platform.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "57"
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A fixed capacity priority queue that gives each value a handle, so that
+/// its priority can be changed, or it can be removed, in O(log n).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for indexed_priority_queue exceptions.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public etl::exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a queued value.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_invalid_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:handle", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  ///\brief The base for indexed priority queues of a particular type.
+  ///\details Values are stored in fixed slots, and the heap holds the slot
+  /// numbers, so values do not move as the heap changes. The slot number is
+  /// the handle. A handle is valid until its value is popped or erased, after
+  /// which it may be given to a new value.
+  ///\code
+  /// etl::indexed_priority_queue<Job, 16, JobDeadlineLater> jobs;
+  /// etl::indexed_priority_queue<Job, 16, JobDeadlineLater>::handle_type handle = jobs.push(job);
+  /// job.deadline = new_deadline;
+  /// jobs.update(handle, job);
+  ///\endcode
+  /// \warning This queue cannot be used for concurrent access from multiple threads.
+  /// \tparam T        The type of value that the queue holds.
+  /// \tparam TCompare The comparison. The top is the greatest, as for std::priority_queue.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, typename TCompare = std::less<T>, const size_t ARITY = 2U>
+  class iindexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ARITY >= 2U, "A heap needs at least two children per node");
+
+    typedef T        value_type;      ///< The type stored in the queue.
+    typedef TCompare compare_type;    ///< The comparison type.
+    typedef T&       reference;       ///< A reference to the type used in the queue.
+    typedef const T& const_reference; ///< A const reference to the type used in the queue.
+    typedef size_t   size_type;       ///< The type used for determining the size of the queue.
+    typedef size_t   handle_type;     ///< Identifies a queued value.
+
+    /// The position of a free slot.
+    static const size_t npos = ~size_t(0U);
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value, or npos if the queue is full.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::indexed_priority_queue_full));
+        return npos;
+      }
+
+      const handle_type handle = allocate();
+      ::new (&p_values[handle]) T(value);
+      insert(handle);
+
+      return handle;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the queue by moving it.
+    ///\return The handle of the value, or npos if the queue is full.
+    //*************************************************************************
+    handle_type push(T&& value)
+    {
+      if (full())
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::indexed_priority_queue_full));
+        return npos;
+      }
+
+      const handle_type handle = allocate();
+      ::new (&p_values[handle]) T(std::move(value));
+      insert(handle);
+
+      return handle;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        remove_at(0U);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the value with the handle.
+    /// If asserts or exceptions are enabled, throws an
+    /// etl::indexed_priority_queue_invalid_handle if it is not queued.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      if (!contains(handle))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::indexed_priority_queue_invalid_handle));
+        return;
+      }
+
+      remove_at(p_position[handle]);
+    }
+
+    //*************************************************************************
+    /// Replaces the value with the handle, and moves it to its new place in
+    /// the heap. This is the 'decrease key' and 'increase key' operation.
+    /// If asserts or exceptions are enabled, throws an
+    /// etl::indexed_priority_queue_invalid_handle if it is not queued.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      if (!contains(handle))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::indexed_priority_queue_invalid_handle));
+        return;
+      }
+
+      p_values[handle] = value;
+      restore(p_position[handle]);
+    }
+
+    //*************************************************************************
+    /// Gets the value with the handle.
+    /// Undefined if the handle is not queued.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Checks whether the handle refers to a queued value.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < capacity) && (p_position[handle] != npos);
+    }
+
+    //*************************************************************************
+    /// Returns the current number of items in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items that can be queued.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// Handles are then given out in the same order as for a new queue.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        p_values[p_heap[i]].~T();
+      }
+
+      current_size = 0U;
+      initialise_handles();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_values_, handle_type* p_heap_, size_t* p_position_, handle_type* p_free_, size_t capacity_)
+      : p_values(p_values_),
+        p_heap(p_heap_),
+        p_position(p_position_),
+        p_free(p_free_),
+        capacity(capacity_),
+        current_size(0U)
+    {
+      initialise_handles();
+    }
+
+    //*************************************************************************
+    /// Make this a clone of the supplied queue. The handles are kept.
+    //*************************************************************************
+    void clone(const iindexed_priority_queue& other)
+    {
+      clear();
+
+      for (size_t i = 0U; i < capacity; ++i)
+      {
+        p_position[i] = other.p_position[i];
+        p_free[i]     = other.p_free[i];
+      }
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+
+        p_heap[i] = handle;
+        ::new (&p_values[handle]) T(other.p_values[handle]);
+      }
+
+      current_size = other.current_size;
+    }
+
+  private:
+
+    // Disable copy construction.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+
+    //*************************************************************************
+    /// Marks all handles as free. The low handles are given out first.
+    //*************************************************************************
+    void initialise_handles()
+    {
+      for (size_t i = 0U; i < capacity; ++i)
+      {
+        p_position[i] = npos;
+        p_free[i]     = handle_type(capacity - 1U - i);
+      }
+    }
+
+    //*************************************************************************
+    handle_type allocate()
+    {
+      return p_free[capacity - current_size - 1U];
+    }
+
+    //*************************************************************************
+    void release(handle_type handle)
+    {
+      p_position[handle] = npos;
+      p_free[capacity - current_size - 1U] = handle;
+    }
+
+    //*************************************************************************
+    /// Adds the allocated handle to the heap.
+    //*************************************************************************
+    void insert(handle_type handle)
+    {
+      p_heap[current_size] = handle;
+      p_position[handle]   = current_size;
+      ++current_size;
+
+      sift_up(current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Removes the value at a position in the heap.
+    //*************************************************************************
+    void remove_at(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const handle_type last   = p_heap[current_size - 1U];
+
+      p_values[handle].~T();
+      --current_size;
+      release(handle);
+
+      if (position != current_size)
+      {
+        p_heap[position] = last;
+        p_position[last] = position;
+        restore(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at 'position' up or down to its place.
+    //*************************************************************************
+    void restore(size_t position)
+    {
+      if (!sift_up(position))
+      {
+        sift_down(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at 'position' up to its place.
+    ///\return true if it moved.
+    //*************************************************************************
+    bool sift_up(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const size_t      start  = position;
+
+      while (position > 0U)
+      {
+        const size_t      parent        = (position - 1U) / ARITY;
+        const handle_type parent_handle = p_heap[parent];
+
+        if (!compare(p_values[parent_handle], p_values[handle]))
+        {
+          break;
+        }
+
+        p_heap[position]          = parent_handle;
+        p_position[parent_handle] = position;
+        position = parent;
+      }
+
+      p_heap[position]   = handle;
+      p_position[handle] = position;
+
+      return position != start;
+    }
+
+    //*************************************************************************
+    /// Moves the value at 'position' down to its place.
+    //*************************************************************************
+    void sift_down(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+
+      for (;;)
+      {
+        const size_t child_first = (position * ARITY) + 1U;
+
+        if (child_first >= current_size)
+        {
+          break;
+        }
+
+        const size_t child_last = ((current_size - child_first) > ARITY) ? child_first + ARITY : current_size;
+
+        // Find the highest priority child.
+        size_t best = child_first;
+
+        for (size_t child = child_first + 1U; child < child_last; ++child)
+        {
+          if (compare(p_values[p_heap[best]], p_values[p_heap[child]]))
+          {
+            best = child;
+          }
+        }
+
+        const handle_type best_handle = p_heap[best];
+
+        if (!compare(p_values[handle], p_values[best_handle]))
+        {
+          break;
+        }
+
+        p_heap[position]        = best_handle;
+        p_position[best_handle] = position;
+        position = best;
+      }
+
+      p_heap[position]   = handle;
+      p_position[handle] = position;
+    }
+
+    T*           p_values;     ///< The value slots, indexed by handle.
+    handle_type* p_heap;       ///< The heap of handles.
+    size_t*      p_position;   ///< The heap position of each handle, or npos if free.
+    handle_type* p_free;       ///< The free handles are the first (capacity - size).
+    size_t       capacity;
+    size_t       current_size;
+    TCompare     compare;
+  };
+
+  template <typename T, typename TCompare, const size_t ARITY>
+  const size_t iindexed_priority_queue<T, TCompare, ARITY>::npos;
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// A fixed capacity indexed priority queue.
+  /// \tparam T        The type this queue should support.
+  /// \tparam SIZE     The maximum capacity of the queue.
+  /// \tparam TCompare The comparison. The top is the greatest.
+  /// \tparam ARITY    The number of children of each node of the heap.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, typename TCompare = std::less<T>, const size_t ARITY = 2U>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, ARITY>
+  {
+  public:
+
+    typedef etl::iindexed_priority_queue<T, TCompare, ARITY> base_t;
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base_t(reinterpret_cast<T*>(&buffer), heap, position, free_handles, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. The handles are kept.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& rhs)
+      : base_t(reinterpret_cast<T*>(&buffer), heap, position, free_handles, SIZE)
+    {
+      base_t::clone(rhs);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator. The handles are kept.
+    //*************************************************************************
+    indexed_priority_queue& operator = (const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typename etl::aligned_storage<sizeof(T) * SIZE, etl::alignment_of<T>::value>::type buffer;
+    typename base_t::handle_type heap[SIZE];
+    size_t                       position[SIZE];
+    typename base_t::handle_type free_handles[SIZE];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -35,6 +35,7 @@ SOFTWARE.
 #include <algorithm>
 #include <functional>
 #include <stddef.h>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -768,7 +769,7 @@ namespace etl
     //*************************************************************************
     /// Pushes a value to the front of the list.
     //*************************************************************************
-    void push_front(parameter_t value)
+    void push_front(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(list_full));
@@ -776,8 +777,22 @@ namespace etl
       insert_node(get_head(), allocate_data_node(value));
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Pushes a value to the front of the list by moving it.
+    //*************************************************************************
+    void push_front(T&& value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      insert_node(get_head(), allocate_data_node(std::move(value)));
+    }
+#endif
+
     //*************************************************************************
     /// Emplaces a value to the front of the list..
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     template <typename T1>
     void emplace_front(const T1& value1)
@@ -838,6 +853,23 @@ namespace etl
 
     //*************************************************************************
     /// Removes a value from the front of the list.
+#else
+    //*************************************************************************
+    /// Emplaces a value to the front of the list..
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_front(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(get_head(), *p_data_node);
+    }
+#endif
+
     //*************************************************************************
     void pop_front()
     {
@@ -859,7 +891,7 @@ namespace etl
     //*************************************************************************
     /// Pushes a value to the back of the list..
     //*************************************************************************
-    void push_back(parameter_t value)
+    void push_back(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(list_full));
@@ -867,8 +899,22 @@ namespace etl
       insert_node(terminal_node, allocate_data_node(value));
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Pushes a value to the back of the list by moving it.
+    //*************************************************************************
+    void push_back(T&& value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      insert_node(terminal_node, allocate_data_node(std::move(value)));
+    }
+#endif
+
     //*************************************************************************
     /// Emplaces a value to the back of the list..
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     template <typename T1>
     void emplace_back(const T1& value1)
@@ -929,6 +975,23 @@ namespace etl
 
     //*************************************************************************
     /// Removes a value from the back of the list.
+#else
+    //*************************************************************************
+    /// Emplaces a value to the back of the list..
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+#endif
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(terminal_node, *p_data_node);
+    }
+#endif
+
     //*************************************************************************
     void pop_back()
     {
@@ -952,8 +1015,24 @@ namespace etl
       return iterator(data_node);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Inserts a value to the list at the specified position by moving it.
+    //*************************************************************************
+    iterator insert(iterator position, T&& value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+
+      data_node_t& data_node = allocate_data_node(std::move(value));
+      insert_node(*position.p_node, data_node);
+
+      return iterator(data_node);
+    }
+#endif
+
     //*************************************************************************
     /// Emplaces a value to the list at the specified position.
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     template <typename T1>
     iterator emplace(iterator position, const T1& value1)
@@ -1018,6 +1097,24 @@ namespace etl
 
     //*************************************************************************
     /// Inserts 'n' copies of a value to the list at the specified position.
+#else
+    //*************************************************************************
+    /// Emplaces a value to the list at the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args&& ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(list_full));
+
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+      insert_node(*position.p_node, *p_data_node);
+
+      return iterator(*p_data_node);
+    }
+#endif
+
     //*************************************************************************
     void insert(iterator position, size_t n, const value_type& value)
     {
@@ -1421,6 +1518,42 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Moves the nodes so that they are in list order in memory, and so that
+    /// the free nodes follow them, undoing the scattering caused by inserts
+    /// and erases. Iteration will then walk memory sequentially.
+    /// O(N). Invalidates all iterators, pointers and references.
+    //*************************************************************************
+    void compact()
+    {
+      const size_t n = size();
+
+      // Number the nodes in list order.
+      node_t* p_node = terminal_node.next;
+      size_t  index  = 0;
+
+      while (p_node != &terminal_node)
+      {
+        node_t* p_next = p_node->next;
+        *reinterpret_cast<uintptr_t*>(p_node) = index++;
+        p_node = p_next;
+      }
+
+      p_node_pool->compact(etl::private_pool::node_relocator<data_node_t, T, &data_node_t::value>());
+
+      // Relink them in address order.
+      node_t* p_previous = &terminal_node;
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        p_node = static_cast<data_node_t*>(p_node_pool->item_address(i));
+        join(*p_previous, *p_node);
+        p_previous = p_node;
+      }
+
+      join(*p_previous, terminal_node);
+    }
+
     //*************************************************************************
     /// Assignment operator.
     //*************************************************************************
@@ -1434,6 +1567,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ilist& operator = (ilist&& rhs)
+    {
+      move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1472,6 +1617,32 @@ namespace etl
       join(terminal_node, terminal_node);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move the elements of another list in to this one.
+    /// The nodes live in each list's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(ilist&& other)
+    {
+      if (&other != this)
+      {
+        ETL_ASSERT(other.size() <= max_size(), ETL_ERROR(list_full));
+
+        initialise();
+
+        node_t* p_node = other.terminal_node.next;
+
+        while (p_node != &other.terminal_node)
+        {
+          insert_node(terminal_node, allocate_data_node(std::move(static_cast<data_node_t*>(p_node)->value)));
+          p_node = p_node->next;
+        }
+
+        other.initialise();
+      }
+    }
+#endif
+
   private:
 
     //*************************************************************************
@@ -1543,7 +1714,7 @@ namespace etl
     //*************************************************************************
     /// Allocate a data_node_t.
     //*************************************************************************
-    data_node_t& allocate_data_node(parameter_t value)
+    data_node_t& allocate_data_node(const_reference value)
     {
       data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
       ::new (&(p_data_node->value)) T(value);
@@ -1552,6 +1723,20 @@ namespace etl
       return *p_data_node;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate a data_node_t, moving the value into it.
+    //*************************************************************************
+    data_node_t& allocate_data_node(T&& value)
+    {
+      data_node_t* p_data_node = p_node_pool->allocate<data_node_t>();
+      ::new (&(p_data_node->value)) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return *p_data_node;
+    }
+#endif
+
     //*************************************************************************
     /// Destroy a data_node_t.
     //*************************************************************************
@@ -1664,6 +1849,16 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    list(list&& other)
+      : etl::ilist<T>(node_pool, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -1679,6 +1874,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    list& operator = (list&& rhs)
+    {
+      this->move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used in the list.
@@ -36,6 +36,7 @@ SOFTWARE.
 #include <functional>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -976,6 +977,23 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Moves the nodes so that they are in key order in memory, and so that
+    /// the free nodes follow them, undoing the scattering caused by inserts
+    /// and erases. The tree is rebuilt fully balanced.
+    /// O(N). Invalidates all iterators, pointers and references.
+    //*************************************************************************
+    void compact()
+    {
+      size_t index = 0;
+      number_nodes(root_node, index);
+
+      p_node_pool->compact(etl::private_pool::node_relocator<Data_Node, value_type, &Data_Node::value>());
+
+      size_t height;
+      root_node = build_tree(0, size(), height);
+    }
+
     //*********************************************************************
     /// Counts the number of elements that contain the key specified.
     ///\param key The key to search for.
@@ -1159,6 +1177,64 @@ namespace etl
       return iterator(*this, inserted_node);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Inserts a value to the map by moving it.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = allocate_data_node(std::move(value));
+      Node* inserted_node = insert_node(root_node, node);
+
+      return std::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the map by moving it, starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator, value_type&& value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the map by moving it, starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, value_type&& value)
+    {
+      return insert(std::move(value)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in the map from the arguments.
+    /// If asserts or exceptions are enabled, emits map_full if the map is already full.
+    ///\param args The arguments used to construct the value_type.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args&& ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(map_full));
+
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      Node* inserted_node = insert_node(root_node, node);
+
+      return std::make_pair(iterator(*this, inserted_node), inserted_node == &node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the map.
     /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
@@ -1233,6 +1309,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    imap& operator = (imap&& rhs)
+    {
+      move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -1252,12 +1340,38 @@ namespace etl
       erase(begin(), end());
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move the elements of another map in to this one.
+    /// The nodes live in each map's own pool, so the values are moved one by one.
+    //*************************************************************************
+    void move_container(imap&& other)
+    {
+      if (&other != this)
+      {
+        ETL_ASSERT(other.size() <= max_size(), ETL_ERROR(map_full));
+
+        initialise();
+
+        iterator from = other.begin();
+
+        while (from != other.end())
+        {
+          insert_node(root_node, allocate_data_node(std::move(*from)));
+          ++from;
+        }
+
+        other.initialise();
+      }
+    }
+#endif
+
   private:
 
     //*************************************************************************
     /// Allocate a Data_Node.
     //*************************************************************************
-    Data_Node& allocate_data_node(value_type value)
+    Data_Node& allocate_data_node(const value_type& value)
     {
       Data_Node& node = *p_node_pool->allocate<Data_Node>();
       ::new (&node.value) const value_type(value);
@@ -1265,6 +1379,75 @@ namespace etl
       return node;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Allocate a Data_Node, moving the value into it.
+    //*************************************************************************
+    Data_Node& allocate_data_node(value_type&& value)
+    {
+      Data_Node& node = *p_node_pool->allocate<Data_Node>();
+      ::new (&node.value) value_type(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+      return node;
+    }
+#endif
+
+    //*************************************************************************
+    /// Numbers the nodes of the subtree in key order, over their first word.
+    //*************************************************************************
+    void number_nodes(Node* p_node, size_t& index)
+    {
+      if (p_node != nullptr)
+      {
+        Node* p_right = p_node->children[kRight];
+
+        number_nodes(p_node->children[kLeft], index);
+        *reinterpret_cast<uintptr_t*>(p_node) = index++;
+        number_nodes(p_right, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Links the nodes at pool items [first, last) as a balanced subtree.
+    /// Returns the root of the subtree and sets 'height' to its height.
+    //*************************************************************************
+    Node* build_tree(size_t first, size_t last, size_t& height)
+    {
+      if (first == last)
+      {
+        height = 0;
+        return nullptr;
+      }
+
+      const size_t middle = first + ((last - first) / 2);
+
+      Node* p_node = static_cast<Data_Node*>(p_node_pool->item_address(middle));
+
+      size_t left_height;
+      size_t right_height;
+
+      p_node->children[kLeft]  = build_tree(first, middle, left_height);
+      p_node->children[kRight] = build_tree(middle + 1, last, right_height);
+      p_node->dir = uint_least8_t(kNeither);
+
+      if (left_height > right_height)
+      {
+        p_node->weight = uint_least8_t(kLeft);
+      }
+      else if (right_height > left_height)
+      {
+        p_node->weight = uint_least8_t(kRight);
+      }
+      else
+      {
+        p_node->weight = uint_least8_t(kNeither);
+      }
+
+      height = 1 + std::max(left_height, right_height);
+
+      return p_node;
+    }
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
@@ -2072,6 +2255,16 @@ namespace etl
     {
       this->assign(init.begin(), init.end());
     }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    map(map&& other)
+      : etl::imap<TKey, TValue, TCompare>(node_pool, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_container(std::move(other));
+    }
 #endif
 
     //*************************************************************************
@@ -2096,6 +2289,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    map& operator = (map&& rhs)
+    {
+      this->move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of data nodes used for the map.
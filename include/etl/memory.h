@@ -33,6 +33,8 @@ SOFTWARE.
 
 #include <iterator>
 #include <algorithm>
+#include <utility>
+#include <string.h>
 
 #include "platform.h"
 #include "type_traits.h"
@@ -171,6 +173,34 @@ namespace etl
     return o_end;
   }
 
+  //*****************************************************************************
+  /// Copies a range of objects to uninitialised memory.
+  /// Trivially copyable objects are copied as a single block.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   uninitialized_copy(const T* i_begin, const T* i_end, T* o_begin)
+  {
+    const size_t n = i_end - i_begin;
+
+    memcpy(static_cast<void*>(o_begin), static_cast<const void*>(i_begin), n * sizeof(T));
+
+    return o_begin + n;
+  }
+
+  //*****************************************************************************
+  /// Copies a range of objects to uninitialised memory.
+  /// Trivially copyable objects are copied as a single block.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   uninitialized_copy(T* i_begin, T* i_end, T* o_begin)
+  {
+    return etl::uninitialized_copy(static_cast<const T*>(i_begin), static_cast<const T*>(i_end), o_begin);
+  }
+
   //*****************************************************************************
   /// Copies a range of objects to uninitialised memory.
   /// Debug counter version.
@@ -180,7 +210,7 @@ namespace etl
   typename etl::enable_if<etl::is_trivially_constructible<typename std::iterator_traits<TOutputIterator>::value_type>::value, TOutputIterator>::type
    uninitialized_copy(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
   {
-    TOutputIterator o_end = std::copy(i_begin, i_end, o_begin);
+    TOutputIterator o_end = etl::uninitialized_copy(i_begin, i_end, o_begin);
     count += int32_t(std::distance(o_begin, o_end));
 
     return o_end;
@@ -225,6 +255,82 @@ namespace etl
     return etl::uninitialized_copy(i_begin, i_begin + n, o_begin);
   }
 
+  //*****************************************************************************
+  /// Moves a range of objects to uninitialised memory.
+  /// Copies them if rvalue references are not supported.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin)
+  {
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    typedef typename std::iterator_traits<TOutputIterator>::value_type value_type;
+
+    TOutputIterator o_end = o_begin;
+
+    while (i_begin != i_end)
+    {
+      ::new (static_cast<void*>(etl::addressof(*o_end))) value_type(std::move(*i_begin));
+      ++i_begin;
+      ++o_end;
+    }
+
+    return o_end;
+#else
+    return etl::uninitialized_copy(i_begin, i_end, o_begin);
+#endif
+  }
+
+  //*****************************************************************************
+  /// Moves a range of objects to uninitialised memory.
+  /// Trivially copyable objects are copied as a single block.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  typename etl::enable_if<etl::is_trivially_copyable<T>::value, T*>::type
+   uninitialized_move(T* i_begin, T* i_end, T* o_begin)
+  {
+    return etl::uninitialized_copy(static_cast<const T*>(i_begin), static_cast<const T*>(i_end), o_begin);
+  }
+
+  //*****************************************************************************
+  /// Moves a range of objects to uninitialised memory.
+  /// Debug counter version.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TCounter>
+  TOutputIterator uninitialized_move(TInputIterator i_begin, TInputIterator i_end, TOutputIterator o_begin, TCounter& count)
+  {
+    TOutputIterator o_end = etl::uninitialized_move(i_begin, i_end, o_begin);
+
+    count += int32_t(std::distance(o_begin, o_end));
+
+    return o_end;
+  }
+
+  //*****************************************************************************
+  /// Moves N objects to uninitialised memory.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TSize, typename TOutputIterator>
+  inline TOutputIterator uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin)
+  {
+    return etl::uninitialized_move(i_begin, i_begin + n, o_begin);
+  }
+
+  //*****************************************************************************
+  /// Moves N objects to uninitialised memory.
+  /// Debug counter version.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename TInputIterator, typename TSize, typename TOutputIterator, typename TCounter>
+  inline TOutputIterator uninitialized_move_n(TInputIterator i_begin, TSize n, TOutputIterator o_begin, TCounter& count)
+  {
+    count += n;
+
+    return etl::uninitialized_move(i_begin, i_begin + n, o_begin);
+  }
+
   //*****************************************************************************
   /// Default contruct an item at address p.
   ///\ingroup memory
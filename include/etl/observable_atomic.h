@@ -0,0 +1,364 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_OBSERVABLE_ATOMIC_INCLUDED
+#define ETL_OBSERVABLE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "observer.h"
+#include "error_handler.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //*********************************************************************
+  /// An observable that may be notified from several threads while
+  /// observers are added and removed from others.
+  ///
+  /// Notifications iterate an immutable snapshot of the observer list,
+  /// without locking. A change to the list writes a new snapshot and
+  /// publishes it with one atomic store. A snapshot is only rewritten when
+  /// no notification is reading it.
+  ///
+  /// Changes to the list are serialised by a spin lock. remove_observer()
+  /// waits until the notifications that may still be using the observer
+  /// have finished, so the observer may be destroyed when it returns.
+  /// \warning Do not remove an observer from within a notification sent by
+  /// the same observable, as it would wait for itself.
+  ///\tparam TObserver     The observer type.
+  ///\tparam MAX_OBSERVERS The maximum number of observers that can be accomodated.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename TObserver, const size_t MAX_OBSERVERS>
+  class observable_atomic
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    observable_atomic()
+    {
+      for (size_t i = 0; i < SNAPSHOTS; ++i)
+      {
+        snapshots[i].size = 0;
+        snapshots[i].readers.store(0);
+      }
+
+      current.store(0);
+      writer_lock.store(0);
+    }
+
+    //*****************************************************************
+    /// Add an observer to the list.
+    /// If asserts or exceptions are enabled then an etl::observer_list_full
+    /// is emitted if the observer list is already full.
+    ///\param observer A reference to the observer.
+    //*****************************************************************
+    void add_observer(TObserver& observer)
+    {
+      lock();
+
+      const snapshot& from = snapshots[current.load()];
+
+      if (find(from, &observer) == from.size)
+      {
+        if (from.size == MAX_OBSERVERS)
+        {
+          unlock();
+          ETL_ASSERT(false, ETL_ERROR(etl::observer_list_full));
+          return;
+        }
+
+        const uint32_t index = get_free_snapshot();
+        snapshot& to = snapshots[index];
+
+        copy(from, to);
+        to.observers[to.size++] = &observer;
+
+        current.store(index);
+      }
+
+      unlock();
+    }
+
+    //*****************************************************************
+    /// Remove a particular observer from the list.
+    /// Returns when no notification can still be sending to it.
+    ///\param observer A reference to the observer.
+    //*****************************************************************
+    void remove_observer(TObserver& observer)
+    {
+      lock();
+
+      const snapshot& from  = snapshots[current.load()];
+      const size_t position = find(from, &observer);
+
+      if (position != from.size)
+      {
+        const uint32_t index = get_free_snapshot();
+        snapshot& to = snapshots[index];
+
+        copy(from, to);
+
+        // Keep the order of the others.
+        for (size_t i = position + 1; i < to.size; ++i)
+        {
+          to.observers[i - 1] = to.observers[i];
+        }
+
+        --to.size;
+
+        current.store(index);
+
+        wait_for_readers();
+      }
+
+      unlock();
+    }
+
+    //*****************************************************************
+    /// Clear all observers from the list.
+    /// Returns when no notification can still be sending to them.
+    //*****************************************************************
+    void clear_observers()
+    {
+      lock();
+
+      const uint32_t index = get_free_snapshot();
+
+      snapshots[index].size = 0;
+      current.store(index);
+
+      wait_for_readers();
+
+      unlock();
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    size_type number_of_observers()
+    {
+      read_guard guard(*this);
+
+      return snapshots[guard.index].size;
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them the notification.
+    /// The observers are those in the list when the notification started.
+    ///\tparam TNotification the notification type.
+    ///\param n The notification.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(TNotification n)
+    {
+      read_guard guard(*this);
+
+      const snapshot& list = snapshots[guard.index];
+
+      for (size_t i = 0; i < list.size; ++i)
+      {
+        list.observers[i]->notification(n);
+      }
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them each of the notifications
+    /// in the range. Each observer is sent all of the notifications before
+    /// the next observer.
+    //*****************************************************************
+    template <typename TIterator>
+    void notify_observers(TIterator first, TIterator last)
+    {
+      read_guard guard(*this);
+
+      const snapshot& list = snapshots[guard.index];
+
+      for (size_t i = 0; i < list.size; ++i)
+      {
+        TObserver* p_observer = list.observers[i];
+
+        for (TIterator itr = first; itr != last; ++itr)
+        {
+          p_observer->notification(*itr);
+        }
+      }
+    }
+
+  private:
+
+    // One snapshot is current, one may be read by notifications that
+    // started before the last change, and one is free to be written.
+    static const uint32_t SNAPSHOTS = 3;
+
+    //*****************************************************************
+    struct snapshot
+    {
+      TObserver*           observers[MAX_OBSERVERS];
+      size_t               size;
+      etl::atomic_uint32_t readers; ///< The number of notifications reading this snapshot.
+    };
+
+    //*****************************************************************
+    /// Marks the current snapshot as being read, for its lifetime.
+    //*****************************************************************
+    class read_guard
+    {
+    public:
+
+      read_guard(observable_atomic& observable_)
+        : observable(observable_)
+      {
+        for (;;)
+        {
+          index = observable.current.load();
+          observable.snapshots[index].readers.fetch_add(1);
+
+          // Still current? If not, a writer may be about to reuse it.
+          if (observable.current.load() == index)
+          {
+            break;
+          }
+
+          observable.snapshots[index].readers.fetch_sub(1);
+        }
+      }
+
+      ~read_guard()
+      {
+        observable.snapshots[index].readers.fetch_sub(1);
+      }
+
+      uint32_t index;
+
+    private:
+
+      observable_atomic& observable;
+    };
+
+    //*****************************************************************
+    void lock()
+    {
+      while (writer_lock.exchange(1) != 0)
+      {
+      }
+    }
+
+    //*****************************************************************
+    void unlock()
+    {
+      writer_lock.store(0);
+    }
+
+    //*****************************************************************
+    /// Finds a snapshot, other than the current one, that is not being read.
+    //*****************************************************************
+    uint32_t get_free_snapshot()
+    {
+      const uint32_t current_index = current.load();
+
+      for (;;)
+      {
+        for (uint32_t i = 0; i < SNAPSHOTS; ++i)
+        {
+          if ((i != current_index) && (snapshots[i].readers.load() == 0))
+          {
+            return i;
+          }
+        }
+      }
+    }
+
+    //*****************************************************************
+    /// The grace period.
+    /// Waits until no notification is reading a snapshot older than the
+    /// current one.
+    //*****************************************************************
+    void wait_for_readers()
+    {
+      const uint32_t current_index = current.load();
+
+      for (uint32_t i = 0; i < SNAPSHOTS; ++i)
+      {
+        if (i != current_index)
+        {
+          while (snapshots[i].readers.load() != 0)
+          {
+          }
+        }
+      }
+    }
+
+    //*****************************************************************
+    static size_t find(const snapshot& list, const TObserver* p_observer)
+    {
+      size_t i = 0;
+
+      while ((i < list.size) && (list.observers[i] != p_observer))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*****************************************************************
+    static void copy(const snapshot& from, snapshot& to)
+    {
+      for (size_t i = 0; i < from.size; ++i)
+      {
+        to.observers[i] = from.observers[i];
+      }
+
+      to.size = from.size;
+    }
+
+    // Disabled.
+    observable_atomic(const observable_atomic&);
+    observable_atomic& operator =(const observable_atomic&);
+
+    snapshot             snapshots[SNAPSHOTS];
+    etl::atomic_uint32_t current;     ///< The index of the current snapshot.
+    etl::atomic_uint32_t writer_lock; ///< Serialises changes to the list.
+  };
+}
+
+#endif
+
+#endif
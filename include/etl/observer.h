@@ -48,6 +48,10 @@ SOFTWARE.
 /// The class derived from this will be observed by the above class.
 /// It keeps a list of registered observers and will notify all
 /// of them with the notifications.
+///
+/// \li <b>static_observable</b><br>
+/// For C++11. The observers are fixed when it is constructed, and are held
+/// as their own types, so notifications are not virtual calls and may be inlined.
 ///\ingroup patterns
 //*****************************************************************************
 
@@ -179,6 +183,27 @@ namespace etl
       }
     }
 
+    //*****************************************************************
+    /// Notify all of the observers, sending them each of the notifications
+    /// in the range. Each observer is sent all of the notifications before
+    /// the next observer, which keeps its code in the cache.
+    ///\param first The first notification.
+    ///\param last  One past the last notification.
+    //*****************************************************************
+    template <typename TIterator>
+    void notify_observers(TIterator first, TIterator last)
+    {
+      for (size_t i = 0; i < observer_list.size(); ++i)
+      {
+        TObserver* p_observer = observer_list[i];
+
+        for (TIterator itr = first; itr != last; ++itr)
+        {
+          p_observer->notification(*itr);
+        }
+      }
+    }
+
   private:
 
     /// The list of observers.
@@ -343,6 +368,130 @@ namespace etl
     virtual ~observer() {}
     virtual void notification(T1) = 0;
   };
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  namespace private_observer
+  {
+    //*******************************************************************
+    /// Holds a reference to each observer.
+    //*******************************************************************
+    template <typename... TObservers>
+    class observer_list;
+
+    template <>
+    class observer_list<>
+    {
+    public:
+
+      template <typename TNotification>
+      void notify(TNotification&)
+      {
+      }
+
+      template <typename TIterator>
+      void notify(TIterator, TIterator)
+      {
+      }
+    };
+
+    template <typename TObserver, typename... TRest>
+    class observer_list<TObserver, TRest...>
+    {
+    public:
+
+      observer_list(TObserver& observer_, TRest&... rest_)
+        : observer(observer_),
+          rest(rest_...)
+      {
+      }
+
+      template <typename TNotification>
+      void notify(TNotification& n)
+      {
+        observer.notification(n);
+        rest.notify(n);
+      }
+
+      template <typename TIterator>
+      void notify(TIterator first, TIterator last)
+      {
+        for (TIterator itr = first; itr != last; ++itr)
+        {
+          observer.notification(*itr);
+        }
+
+        rest.notify(first, last);
+      }
+
+    private:
+
+      TObserver&               observer;
+      observer_list<TRest...>  rest;
+    };
+  }
+
+  //*********************************************************************
+  /// An observable with a set of observers that is fixed when it is constructed.
+  /// The observers are held as their own types, and need not derive from
+  /// etl::observer. If they do, they should be declared 'final' so that
+  /// the calls are not virtual.
+  ///\code
+  /// etl::static_observable<Display, Logger> sensor(display, logger);
+  /// sensor.notify_observers(reading);
+  ///\endcode
+  ///\tparam TObservers The observer types, in the order that they are notified.
+  ///\ingroup observer
+  //*********************************************************************
+  template <typename... TObservers>
+  class static_observable
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*****************************************************************
+    /// Constructor.
+    //*****************************************************************
+    explicit static_observable(TObservers&... observers)
+      : observer_list(observers...)
+    {
+    }
+
+    //*****************************************************************
+    /// Returns the number of observers.
+    //*****************************************************************
+    ETL_CONSTEXPR size_type number_of_observers() const
+    {
+      return sizeof...(TObservers);
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them the notification.
+    ///\tparam TNotification the notification type.
+    ///\param n The notification.
+    //*****************************************************************
+    template <typename TNotification>
+    void notify_observers(TNotification n)
+    {
+      observer_list.notify(n);
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers, sending them each of the notifications
+    /// in the range. Each observer is sent all of the notifications before
+    /// the next observer.
+    //*****************************************************************
+    template <typename TIterator>
+    void notify_observers(TIterator first, TIterator last)
+    {
+      observer_list.notify(first, last);
+    }
+
+  private:
+
+    private_observer::observer_list<TObservers...> observer_list;
+  };
+#endif
 }
 
 #undef ETL_FILE
@@ -0,0 +1,1001 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_ALGORITHM_INCLUDED
+#define ETL_PARALLEL_ALGORITHM_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "function.h"
+#include "vector.h"
+#include "static_assert.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STD_THREAD)
+  #include <thread>
+  #include <mutex>
+  #include <condition_variable>
+  #include <atomic>
+  #define ETL_HAS_WORKER_POOL 1
+#else
+  #define ETL_HAS_WORKER_POOL 0
+#endif
+
+//*****************************************************************************
+///\defgroup parallel_algorithm parallel_algorithm
+/// Algorithms that split random access ranges into tasks, and run them on a
+/// worker pool. The pool is passed in place of an execution policy.
+/// No heap is used once the pool has been created.
+///\ingroup algorithm
+//*****************************************************************************
+
+#if !defined(ETL_PARALLEL_MAX_TASKS)
+  /// The most tasks that an algorithm splits a range into.
+  /// Bounds the stack used for partial results.
+  #define ETL_PARALLEL_MAX_TASKS 64
+#endif
+
+#if !defined(ETL_PARALLEL_MIN_CHUNK)
+  /// Ranges are not split into chunks smaller than this.
+  #define ETL_PARALLEL_MIN_CHUNK 4096
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for worker pools.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  class iworker_pool
+  {
+  public:
+
+    virtual ~iworker_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// The number of threads that run tasks, including the caller of run().
+    //*************************************************************************
+    virtual size_t size() const = 0;
+
+    //*************************************************************************
+    /// Calls task(i) for every i in [0, count), spread over the threads.
+    /// Returns when all of the calls have returned.
+    /// Tasks must not call run() on the same pool, and must not throw.
+    //*************************************************************************
+    virtual void run(etl::ifunction<size_t>& task, size_t count) = 0;
+  };
+
+  //***************************************************************************
+  /// A worker pool that runs every task on the calling thread.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  class serial_worker_pool : public etl::iworker_pool
+  {
+  public:
+
+    size_t size() const
+    {
+      return 1U;
+    }
+
+    void run(etl::ifunction<size_t>& task, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        task(i);
+      }
+    }
+  };
+
+#if ETL_HAS_WORKER_POOL
+  //***************************************************************************
+  /// A fixed size pool of std::thread workers.
+  /// The threads are started by the constructor and stopped by the
+  /// destructor. run() does not allocate.
+  /// Tasks are handed out one index at a time, so uneven tasks balance.
+  ///\tparam N_THREADS The number of threads that run tasks, including the caller of run().
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <const size_t N_THREADS>
+  class worker_pool : public etl::iworker_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_THREADS > 0U, "A worker pool needs at least one thread");
+
+    //*************************************************************************
+    /// Starts the workers.
+    //*************************************************************************
+    worker_pool()
+      : p_task(nullptr),
+        task_count(0U),
+        next_index(0U),
+        active(0U),
+        generation(0U),
+        stopping(false)
+    {
+      for (size_t i = 0U; i < (N_THREADS - 1U); ++i)
+      {
+        threads[i] = std::thread(&worker_pool::worker, this);
+      }
+    }
+
+    //*************************************************************************
+    /// Stops the workers.
+    //*************************************************************************
+    ~worker_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(access);
+        stopping = true;
+      }
+
+      wake.notify_all();
+
+      for (size_t i = 0U; i < (N_THREADS - 1U); ++i)
+      {
+        threads[i].join();
+      }
+    }
+
+    //*************************************************************************
+    size_t size() const
+    {
+      return N_THREADS;
+    }
+
+    //*************************************************************************
+    void run(etl::ifunction<size_t>& task, size_t count)
+    {
+      std::lock_guard<std::mutex> run_lock(run_access);
+
+      if ((N_THREADS == 1U) || (count <= 1U))
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          task(i);
+        }
+
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(access);
+        p_task     = &task;
+        task_count = count;
+        next_index.store(0U, std::memory_order_relaxed);
+        active     = N_THREADS - 1U;
+        ++generation;
+      }
+
+      wake.notify_all();
+
+      execute();
+
+      std::unique_lock<std::mutex> lock(access);
+      done.wait(lock, [this]() { return active == 0U; });
+      p_task = nullptr;
+    }
+
+  private:
+
+    worker_pool(const worker_pool&) = delete;
+    worker_pool& operator =(const worker_pool&) = delete;
+
+    //*************************************************************************
+    /// Runs tasks until there are none left.
+    //*************************************************************************
+    void execute()
+    {
+      size_t index;
+
+      while ((index = next_index.fetch_add(1U, std::memory_order_relaxed)) < task_count)
+      {
+        (*p_task)(index);
+      }
+    }
+
+    //*************************************************************************
+    /// The worker thread.
+    //*************************************************************************
+    void worker()
+    {
+      size_t seen = 0U;
+
+      for (;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(access);
+          wake.wait(lock, [this, seen]() { return stopping || (generation != seen); });
+
+          if (stopping)
+          {
+            return;
+          }
+
+          seen = generation;
+        }
+
+        execute();
+
+        {
+          std::lock_guard<std::mutex> lock(access);
+
+          if (--active == 0U)
+          {
+            done.notify_one();
+          }
+        }
+      }
+    }
+
+    std::thread               threads[(N_THREADS > 1U) ? N_THREADS - 1U : 1U];
+    std::mutex                run_access; ///< Serialises calls to run().
+    std::mutex                access;
+    std::condition_variable   wake;
+    std::condition_variable   done;
+    etl::ifunction<size_t>*   p_task;
+    size_t                    task_count;
+    std::atomic<size_t>       next_index;
+    size_t                    active;     ///< Workers still running tasks.
+    size_t                    generation; ///< Incremented for each run().
+    bool                      stopping;
+  };
+#endif
+
+  namespace private_parallel
+  {
+    enum
+    {
+      TASKS_PER_THREAD = 4 ///< More tasks than threads, so that uneven tasks balance.
+    };
+
+    //*************************************************************************
+    template <typename T>
+    struct identity
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The number of tasks to split 'length' elements into.
+    //*************************************************************************
+    inline size_t task_count(const etl::iworker_pool& pool, size_t length, size_t tasks_per_thread)
+    {
+      size_t tasks = pool.size() * tasks_per_thread;
+
+      if (tasks > (length / ETL_PARALLEL_MIN_CHUNK))
+      {
+        tasks = length / ETL_PARALLEL_MIN_CHUNK;
+      }
+
+      if (tasks > ETL_PARALLEL_MAX_TASKS)
+      {
+        tasks = ETL_PARALLEL_MAX_TASKS;
+      }
+
+      return (tasks == 0U) ? 1U : tasks;
+    }
+
+    //*************************************************************************
+    /// The start of chunk 'index' of 'tasks' equal chunks of 'length'.
+    //*************************************************************************
+    inline size_t chunk_begin(size_t length, size_t tasks, size_t index)
+    {
+      const size_t size      = length / tasks;
+      const size_t remainder = length % tasks;
+
+      return (size * index) + ((index < remainder) ? index : remainder);
+    }
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    class for_each_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      for_each_task(TIterator first_, size_t length_, size_t tasks_, TFunction function_)
+        : first(first_),
+          length(length_),
+          tasks(tasks_),
+          function(function_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        std::for_each(first + chunk_begin(length, tasks, index),
+                      first + chunk_begin(length, tasks, index + 1U),
+                      function);
+      }
+
+    private:
+
+      TIterator first;
+      size_t    length;
+      size_t    tasks;
+      TFunction function;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator, typename TUnaryOperation>
+    class transform_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      transform_task(TInputIterator first_, TOutputIterator d_first_, size_t length_, size_t tasks_, TUnaryOperation operation_)
+        : first(first_),
+          d_first(d_first_),
+          length(length_),
+          tasks(tasks_),
+          operation(operation_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        const size_t begin = chunk_begin(length, tasks, index);
+        const size_t end   = chunk_begin(length, tasks, index + 1U);
+
+        std::transform(first + begin, first + end, d_first + begin, operation);
+      }
+
+    private:
+
+      TInputIterator  first;
+      TOutputIterator d_first;
+      size_t          length;
+      size_t          tasks;
+      TUnaryOperation operation;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryOperation>
+    class transform2_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      transform2_task(TInputIterator1 first1_, TInputIterator2 first2_, TOutputIterator d_first_, size_t length_, size_t tasks_, TBinaryOperation operation_)
+        : first1(first1_),
+          first2(first2_),
+          d_first(d_first_),
+          length(length_),
+          tasks(tasks_),
+          operation(operation_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        const size_t begin = chunk_begin(length, tasks, index);
+        const size_t end   = chunk_begin(length, tasks, index + 1U);
+
+        std::transform(first1 + begin, first1 + end, first2 + begin, d_first + begin, operation);
+      }
+
+    private:
+
+      TInputIterator1  first1;
+      TInputIterator2  first2;
+      TOutputIterator  d_first;
+      size_t           length;
+      size_t           tasks;
+      TBinaryOperation operation;
+    };
+
+    //*************************************************************************
+    /// Reduces each chunk to one value. Chunks are never empty.
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TBinaryOperation>
+    class reduce_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      reduce_task(TIterator first_, size_t length_, size_t tasks_, T* partials_, TBinaryOperation operation_)
+        : first(first_),
+          length(length_),
+          tasks(tasks_),
+          partials(partials_),
+          operation(operation_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        const TIterator begin = first + chunk_begin(length, tasks, index);
+        const TIterator end   = first + chunk_begin(length, tasks, index + 1U);
+
+        partials[index] = std::accumulate(begin + 1, end, T(*begin), operation);
+      }
+
+    private:
+
+      TIterator        first;
+      size_t           length;
+      size_t           tasks;
+      T*               partials;
+      TBinaryOperation operation;
+    };
+
+    //*************************************************************************
+    /// Sorts each chunk.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    class sort_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      sort_task(TIterator first_, size_t length_, size_t tasks_, TCompare compare_)
+        : first(first_),
+          length(length_),
+          tasks(tasks_),
+          compare(compare_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        etl::sort(first + chunk_begin(length, tasks, index),
+                  first + chunk_begin(length, tasks, index + 1U),
+                  compare);
+      }
+
+    private:
+
+      TIterator first;
+      size_t    length;
+      size_t    tasks;
+      TCompare  compare;
+    };
+
+    //*************************************************************************
+    /// Merges pairs of sorted runs of 'width' chunks in place.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    class merge_in_place_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      merge_in_place_task(TIterator first_, size_t length_, size_t tasks_, size_t width_, TCompare compare_)
+        : first(first_),
+          length(length_),
+          tasks(tasks_),
+          width(width_),
+          compare(compare_)
+      {
+      }
+
+      void operator ()(size_t pair)
+      {
+        const size_t left  = 2U * pair * width;
+        const size_t right = left + width;
+        const size_t end   = ((right + width) < tasks) ? right + width : tasks;
+
+        const size_t begin_offset  = chunk_begin(length, tasks, left);
+        const size_t middle_offset = chunk_begin(length, tasks, right);
+        const size_t end_offset    = chunk_begin(length, tasks, end);
+
+        etl::private_algorithm::merge_in_place(first + begin_offset,
+                                               first + middle_offset,
+                                               first + end_offset,
+                                               middle_offset - begin_offset,
+                                               end_offset - middle_offset,
+                                               compare);
+      }
+
+    private:
+
+      TIterator first;
+      size_t    length;
+      size_t    tasks;
+      size_t    width;
+      TCompare  compare;
+    };
+
+    //*************************************************************************
+    /// The number of elements taken from 'left' in the first 'k' of a stable
+    /// merge of 'left' and 'right'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    size_t co_rank(TIterator left, size_t left_length, TIterator right, size_t right_length, size_t k, TCompare compare)
+    {
+      size_t low  = (k > right_length) ? k - right_length : 0U;
+      size_t high = (k < left_length)  ? k : left_length;
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        // Take more from the left while its next element is not greater.
+        if (!compare(*(right + (k - middle - 1U)), *(left + middle)))
+        {
+          low = middle + 1U;
+        }
+        else
+        {
+          high = middle;
+        }
+      }
+
+      return low;
+    }
+
+    //*************************************************************************
+    /// Merges pairs of sorted runs of 'width' chunks from 'source' to
+    /// 'destination'. Each merge is split into 'splits' equal parts of the
+    /// output, so that the last rounds still use every thread.
+    //*************************************************************************
+    template <typename TSource, typename TDestination, typename TCompare>
+    class merge_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      merge_task(TSource source_, TDestination destination_, size_t length_, size_t tasks_, size_t width_, size_t splits_, TCompare compare_)
+        : source(source_),
+          destination(destination_),
+          length(length_),
+          tasks(tasks_),
+          width(width_),
+          splits(splits_),
+          compare(compare_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        const size_t pair  = index / splits;
+        const size_t split = index % splits;
+
+        const size_t left  = 2U * pair * width;
+        const size_t right = ((left + width) < tasks) ? left + width : tasks;
+        const size_t end   = ((right + width) < tasks) ? right + width : tasks;
+
+        const size_t begin_offset  = chunk_begin(length, tasks, left);
+        const size_t middle_offset = chunk_begin(length, tasks, right);
+        const size_t end_offset    = chunk_begin(length, tasks, end);
+
+        const TSource left_first   = source + begin_offset;
+        const TSource right_first  = source + middle_offset;
+        const size_t  left_length  = middle_offset - begin_offset;
+        const size_t  right_length = end_offset - middle_offset;
+        const size_t  total        = left_length + right_length;
+
+        // This part of the output.
+        const size_t k_begin = chunk_begin(total, splits, split);
+        const size_t k_end   = chunk_begin(total, splits, split + 1U);
+
+        const size_t i_begin = co_rank(left_first, left_length, right_first, right_length, k_begin, compare);
+        const size_t i_end   = co_rank(left_first, left_length, right_first, right_length, k_end,   compare);
+
+        std::merge(left_first  + i_begin,             left_first  + i_end,
+                   right_first + (k_begin - i_begin), right_first + (k_end - i_end),
+                   destination + (begin_offset + k_begin),
+                   compare);
+      }
+
+    private:
+
+      TSource      source;
+      TDestination destination;
+      size_t       length;
+      size_t       tasks;
+      size_t       width;
+      size_t       splits;
+      TCompare     compare;
+    };
+
+    //*************************************************************************
+    /// Partitions each chunk, and records the number of elements that
+    /// satisfy the predicate.
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    class partition_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      partition_task(TIterator first_, size_t length_, size_t tasks_, size_t* counts_, TPredicate predicate_)
+        : first(first_),
+          length(length_),
+          tasks(tasks_),
+          counts(counts_),
+          predicate(predicate_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        const TIterator begin = first + chunk_begin(length, tasks, index);
+        const TIterator end   = first + chunk_begin(length, tasks, index + 1U);
+
+        counts[index] = size_t(std::partition(begin, end, predicate) - begin);
+      }
+
+    private:
+
+      TIterator  first;
+      size_t     length;
+      size_t     tasks;
+      size_t*    counts;
+      TPredicate predicate;
+    };
+
+    //*************************************************************************
+    /// A list of up to ETL_PARALLEL_MAX_TASKS ranges, indexed as one sequence.
+    //*************************************************************************
+    struct range_list
+    {
+      range_list()
+        : count(0U),
+          total(0U)
+      {
+      }
+
+      void add(size_t begin, size_t end)
+      {
+        if (begin < end)
+        {
+          begins[count] = begin;
+          starts[count] = total;
+          total += end - begin;
+          ++count;
+        }
+      }
+
+      /// The offset of element 'n' of the sequence, and the range it is in.
+      size_t find(size_t n, size_t& range) const
+      {
+        range = 0U;
+
+        while (((range + 1U) < count) && (starts[range + 1U] <= n))
+        {
+          ++range;
+        }
+
+        return begins[range] + (n - starts[range]);
+      }
+
+      /// The index in the sequence of the end of 'range'.
+      size_t end_of(size_t range) const
+      {
+        return ((range + 1U) < count) ? starts[range + 1U] : total;
+      }
+
+      size_t begins[ETL_PARALLEL_MAX_TASKS];
+      size_t starts[ETL_PARALLEL_MAX_TASKS];
+      size_t count;
+      size_t total;
+    };
+
+    //*************************************************************************
+    /// Swaps the misplaced elements of the partitioned chunks.
+    /// Misplaced element n of one list is swapped with element n of the other.
+    //*************************************************************************
+    template <typename TIterator>
+    class swap_task : public etl::ifunction<size_t>
+    {
+    public:
+
+      swap_task(TIterator first_, const range_list& falses_, const range_list& trues_, size_t tasks_)
+        : first(first_),
+          falses(falses_),
+          trues(trues_),
+          tasks(tasks_)
+      {
+      }
+
+      void operator ()(size_t index)
+      {
+        size_t n         = chunk_begin(falses.total, tasks, index);
+        const size_t end = chunk_begin(falses.total, tasks, index + 1U);
+
+        while (n < end)
+        {
+          size_t false_range;
+          size_t true_range;
+
+          const size_t false_offset = falses.find(n, false_range);
+          const size_t true_offset  = trues.find(n, true_range);
+
+          // Swap up to the end of whichever range ends first.
+          const size_t false_run = falses.end_of(false_range) - n;
+          const size_t true_run  = trues.end_of(true_range) - n;
+
+          size_t run = (false_run < true_run) ? false_run : true_run;
+
+          if (run > (end - n))
+          {
+            run = end - n;
+          }
+
+          std::swap_ranges(first + false_offset, first + (false_offset + run), first + true_offset);
+
+          n += run;
+        }
+      }
+
+    private:
+
+      swap_task& operator =(const swap_task&);
+
+      TIterator         first;
+      const range_list& falses;
+      const range_list& trues;
+      size_t            tasks;
+    };
+  }
+
+  //***************************************************************************
+  /// Calls 'function' for each element, on the pool.
+  /// Each task has its own copy of the function.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void parallel_for_each(etl::iworker_pool& pool, TIterator first, TIterator last, TFunction function)
+  {
+    const size_t length = size_t(std::distance(first, last));
+    const size_t tasks  = etl::private_parallel::task_count(pool, length, etl::private_parallel::TASKS_PER_THREAD);
+
+    etl::private_parallel::for_each_task<TIterator, TFunction> task(first, length, tasks, function);
+
+    pool.run(task, tasks);
+  }
+
+  //***************************************************************************
+  /// Transforms [first, last) to d_first, on the pool.
+  ///\return The end of the output.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TUnaryOperation>
+  TOutputIterator parallel_transform(etl::iworker_pool& pool, TInputIterator first, TInputIterator last, TOutputIterator d_first, TUnaryOperation operation)
+  {
+    const size_t length = size_t(std::distance(first, last));
+    const size_t tasks  = etl::private_parallel::task_count(pool, length, etl::private_parallel::TASKS_PER_THREAD);
+
+    etl::private_parallel::transform_task<TInputIterator, TOutputIterator, TUnaryOperation> task(first, d_first, length, tasks, operation);
+
+    pool.run(task, tasks);
+
+    return d_first + length;
+  }
+
+  //***************************************************************************
+  /// Transforms [first1, last1) and [first2, ...) to d_first, on the pool.
+  ///\return The end of the output.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TBinaryOperation>
+  TOutputIterator parallel_transform(etl::iworker_pool& pool, TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TOutputIterator d_first, TBinaryOperation operation)
+  {
+    const size_t length = size_t(std::distance(first1, last1));
+    const size_t tasks  = etl::private_parallel::task_count(pool, length, etl::private_parallel::TASKS_PER_THREAD);
+
+    etl::private_parallel::transform2_task<TInputIterator1, TInputIterator2, TOutputIterator, TBinaryOperation> task(first1, first2, d_first, length, tasks, operation);
+
+    pool.run(task, tasks);
+
+    return d_first + length;
+  }
+
+  //***************************************************************************
+  /// Reduces the range with 'operation', starting with 'init', on the pool.
+  /// The operation must be associative. Chunks are combined in order, so it
+  /// need not be commutative.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TBinaryOperation>
+  T parallel_reduce(etl::iworker_pool& pool, TIterator first, TIterator last, T init, TBinaryOperation operation)
+  {
+    const size_t length = size_t(std::distance(first, last));
+
+    if (length == 0U)
+    {
+      return init;
+    }
+
+    const size_t tasks = etl::private_parallel::task_count(pool, length, etl::private_parallel::TASKS_PER_THREAD);
+
+    etl::vector<T, ETL_PARALLEL_MAX_TASKS> partials(tasks, init);
+
+    etl::private_parallel::reduce_task<TIterator, T, TBinaryOperation> task(first, length, tasks, partials.data(), operation);
+
+    pool.run(task, tasks);
+
+    return std::accumulate(partials.begin(), partials.end(), init, operation);
+  }
+
+  //***************************************************************************
+  /// Sums the range, starting with 'init', on the pool.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T parallel_reduce(etl::iworker_pool& pool, TIterator first, TIterator last, T init)
+  {
+    return etl::parallel_reduce(pool, first, last, init, std::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Sorts the range on the pool, with no extra buffer.
+  /// Each thread sorts a chunk with etl::sort, then the chunks are merged in
+  /// place in pairs. The merges are slower than with a buffer, and the last
+  /// runs on one thread.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void parallel_sort(etl::iworker_pool& pool, TIterator first, TIterator last, TCompare compare)
+  {
+    const size_t length = size_t(std::distance(first, last));
+    const size_t tasks  = etl::private_parallel::task_count(pool, length, 1U);
+
+    etl::private_parallel::sort_task<TIterator, TCompare> sort(first, length, tasks, compare);
+    pool.run(sort, tasks);
+
+    for (size_t width = 1U; width < tasks; width *= 2U)
+    {
+      etl::private_parallel::merge_in_place_task<TIterator, TCompare> merge(first, length, tasks, width, compare);
+      pool.run(merge, (tasks - width + (2U * width) - 1U) / (2U * width));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the range on the pool, with no extra buffer.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void parallel_sort(etl::iworker_pool& pool, TIterator first, TIterator last)
+  {
+    etl::parallel_sort(pool, first, last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the range on the pool, using a scratch buffer.
+  /// Each thread sorts a chunk with etl::sort, then the chunks are merged in
+  /// pairs between the range and the buffer. Every merge is split across the
+  /// threads, so all of the passes run in parallel.
+  ///\param scratch_first The start of a buffer of at least (last - first) elements.
+  ///\param scratch_last  The end of the buffer.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TScratch, typename TCompare>
+  void parallel_sort(etl::iworker_pool& pool, TIterator first, TIterator last, TScratch scratch_first, TScratch scratch_last, TCompare compare)
+  {
+    const size_t length = size_t(std::distance(first, last));
+
+    if (size_t(std::distance(scratch_first, scratch_last)) < length)
+    {
+      etl::parallel_sort(pool, first, last, compare);
+      return;
+    }
+
+    const size_t tasks = etl::private_parallel::task_count(pool, length, 1U);
+
+    etl::private_parallel::sort_task<TIterator, TCompare> sort(first, length, tasks, compare);
+    pool.run(sort, tasks);
+
+    bool in_scratch = false;
+
+    for (size_t width = 1U; width < tasks; width *= 2U)
+    {
+      // Pairs, including a last run with nothing to merge with, which is copied.
+      const size_t pairs  = (tasks + (2U * width) - 1U) / (2U * width);
+      const size_t splits = (pool.size() + pairs - 1U) / pairs;
+
+      if (in_scratch)
+      {
+        etl::private_parallel::merge_task<TScratch, TIterator, TCompare> merge(scratch_first, first, length, tasks, width, splits, compare);
+        pool.run(merge, pairs * splits);
+      }
+      else
+      {
+        etl::private_parallel::merge_task<TIterator, TScratch, TCompare> merge(first, scratch_first, length, tasks, width, splits, compare);
+        pool.run(merge, pairs * splits);
+      }
+
+      in_scratch = !in_scratch;
+    }
+
+    if (in_scratch)
+    {
+      etl::parallel_transform(pool, scratch_first, scratch_first + length, first, etl::private_parallel::identity<typename std::iterator_traits<TIterator>::value_type>());
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the range on the pool, using a scratch buffer.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TScratch>
+  void parallel_sort(etl::iworker_pool& pool, TIterator first, TIterator last, TScratch scratch_first, TScratch scratch_last)
+  {
+    etl::parallel_sort(pool, first, last, scratch_first, scratch_last, std::less<typename std::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Partitions the range on the pool, so that the elements that satisfy the
+  /// predicate come first. Not stable.
+  /// Each thread partitions a chunk, then the elements on the wrong side of
+  /// the final split point are swapped across in parallel.
+  ///\return The first element that does not satisfy the predicate.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TPredicate>
+  TIterator parallel_partition(etl::iworker_pool& pool, TIterator first, TIterator last, TPredicate predicate)
+  {
+    const size_t length = size_t(std::distance(first, last));
+    const size_t tasks  = etl::private_parallel::task_count(pool, length, 1U);
+
+    size_t counts[ETL_PARALLEL_MAX_TASKS];
+
+    etl::private_parallel::partition_task<TIterator, TPredicate> partition(first, length, tasks, counts, predicate);
+    pool.run(partition, tasks);
+
+    size_t split = 0U;
+
+    for (size_t i = 0U; i < tasks; ++i)
+    {
+      split += counts[i];
+    }
+
+    // The false elements before the split, and the true elements after it.
+    etl::private_parallel::range_list falses;
+    etl::private_parallel::range_list trues;
+
+    for (size_t i = 0U; i < tasks; ++i)
+    {
+      const size_t begin  = etl::private_parallel::chunk_begin(length, tasks, i);
+      const size_t end    = etl::private_parallel::chunk_begin(length, tasks, i + 1U);
+      const size_t middle = begin + counts[i];
+
+      falses.add(middle, (end < split) ? end : split);
+      trues.add((begin > split) ? begin : split, middle);
+    }
+
+    if (falses.total != 0U)
+    {
+      const size_t swap_tasks = etl::private_parallel::task_count(pool, falses.total, 1U);
+
+      etl::private_parallel::swap_task<TIterator> swap(first, falses, trues, swap_tasks);
+      pool.run(swap, swap_tasks);
+    }
+
+    return first + split;
+  }
+}
+
+#endif
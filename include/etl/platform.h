@@ -52,6 +52,8 @@ SOFTWARE.
 #undef ETL_NO_LARGE_CHAR_SUPPORT
 #undef ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
 #undef ETL_STD_ATOMIC_SUPPORTED
+#undef ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+#undef ETL_BUILTIN_PREFETCH_SUPPORTED
 
 // Determine the bit width of the platform.
 #define ETL_PLATFORM_16BIT (UINT16_MAX == UINTPTR_MAX)
@@ -77,6 +79,18 @@ SOFTWARE.
   #define ETL_CONSTEXPR
 #endif
 
+#if ETL_CPP14_SUPPORTED && !(defined(ETL_COMPILER_MICROSOFT) && (_MSC_VER < 1910))
+  #define ETL_CONSTEXPR14 constexpr
+#else
+  #define ETL_CONSTEXPR14
+#endif
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  #define ETL_MOVE(x) std::move(x)
+#else
+  #define ETL_MOVE(x) x
+#endif
+
 #if ETL_CPP17_SUPPORTED
   #define ETL_IF_CONSTEXPR constexpr
 #else
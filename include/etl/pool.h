@@ -43,6 +43,8 @@ SOFTWARE.
 
 #include <iterator>
 #include <algorithm>
+#include <utility>
+#include <new>
 
 #undef ETL_FILE
 #define ETL_FILE "11"
@@ -109,6 +111,38 @@ namespace etl
     {}
   };
 
+  namespace private_pool
+  {
+    //*************************************************************************
+    /// Moves and swaps the values of nodes for ipool::compact.
+    /// The links of the nodes are not touched.
+    //*************************************************************************
+    template <typename TNode, typename TValue, TValue TNode::* PValue>
+    struct node_relocator
+    {
+      void move(void* from, void* to) const
+      {
+        TValue& source = static_cast<TNode*>(from)->*PValue;
+
+        ::new ((void*)(&(static_cast<TNode*>(to)->*PValue))) TValue(ETL_MOVE(source));
+        source.~TValue();
+      }
+
+      void swap(void* a, void* b) const
+      {
+        TValue& value_a = static_cast<TNode*>(a)->*PValue;
+        TValue& value_b = static_cast<TNode*>(b)->*PValue;
+
+        TValue temp(ETL_MOVE(value_a));
+
+        value_a.~TValue();
+        ::new ((void*)(&value_a)) TValue(ETL_MOVE(value_b));
+        value_b.~TValue();
+        ::new ((void*)(&value_b)) TValue(ETL_MOVE(temp));
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup pool
   //***************************************************************************
@@ -291,6 +325,72 @@ namespace etl
       return is_item_in_pool((const char*)p_object);
     }
 
+    //*************************************************************************
+    /// Gets the address of the item at 'index' in the pool's buffer.
+    //*************************************************************************
+    void* item_address(size_t index) const
+    {
+      return p_buffer + (index * ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Moves the allocated items so that the item numbered 'i' ends up at
+    /// item_address(i), and rebuilds the free list, in address order, after
+    /// them. Any links between the items are left for the owner to rebuild.
+    /// Before the call, the owner must write each item's number, from 0 to
+    /// size() - 1, over the first word of the item.
+    /// 'relocator' must provide move(from, to), which moves an item to an
+    /// unused address, and swap(a, b), which exchanges two items.
+    /// Neither may change the first word of an item.
+    /// Only for a pool used by one container.
+    //*************************************************************************
+    template <typename TRelocator>
+    void compact(const TRelocator& relocator)
+    {
+      const uintptr_t FREE = ~uintptr_t(0);
+
+      // Mark the free items that have been initialised.
+      // The ones beyond them cannot be the destination of any item.
+      char* p_free = p_next;
+
+      for (uint32_t i = items_allocated; i < items_initialised; ++i)
+      {
+        char* p_item = p_free;
+        p_free = *reinterpret_cast<char**>(p_item);
+        *reinterpret_cast<uintptr_t*>(p_item) = FREE;
+      }
+
+      // Put each item in its place, following the chain of displaced items.
+      for (uint32_t i = 0; i < items_initialised; ++i)
+      {
+        char*     p_item = p_buffer + (i * ITEM_SIZE);
+        uintptr_t index  = *reinterpret_cast<uintptr_t*>(p_item);
+
+        while ((index != FREE) && (index != i))
+        {
+          char*     p_other     = p_buffer + (index * ITEM_SIZE);
+          uintptr_t other_index = *reinterpret_cast<uintptr_t*>(p_other);
+
+          if (other_index == FREE)
+          {
+            relocator.move(p_item, p_other);
+          }
+          else
+          {
+            relocator.swap(p_item, p_other);
+          }
+
+          *reinterpret_cast<uintptr_t*>(p_other) = index;
+          *reinterpret_cast<uintptr_t*>(p_item)  = other_index;
+          index = other_index;
+        }
+      }
+
+      // The free items now follow the allocated ones.
+      items_initialised = items_allocated;
+      p_next = (items_allocated == MAX_SIZE) ? nullptr : p_buffer + (items_allocated * ITEM_SIZE);
+    }
+
     //*************************************************************************
     /// Returns the maximum number of items in the pool.
     //*************************************************************************
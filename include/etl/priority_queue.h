@@ -34,12 +34,15 @@ SOFTWARE.
 #include <stddef.h>
 #include <functional>
 #include <algorithm>
+#include <iterator>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
 #include "vector.h"
 #include "type_traits.h"
 #include "parameter_type.h"
+#include "static_assert.h"
 #include "error_handler.h"
 #include "exception.h"
 
@@ -97,6 +100,203 @@ namespace etl
     }
   };
 
+  namespace private_priority_queue
+  {
+    //*************************************************************************
+    /// Heap operations on a d-ary heap, where each node has ARITY children.
+    /// Wider heaps are shallower, so a push makes fewer moves, and the
+    /// children of a node share a cache line.
+    //*************************************************************************
+    template <const size_t ARITY>
+    struct heap
+    {
+      ETL_STATIC_ASSERT(ARITY >= 2U, "A heap needs at least two children per node");
+
+      //***********************************************************************
+      /// Moves the value at the end of [first, last) up to its place.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+        size_t hole = size_t(last - first) - 1U;
+
+        value_type value = ETL_MOVE(*(first + hole));
+
+        while (hole > 0U)
+        {
+          const size_t parent = (hole - 1U) / ARITY;
+
+          if (!compare(*(first + parent), value))
+          {
+            break;
+          }
+
+          *(first + hole) = ETL_MOVE(*(first + parent));
+          hole = parent;
+        }
+
+        *(first + hole) = ETL_MOVE(value);
+      }
+
+      //***********************************************************************
+      /// Moves the top of [first, last) to the end, and restores the heap in
+      /// [first, last - 1).
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+        const size_t length = size_t(last - first) - 1U;
+
+        if (length > 0U)
+        {
+          value_type value = ETL_MOVE(*(first + length));
+          *(first + length) = ETL_MOVE(*first);
+
+          // The value from the end usually belongs near the bottom, so move
+          // the hole down to a leaf without comparing against it, then
+          // move the value up to its place.
+          size_t hole = 0U;
+
+          for (;;)
+          {
+            const size_t child_first = (hole * ARITY) + 1U;
+
+            if (child_first >= length)
+            {
+              break;
+            }
+
+            const size_t best = best_child(first, child_first, length, compare);
+
+            *(first + hole) = ETL_MOVE(*(first + best));
+            hole = best;
+          }
+
+          while (hole > 0U)
+          {
+            const size_t parent = (hole - 1U) / ARITY;
+
+            if (!compare(*(first + parent), value))
+            {
+              break;
+            }
+
+            *(first + hole) = ETL_MOVE(*(first + parent));
+            hole = parent;
+          }
+
+          *(first + hole) = ETL_MOVE(value);
+        }
+      }
+
+      //***********************************************************************
+      /// Arranges [first, last) as a heap.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+        const size_t length = size_t(last - first);
+
+        if (length < 2U)
+        {
+          return;
+        }
+
+        size_t parent = ((length - 2U) / ARITY) + 1U;
+
+        while (parent > 0U)
+        {
+          --parent;
+          value_type value = ETL_MOVE(*(first + parent));
+          sift_down(first, parent, length, value, compare);
+        }
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Moves 'value' down from 'hole' to its place.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static void sift_down(TIterator first, size_t hole, size_t length, typename std::iterator_traits<TIterator>::value_type& value, TCompare compare)
+      {
+        for (;;)
+        {
+          const size_t child_first = (hole * ARITY) + 1U;
+
+          if (child_first >= length)
+          {
+            break;
+          }
+
+          const size_t best = best_child(first, child_first, length, compare);
+
+          if (!compare(value, *(first + best)))
+          {
+            break;
+          }
+
+          *(first + hole) = ETL_MOVE(*(first + best));
+          hole = best;
+        }
+
+        *(first + hole) = ETL_MOVE(value);
+      }
+
+      //***********************************************************************
+      /// Finds the highest priority of the children starting at 'child_first'.
+      //***********************************************************************
+      template <typename TIterator, typename TCompare>
+      static size_t best_child(TIterator first, size_t child_first, size_t length, TCompare compare)
+      {
+        const size_t child_last = ((length - child_first) > ARITY) ? child_first + ARITY : length;
+
+        size_t best = child_first;
+
+        for (size_t child = child_first + 1U; child < child_last; ++child)
+        {
+          if (compare(*(first + best), *(first + child)))
+          {
+            best = child;
+          }
+        }
+
+        return best;
+      }
+    };
+
+    //*************************************************************************
+    /// A binary heap uses the standard heap algorithms.
+    //*************************************************************************
+    template <>
+    struct heap<2U>
+    {
+      template <typename TIterator, typename TCompare>
+      static void push(TIterator first, TIterator last, TCompare compare)
+      {
+        std::push_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void pop(TIterator first, TIterator last, TCompare compare)
+      {
+        std::pop_heap(first, last, compare);
+      }
+
+      template <typename TIterator, typename TCompare>
+      static void make(TIterator first, TIterator last, TCompare compare)
+      {
+        std::make_heap(first, last, compare);
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup queue
   ///\brief This is the base for all priority queues that contain a particular type.
@@ -112,8 +312,10 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam ARITY The number of children of each node of the heap.
+  /// 4 or 8 make fewer moves and cache misses than 2 for large queues.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare>
+  template <typename T, typename TContainer, typename TCompare, const size_t ARITY = 2U>
   class ipriority_queue
   {
   public:
@@ -156,16 +358,35 @@ namespace etl
     /// is the priority queue is already full.
     ///\param value The value to push to the queue.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
       ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
 
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      std::push_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the queue by moving it.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(T&& value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
+
+      // Put element at end
+      container.push_back(std::move(value));
+      // Make elements in container into heap
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
     }
+#endif
 
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     /// Emplaces a value to the queue.
     /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
@@ -180,7 +401,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      std::push_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
     }
 
     //*************************************************************************
@@ -197,7 +418,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      std::push_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
     }
 
     //*************************************************************************
@@ -214,7 +435,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      std::push_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
     }
 
     //*************************************************************************
@@ -231,9 +452,28 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      std::push_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
     }
 
+#else
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::priority_queue_full
+    /// is the priority queue is already full.
+    ///\param args The arguments used to construct the value to push to the queue.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args&& ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::priority_queue_full));
+
+      // Put element at end
+      container.emplace_back(std::forward<Args>(args)...);
+      // Make elements in container into heap
+      etl::private_priority_queue::heap<ARITY>::push(container.begin(), container.end(), TCompare());
+    }
+#endif
+
     //*************************************************************************
     /// Assigns values to the priority queue.
     /// If asserts or exceptions are enabled, emits priority_queue_full if
@@ -254,7 +494,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      std::make_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::make(container.begin(), container.end(), TCompare());
     }
 
     //*************************************************************************
@@ -264,7 +504,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      std::pop_heap(container.begin(), container.end(), TCompare());
+      etl::private_priority_queue::heap<ARITY>::pop(container.begin(), container.end(), TCompare());
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -275,7 +515,7 @@ namespace etl
     //*************************************************************************
     void pop_into(reference destination)
     {
-      destination = top();
+      destination = ETL_MOVE(top());
       pop();
     }
 
@@ -340,6 +580,18 @@ namespace etl
       assign(other.container.cbegin(), other.container.cend());
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Make this a clone of the supplied priority queue by moving its elements.
+    /// The heap order is preserved, so no re-heap is needed.
+    //*************************************************************************
+    void move_clone(ipriority_queue&& other)
+    {
+      container = std::move(other.container);
+      other.clear();
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -362,9 +614,10 @@ namespace etl
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam ARITY The number of children of each node of the heap.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = std::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = std::less<typename TContainer::value_type>, const size_t ARITY = 2U>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, ARITY>
   {
   public:
 
@@ -374,7 +627,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
     }
 
@@ -382,11 +635,22 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    priority_queue(priority_queue&& rhs)
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
+    {
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move_clone(std::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Constructor, from an iterator range.
     ///\tparam TIterator The iterator type.
@@ -395,9 +659,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, ARITY>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::assign(first, last);
     }
 
     //*************************************************************************
@@ -405,7 +669,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clear();
     }
 
     //*************************************************************************
@@ -415,11 +679,26 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::clone(rhs);
       }
 
       return *this;
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    priority_queue& operator = (priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::ipriority_queue<T, TContainer, TCompare, ARITY>::move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
   };
 }
 
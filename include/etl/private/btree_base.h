@@ -0,0 +1,1554 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include <stddef.h>
+#include <iterator>
+#include <algorithm>
+#include <new>
+#include <string.h>
+
+#include "../platform.h"
+#include "../pool.h"
+#include "../alignment.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../nullptr.h"
+#include "../type_traits.h"
+#include "../parameter_type.h"
+
+#undef ETL_FILE
+#define ETL_FILE "52"
+
+//*****************************************************************************
+/// The target size, in bytes, of a B+tree node.
+/// Four 64 byte cache lines by default.
+//*****************************************************************************
+#if !defined(ETL_BTREE_NODE_SIZE)
+  #define ETL_BTREE_NODE_SIZE 256
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the B+tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the B+tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : btree_exception(ETL_ERROR_TEXT("btree:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the B+tree containers.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all B+trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the size of the tree.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the tree.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the tree.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels of inner nodes above the leaves.
+    //*************************************************************************
+    size_t height() const
+    {
+      return tree_height;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    btree_base(size_type max_size_)
+      : current_size(0),
+        CAPACITY(max_size_),
+        tree_height(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_base()
+    {
+    }
+
+    size_type       current_size; ///< The number of values.
+    const size_type CAPACITY;     ///< The maximum number of values.
+    size_t          tree_height;  ///< The number of inner levels. Zero if the root is a leaf.
+  };
+
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The number of items that fit in a node, with a minimum of four.
+    //*************************************************************************
+    template <const size_t NODE_SIZE, const size_t ITEM_SIZE>
+    struct slots
+    {
+      static const size_t value = ((NODE_SIZE / ITEM_SIZE) < 4) ? 4 : (NODE_SIZE / ITEM_SIZE);
+    };
+  }
+
+  //***************************************************************************
+  /// The common implementation of the B+tree map and set.
+  /// Values are held in sorted, linked leaves. Inner nodes hold separator keys
+  /// and child pointers. Node sizes are set by ETL_BTREE_NODE_SIZE.
+  ///\tparam TKey        The key type.
+  ///\tparam TValue      The value type. May be const.
+  ///\tparam TGetKey     Gets the key from a value.
+  ///\tparam TKeyCompare The key comparison.
+  ///\ingroup btree
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TGetKey, typename TKeyCompare>
+  class ibtree : public etl::btree_base
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TValue            value_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+  protected:
+
+    typedef typename etl::remove_const<TValue>::type   storage_type;
+    typedef typename etl::parameter_type<TKey>::type   key_parameter_t;
+
+    static const size_t LEAF_HEADER_SIZE  = sizeof(size_t) + (2 * sizeof(void*));
+    static const size_t INNER_HEADER_SIZE = sizeof(size_t) + sizeof(void*);
+
+  public:
+
+    /// The maximum number of values in a leaf.
+    static const size_t LEAF_SLOTS = private_btree::slots<ETL_BTREE_NODE_SIZE - LEAF_HEADER_SIZE, sizeof(storage_type)>::value;
+
+    /// The maximum number of keys in an inner node.
+    static const size_t INNER_SLOTS = private_btree::slots<ETL_BTREE_NODE_SIZE - INNER_HEADER_SIZE, sizeof(TKey) + sizeof(void*)>::value;
+
+  protected:
+
+    /// The minimum number of values in a leaf that is not the root.
+    static const size_t LEAF_MIN = LEAF_SLOTS / 2;
+
+    /// The minimum number of keys in an inner node that is not the root.
+    static const size_t INNER_MIN = (INNER_SLOTS - 1) / 2;
+
+    /// The maximum number of inner levels.
+    static const size_t MAX_HEIGHT = 32;
+
+    //*************************************************************************
+    /// The number of leaves needed for a number of values.
+    //*************************************************************************
+    template <const size_t MAX_SIZE>
+    struct leaf_count
+    {
+      static const size_t value = (MAX_SIZE / LEAF_MIN) + 1;
+    };
+
+    //*************************************************************************
+    /// The number of inner nodes needed for a number of values.
+    //*************************************************************************
+    template <const size_t MAX_SIZE>
+    struct inner_count
+    {
+      static const size_t value = (leaf_count<MAX_SIZE>::value / INNER_MIN) + 1;
+    };
+
+    //*************************************************************************
+    /// A leaf node.
+    //*************************************************************************
+    struct leaf_t
+    {
+      storage_type* values()
+      {
+        return reinterpret_cast<storage_type*>(buffer.data);
+      }
+
+      const storage_type* values() const
+      {
+        return reinterpret_cast<const storage_type*>(buffer.data);
+      }
+
+      size_t  count;
+      leaf_t* prev;
+      leaf_t* next;
+      typename etl::aligned_storage<sizeof(storage_type) * LEAF_SLOTS, etl::alignment_of<storage_type>::value>::type buffer;
+    };
+
+    //*************************************************************************
+    /// An inner node.
+    //*************************************************************************
+    struct inner_t
+    {
+      TKey* keys()
+      {
+        return reinterpret_cast<TKey*>(buffer.data);
+      }
+
+      const TKey* keys() const
+      {
+        return reinterpret_cast<const TKey*>(buffer.data);
+      }
+
+      size_t count; ///< The number of keys. There is one more child.
+      void*  children[INNER_SLOTS + 1];
+      typename etl::aligned_storage<sizeof(TKey) * INNER_SLOTS, etl::alignment_of<TKey>::value>::type buffer;
+    };
+
+    //*************************************************************************
+    /// The inner nodes visited on the way to a leaf, indexed by level.
+    //*************************************************************************
+    struct path_t
+    {
+      inner_t* nodes[MAX_HEIGHT + 1];
+      size_t   index[MAX_HEIGHT + 1];
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public std::iterator<std::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(nullptr),
+          p_leaf(nullptr),
+          index(0)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (p_leaf == nullptr)
+        {
+          p_leaf = p_tree->p_tail;
+          index  = p_leaf->count - 1;
+        }
+        else if (index == 0)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count - 1;
+        }
+        else
+        {
+          --index;
+        }
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &p_leaf->values()[index];
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(ibtree& tree, leaf_t* p_leaf_, size_t index_)
+        : p_tree(&tree),
+          p_leaf(p_leaf_),
+          index(index_)
+      {
+      }
+
+      ibtree* p_tree;
+      leaf_t* p_leaf;
+      size_t  index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public std::iterator<std::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree;
+
+      const_iterator()
+        : p_tree(nullptr),
+          p_leaf(nullptr),
+          index(0)
+      {
+      }
+
+      const_iterator(const typename ibtree::iterator& other)
+        : p_tree(other.p_tree),
+          p_leaf(other.p_leaf),
+          index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (p_leaf == nullptr)
+        {
+          p_leaf = p_tree->p_tail;
+          index  = p_leaf->count - 1;
+        }
+        else if (index == 0)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count - 1;
+        }
+        else
+        {
+          --index;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_leaf->values()[index];
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ibtree& tree, const leaf_t* p_leaf_, size_t index_)
+        : p_tree(&tree),
+          p_leaf(p_leaf_),
+          index(index_)
+      {
+      }
+
+      const ibtree* p_tree;
+      const leaf_t* p_leaf;
+      size_t        index;
+    };
+
+    friend class iterator;
+    friend class const_iterator;
+
+    typedef typename std::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef std::reverse_iterator<iterator>       reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, p_head, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, p_head, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, nullptr, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, nullptr, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, p_head, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, nullptr, 0);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Assigns values to the tree.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the tree.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != nullptr)
+      {
+        destroy_subtree(p_root, tree_height);
+      }
+
+      p_root       = nullptr;
+      p_head       = nullptr;
+      p_tail       = nullptr;
+      tree_height  = 0;
+      current_size = 0;
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(key_parameter_t key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    //*************************************************************************
+    /// Returns two iterators bounding the key provided.
+    //*************************************************************************
+    std::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      return std::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns two const iterators bounding the key provided.
+    //*************************************************************************
+    std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      return std::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    /// Invalidates all iterators.
+    ///\return An iterator to the value following the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      leaf_t* p_leaf = const_cast<leaf_t*>(position.p_leaf);
+      size_t  index  = position.index;
+
+      if ((tree_height == 0) || (p_leaf->count > LEAF_MIN))
+      {
+        // No rebalancing, so the path is not needed and the next value will be in place.
+        const size_t remaining = p_leaf->count - 1;
+        leaf_t* const p_next   = p_leaf->next;
+
+        path_t path;
+        erase_at(path, p_leaf, index);
+
+        if (remaining == 0)
+        {
+          return end();
+        }
+
+        return (index == remaining) ? iterator(*this, p_next, 0) : iterator(*this, p_leaf, index);
+      }
+
+      // The tree may be rebalanced, so find the next value by key.
+      const_iterator next = position;
+      ++next;
+
+      if (next == cend())
+      {
+        erase(get_key(*position));
+        return end();
+      }
+
+      const TKey next_key = get_key(*next);
+      erase(get_key(*position));
+
+      return lower_bound(next_key);
+    }
+
+    //*************************************************************************
+    /// Erases the value with the key.
+    ///\return 1 if the key was found, otherwise 0.
+    //*************************************************************************
+    size_type erase(key_parameter_t key)
+    {
+      if (p_root == nullptr)
+      {
+        return 0;
+      }
+
+      path_t  path;
+      leaf_t* p_leaf = find_leaf(key, &path);
+      size_t  index  = lower_index(*p_leaf, key);
+
+      if ((index == p_leaf->count) || compare(key, get_key(p_leaf->values()[index])))
+      {
+        return 0;
+      }
+
+      erase_at(path, p_leaf, index);
+
+      return 1;
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      if (last == cend())
+      {
+        // Erase from the back, so that the end remains valid.
+        size_t n = std::distance(first, last);
+
+        while (n-- > 0)
+        {
+          erase(const_iterator(--end()));
+        }
+
+        return end();
+      }
+
+      // Erase by key, as iterators are invalidated.
+      const TKey last_key = get_key(*last);
+
+      iterator next(*this, const_cast<leaf_t*>(first.p_leaf), first.index);
+
+      while (compare(get_key(*next), last_key))
+      {
+        next = erase(const_iterator(next));
+      }
+
+      return next;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      if (p_root != nullptr)
+      {
+        leaf_t* p_leaf = find_leaf(key, nullptr);
+        size_t  index  = lower_index(*p_leaf, key);
+
+        if ((index != p_leaf->count) && !compare(key, get_key(p_leaf->values()[index])))
+        {
+          return iterator(*this, p_leaf, index);
+        }
+      }
+
+      return end();
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_cast<ibtree*>(this)->find(key);
+    }
+
+    //*********************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    /// Invalidates all iterators.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(const_reference value)
+    {
+      const TKey& key = get_key(value);
+
+      if (p_root == nullptr)
+      {
+        leaf_t* p_leaf = allocate_leaf();
+        p_root = p_head = p_tail = p_leaf;
+      }
+
+      path_t  path;
+      leaf_t* p_leaf = find_leaf(key, &path);
+      size_t  index  = lower_index(*p_leaf, key);
+
+      if ((index != p_leaf->count) && !compare(key, get_key(p_leaf->values()[index])))
+      {
+        return std::make_pair(iterator(*this, p_leaf, index), false);
+      }
+
+      ETL_ASSERT(!full(), ETL_ERROR(btree_full));
+
+      return std::make_pair(insert_at(path, p_leaf, index, value), true);
+    }
+
+    //*********************************************************************
+    /// Inserts a value.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is already full.
+    ///\param position Ignored.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the first element not before the key, or end().
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      if (p_root == nullptr)
+      {
+        return end();
+      }
+
+      leaf_t* p_leaf = find_leaf(key, nullptr);
+
+      return make_iterator(p_leaf, lower_index(*p_leaf, key));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the first element not before the key, or end().
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_cast<ibtree*>(this)->lower_bound(key);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the first element after the key, or end().
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      if (p_root == nullptr)
+      {
+        return end();
+      }
+
+      leaf_t* p_leaf = find_leaf(key, nullptr);
+
+      return make_iterator(p_leaf, upper_index(*p_leaf, key));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the first element after the key, or end().
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_cast<ibtree*>(this)->upper_bound(key);
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree(etl::ipool& leaf_pool, etl::ipool& inner_pool, size_t max_size_)
+      : etl::btree_base(max_size_),
+        p_leaf_pool(&leaf_pool),
+        p_inner_pool(&inner_pool),
+        p_root(nullptr),
+        p_head(nullptr),
+        p_tail(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ibtree()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the key of a value.
+    //*************************************************************************
+    static const TKey& get_key(const storage_type& value)
+    {
+      return TGetKey()(value);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Descends to the leaf that would hold the key.
+    /// Records the inner nodes and child indexes visited, if required.
+    //*************************************************************************
+    leaf_t* find_leaf(key_parameter_t key, path_t* p_path) const
+    {
+      void* p_node = p_root;
+
+      for (size_t level = tree_height; level > 0; --level)
+      {
+        inner_t* p_inner = static_cast<inner_t*>(p_node);
+
+        // The child follows the last separator that is not after the key.
+        const TKey* const p_keys = p_inner->keys();
+        const size_t      index  = search<separator_key>(p_keys, p_inner->count, key, true);
+
+        if (p_path != nullptr)
+        {
+          p_path->nodes[level] = p_inner;
+          p_path->index[level] = index;
+        }
+
+        p_node = p_inner->children[index];
+      }
+
+      return static_cast<leaf_t*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Gets the key of a separator.
+    //*************************************************************************
+    struct separator_key
+    {
+      const TKey& operator()(const TKey& key) const
+      {
+        return key;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a value.
+    //*************************************************************************
+    struct value_key
+    {
+      const TKey& operator()(const storage_type& value) const
+      {
+        return TGetKey()(value);
+      }
+    };
+
+    //*************************************************************************
+    /// The number of items before the key, or not after the key if 'upper'.
+    /// Branchless, as the outcome of each comparison is unpredictable.
+    //*************************************************************************
+    template <typename TGet, typename T>
+    size_t search(const T* p_items, size_t n, key_parameter_t key, bool upper) const
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      TGet       get;
+      const T*   p_base = p_items;
+
+      while (n > 1)
+      {
+        const size_t half = n / 2;
+        p_base = before(get(p_base[half - 1]), key, upper) ? p_base + half : p_base;
+        n -= half;
+      }
+
+      return size_t(p_base - p_items) + (before(get(*p_base), key, upper) ? 1 : 0);
+    }
+
+    //*************************************************************************
+    /// Is the item key before the key, or not after the key if 'upper'.
+    //*************************************************************************
+    bool before(const TKey& item_key, key_parameter_t key, bool upper) const
+    {
+      return upper ? !compare(key, item_key) : compare(item_key, key);
+    }
+
+    //*************************************************************************
+    /// The index of the first value in the leaf that is not before the key.
+    //*************************************************************************
+    size_t lower_index(const leaf_t& leaf, key_parameter_t key) const
+    {
+      return search<value_key>(leaf.values(), leaf.count, key, false);
+    }
+
+    //*************************************************************************
+    /// The index of the first value in the leaf that is after the key.
+    //*************************************************************************
+    size_t upper_index(const leaf_t& leaf, key_parameter_t key) const
+    {
+      return search<value_key>(leaf.values(), leaf.count, key, true);
+    }
+
+    //*************************************************************************
+    /// Makes an iterator, moving to the next leaf if the index is past the end.
+    //*************************************************************************
+    iterator make_iterator(leaf_t* p_leaf, size_t index)
+    {
+      if (index == p_leaf->count)
+      {
+        return iterator(*this, p_leaf->next, 0);
+      }
+
+      return iterator(*this, p_leaf, index);
+    }
+
+    //*************************************************************************
+    /// Moves a value to uninitialised storage.
+    //*************************************************************************
+    static void move_value(storage_type* p_destination, storage_type* p_source)
+    {
+      ::new (p_destination) storage_type(*p_source);
+      p_source->~storage_type();
+    }
+
+    //*************************************************************************
+    /// Moves a range of values to uninitialised storage, where the ranges may overlap.
+    //*************************************************************************
+    static void move_values(storage_type* p_destination, storage_type* p_source, size_t n)
+    {
+      if (p_destination < p_source)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          move_value(p_destination + i, p_source + i);
+        }
+      }
+      else
+      {
+        while (n-- > 0)
+        {
+          move_value(p_destination + n, p_source + n);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Moves a range of keys to uninitialised storage, where the ranges may overlap.
+    //*************************************************************************
+    static void move_keys(TKey* p_destination, TKey* p_source, size_t n)
+    {
+      if (p_destination < p_source)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          ::new (p_destination + i) TKey(p_source[i]);
+          p_source[i].~TKey();
+        }
+      }
+      else
+      {
+        while (n-- > 0)
+        {
+          ::new (p_destination + n) TKey(p_source[n]);
+          p_source[n].~TKey();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Moves a range of child pointers, where the ranges may overlap.
+    //*************************************************************************
+    static void move_children(void** p_destination, void** p_source, size_t n)
+    {
+      memmove(p_destination, p_source, n * sizeof(void*));
+    }
+
+    //*************************************************************************
+    /// Allocates an empty leaf.
+    //*************************************************************************
+    leaf_t* allocate_leaf()
+    {
+      ETL_ASSERT(!p_leaf_pool->full(), ETL_ERROR(btree_full));
+
+      leaf_t* p_leaf = p_leaf_pool->template allocate<leaf_t>();
+      p_leaf->count  = 0;
+      p_leaf->prev   = nullptr;
+      p_leaf->next   = nullptr;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    /// Allocates an empty inner node.
+    //*************************************************************************
+    inner_t* allocate_inner()
+    {
+      ETL_ASSERT(!p_inner_pool->full(), ETL_ERROR(btree_full));
+
+      inner_t* p_inner = p_inner_pool->template allocate<inner_t>();
+      p_inner->count   = 0;
+
+      return p_inner;
+    }
+
+    //*************************************************************************
+    /// Removes a leaf from the linked list and releases it.
+    //*************************************************************************
+    void release_leaf(leaf_t* p_leaf)
+    {
+      if (p_leaf->prev != nullptr)
+      {
+        p_leaf->prev->next = p_leaf->next;
+      }
+      else
+      {
+        p_head = p_leaf->next;
+      }
+
+      if (p_leaf->next != nullptr)
+      {
+        p_leaf->next->prev = p_leaf->prev;
+      }
+      else
+      {
+        p_tail = p_leaf->prev;
+      }
+
+      p_leaf_pool->release(p_leaf);
+    }
+
+    //*************************************************************************
+    /// Destroys all values and keys in a sub-tree and releases the nodes.
+    //*************************************************************************
+    void destroy_subtree(void* p_node, size_t level)
+    {
+      if (level == 0)
+      {
+        leaf_t* p_leaf = static_cast<leaf_t*>(p_node);
+
+        for (size_t i = 0; i < p_leaf->count; ++i)
+        {
+          p_leaf->values()[i].~storage_type();
+        }
+
+        p_leaf_pool->release(p_leaf);
+      }
+      else
+      {
+        inner_t* p_inner = static_cast<inner_t*>(p_node);
+
+        for (size_t i = 0; i <= p_inner->count; ++i)
+        {
+          destroy_subtree(p_inner->children[i], level - 1);
+        }
+
+        for (size_t i = 0; i < p_inner->count; ++i)
+        {
+          p_inner->keys()[i].~TKey();
+        }
+
+        p_inner_pool->release(p_inner);
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a value into a leaf at the index, splitting it if full.
+    //*************************************************************************
+    iterator insert_at(path_t& path, leaf_t* p_leaf, size_t index, const_reference value)
+    {
+      ++current_size;
+
+      if (p_leaf->count < LEAF_SLOTS)
+      {
+        insert_in_leaf(*p_leaf, index, value);
+        return iterator(*this, p_leaf, index);
+      }
+
+      // Split the leaf.
+      leaf_t* p_right = allocate_leaf();
+
+      const size_t left_count = (LEAF_SLOTS + 1) / 2;
+
+      iterator result;
+
+      if (index < left_count)
+      {
+        move_values(p_right->values(), p_leaf->values() + left_count - 1, LEAF_SLOTS - left_count + 1);
+        p_right->count = LEAF_SLOTS - left_count + 1;
+        p_leaf->count  = left_count - 1;
+
+        insert_in_leaf(*p_leaf, index, value);
+        result = iterator(*this, p_leaf, index);
+      }
+      else
+      {
+        move_values(p_right->values(), p_leaf->values() + left_count, LEAF_SLOTS - left_count);
+        p_right->count = LEAF_SLOTS - left_count;
+        p_leaf->count  = left_count;
+
+        insert_in_leaf(*p_right, index - left_count, value);
+        result = iterator(*this, p_right, index - left_count);
+      }
+
+      // Link the new leaf.
+      p_right->prev = p_leaf;
+      p_right->next = p_leaf->next;
+
+      if (p_leaf->next != nullptr)
+      {
+        p_leaf->next->prev = p_right;
+      }
+      else
+      {
+        p_tail = p_right;
+      }
+
+      p_leaf->next = p_right;
+
+      insert_in_parent(path, get_key(p_right->values()[0]), p_right);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Inserts a value into a leaf that is not full.
+    //*************************************************************************
+    static void insert_in_leaf(leaf_t& leaf, size_t index, const_reference value)
+    {
+      move_values(leaf.values() + index + 1, leaf.values() + index, leaf.count - index);
+      ::new (leaf.values() + index) storage_type(value);
+      ++leaf.count;
+    }
+
+    //*************************************************************************
+    /// Inserts a separator and the new node to its right into an inner node that is not full.
+    //*************************************************************************
+    static void insert_in_inner(inner_t& inner, size_t index, const TKey& key, void* p_child)
+    {
+      move_keys(inner.keys() + index + 1, inner.keys() + index, inner.count - index);
+      move_children(inner.children + index + 2, inner.children + index + 1, inner.count - index);
+      ::new (inner.keys() + index) TKey(key);
+      inner.children[index + 1] = p_child;
+      ++inner.count;
+    }
+
+    //*************************************************************************
+    /// Adds a new node, split from a node at the level below, to the parent.
+    /// Splits full inner nodes up to the root.
+    //*************************************************************************
+    void insert_in_parent(path_t& path, TKey key, void* p_child)
+    {
+      for (size_t level = 1; ; ++level)
+      {
+        if (level > tree_height)
+        {
+          // A new root.
+          ETL_ASSERT(tree_height < MAX_HEIGHT, ETL_ERROR(btree_full));
+
+          inner_t* p_root_node = allocate_inner();
+          ::new (p_root_node->keys()) TKey(key);
+          p_root_node->children[0] = p_root;
+          p_root_node->children[1] = p_child;
+          p_root_node->count       = 1;
+
+          p_root = p_root_node;
+          ++tree_height;
+          return;
+        }
+
+        inner_t&     inner = *path.nodes[level];
+        const size_t index = path.index[level];
+
+        if (inner.count < INNER_SLOTS)
+        {
+          insert_in_inner(inner, index, key, p_child);
+          return;
+        }
+
+        // Split the inner node, promoting the middle key.
+        inner_t* p_right = allocate_inner();
+
+        const size_t middle = INNER_SLOTS / 2;
+
+        move_keys(p_right->keys(), inner.keys() + middle + 1, INNER_SLOTS - middle - 1);
+        move_children(p_right->children, inner.children + middle + 1, INNER_SLOTS - middle);
+        p_right->count = INNER_SLOTS - middle - 1;
+
+        TKey promoted(inner.keys()[middle]);
+        inner.keys()[middle].~TKey();
+        inner.count = middle;
+
+        if (index <= middle)
+        {
+          insert_in_inner(inner, index, key, p_child);
+        }
+        else
+        {
+          insert_in_inner(*p_right, index - middle - 1, key, p_child);
+        }
+
+        key     = promoted;
+        p_child = p_right;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes a key and the child to its right from an inner node.
+    //*************************************************************************
+    static void remove_from_inner(inner_t& inner, size_t index)
+    {
+      inner.keys()[index].~TKey();
+      move_keys(inner.keys() + index, inner.keys() + index + 1, inner.count - index - 1);
+      move_children(inner.children + index + 1, inner.children + index + 2, inner.count - index - 1);
+      --inner.count;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the index in the leaf and rebalances the tree.
+    //*************************************************************************
+    void erase_at(path_t& path, leaf_t* p_leaf, size_t index)
+    {
+      p_leaf->values()[index].~storage_type();
+      move_values(p_leaf->values() + index, p_leaf->values() + index + 1, p_leaf->count - index - 1);
+      --p_leaf->count;
+      --current_size;
+
+      if (tree_height == 0)
+      {
+        if (p_leaf->count == 0)
+        {
+          release_leaf(p_leaf);
+          p_root = nullptr;
+        }
+
+        return;
+      }
+
+      if (p_leaf->count >= LEAF_MIN)
+      {
+        return;
+      }
+
+      inner_t&     parent = *path.nodes[1];
+      const size_t child  = path.index[1];
+
+      leaf_t* p_left  = (child > 0)            ? static_cast<leaf_t*>(parent.children[child - 1]) : nullptr;
+      leaf_t* p_right = (child < parent.count) ? static_cast<leaf_t*>(parent.children[child + 1]) : nullptr;
+
+      if ((p_left != nullptr) && (p_left->count > LEAF_MIN))
+      {
+        // Borrow the last value of the left sibling.
+        move_values(p_leaf->values() + 1, p_leaf->values(), p_leaf->count);
+        move_value(p_leaf->values(), p_left->values() + p_left->count - 1);
+        --p_left->count;
+        ++p_leaf->count;
+
+        parent.keys()[child - 1] = get_key(p_leaf->values()[0]);
+      }
+      else if ((p_right != nullptr) && (p_right->count > LEAF_MIN))
+      {
+        // Borrow the first value of the right sibling.
+        move_value(p_leaf->values() + p_leaf->count, p_right->values());
+        move_values(p_right->values(), p_right->values() + 1, p_right->count - 1);
+        --p_right->count;
+        ++p_leaf->count;
+
+        parent.keys()[child] = get_key(p_right->values()[0]);
+      }
+      else if (p_left != nullptr)
+      {
+        // Merge into the left sibling.
+        move_values(p_left->values() + p_left->count, p_leaf->values(), p_leaf->count);
+        p_left->count += p_leaf->count;
+
+        release_leaf(p_leaf);
+        remove_from_inner(parent, child - 1);
+        rebalance_inner(path);
+      }
+      else
+      {
+        // Merge the right sibling into this one.
+        move_values(p_leaf->values() + p_leaf->count, p_right->values(), p_right->count);
+        p_leaf->count += p_right->count;
+
+        release_leaf(p_right);
+        remove_from_inner(parent, child);
+        rebalance_inner(path);
+      }
+    }
+
+    //*************************************************************************
+    /// Rebalances the inner nodes on the path after a merge.
+    //*************************************************************************
+    void rebalance_inner(path_t& path)
+    {
+      for (size_t level = 1; ; ++level)
+      {
+        inner_t& node = *path.nodes[level];
+
+        if (level == tree_height)
+        {
+          // Remove a root with a single child.
+          if (node.count == 0)
+          {
+            p_root = node.children[0];
+            p_inner_pool->release(&node);
+            --tree_height;
+          }
+
+          return;
+        }
+
+        if (node.count >= INNER_MIN)
+        {
+          return;
+        }
+
+        inner_t&     parent = *path.nodes[level + 1];
+        const size_t child  = path.index[level + 1];
+
+        inner_t* p_left  = (child > 0)            ? static_cast<inner_t*>(parent.children[child - 1]) : nullptr;
+        inner_t* p_right = (child < parent.count) ? static_cast<inner_t*>(parent.children[child + 1]) : nullptr;
+
+        if ((p_left != nullptr) && (p_left->count > INNER_MIN))
+        {
+          // Rotate the last child of the left sibling through the parent.
+          move_keys(node.keys() + 1, node.keys(), node.count);
+          move_children(node.children + 1, node.children, node.count + 1);
+          ::new (node.keys()) TKey(parent.keys()[child - 1]);
+          node.children[0] = p_left->children[p_left->count];
+          ++node.count;
+
+          parent.keys()[child - 1] = p_left->keys()[p_left->count - 1];
+          p_left->keys()[p_left->count - 1].~TKey();
+          --p_left->count;
+
+          return;
+        }
+
+        if ((p_right != nullptr) && (p_right->count > INNER_MIN))
+        {
+          // Rotate the first child of the right sibling through the parent.
+          ::new (node.keys() + node.count) TKey(parent.keys()[child]);
+          node.children[node.count + 1] = p_right->children[0];
+          ++node.count;
+
+          parent.keys()[child] = p_right->keys()[0];
+          p_right->keys()[0].~TKey();
+          move_keys(p_right->keys(), p_right->keys() + 1, p_right->count - 1);
+          move_children(p_right->children, p_right->children + 1, p_right->count);
+          --p_right->count;
+
+          return;
+        }
+
+        if (p_left != nullptr)
+        {
+          // Merge into the left sibling.
+          merge_inner(*p_left, parent.keys()[child - 1], node);
+          remove_from_inner(parent, child - 1);
+        }
+        else
+        {
+          // Merge the right sibling into this one.
+          merge_inner(node, parent.keys()[child], *p_right);
+          remove_from_inner(parent, child);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Appends the separator and the contents of the right node to the left node.
+    /// Releases the right node.
+    //*************************************************************************
+    void merge_inner(inner_t& left, const TKey& separator, inner_t& right)
+    {
+      ::new (left.keys() + left.count) TKey(separator);
+      move_keys(left.keys() + left.count + 1, right.keys(), right.count);
+      move_children(left.children + left.count + 1, right.children, right.count + 1);
+      left.count += right.count + 1;
+
+      p_inner_pool->release(&right);
+    }
+
+    // Disable copy construction.
+    ibtree(const ibtree&);
+
+    etl::ipool* p_leaf_pool;
+    etl::ipool* p_inner_pool;
+    void*       p_root;
+    leaf_t*     p_head;
+    leaf_t*     p_tail;
+    TKeyCompare compare;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
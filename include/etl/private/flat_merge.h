@@ -0,0 +1,260 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MERGE_INCLUDED
+#define ETL_FLAT_MERGE_INCLUDED
+
+#include <stddef.h>
+#include <algorithm>
+
+#include "../platform.h"
+#include "../algorithm.h"
+
+//*****************************************************************************
+/// Bulk insertion for the flat containers.
+/// The new element pointers are appended to the end of the lookup, sorted,
+/// filtered for duplicates, then merged with the existing elements in a
+/// single backward pass, rather than being inserted one at a time.
+//*****************************************************************************
+namespace etl
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Reverses each run of equivalent values in the sorted range.
+    //*************************************************************************
+    template <typename TPointer, typename TCompare>
+    void reverse_equivalent_runs(TPointer first, TPointer last, TCompare compare)
+    {
+      while (first != last)
+      {
+        TPointer run_end = first + 1;
+
+        while ((run_end != last) && !compare(*first, *run_end))
+        {
+          ++run_end;
+        }
+
+        std::reverse(first, run_end);
+        first = run_end;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the pointers appended to the lookup after the first 'n'.
+    /// If 'sorted' is set they are only checked, and sorted if that fails.
+    /// The sort is stable. Equivalent values keep their order of insertion if
+    /// 'unique' is set, so that the first is kept, and are reversed if not, as
+    /// each single insert places a value before its equivalents.
+    /// If 'unique' is set, moves those that are already in the lookup, or that
+    /// repeat within the appended range, to the front of the appended range.
+    /// Returns the number that were moved.
+    //*************************************************************************
+    template <typename TLookup, typename TCompare>
+    size_t prepare(TLookup& lookup, size_t n, bool sorted, bool unique, TCompare compare)
+    {
+      typedef typename TLookup::value_type pointer_t;
+
+      pointer_t*   p    = lookup.data();
+      const size_t size = lookup.size();
+
+      if (sorted && etl::is_sorted(p + n, p + size, compare))
+      {
+        if (!unique)
+        {
+          reverse_equivalent_runs(p + n, p + size, compare);
+        }
+      }
+      else
+      {
+        if (!unique)
+        {
+          std::reverse(p + n, p + size);
+        }
+
+        etl::stable_sort(p + n, p + size, compare);
+      }
+
+      if (!unique)
+      {
+        return 0;
+      }
+
+      size_t write    = size;
+      size_t existing = n;
+
+      // Walk back through the new values, keeping them packed at the end.
+      for (size_t read = size; read > n; --read)
+      {
+        pointer_t value = p[read - 1];
+
+        // Sorted, so a repeat is equal to its predecessor.
+        bool duplicate = ((read - 1) > n) && !compare(p[read - 2], value);
+
+        if (!duplicate)
+        {
+          while ((existing > 0) && compare(value, p[existing - 1]))
+          {
+            --existing;
+          }
+
+          duplicate = (existing > 0) && !compare(p[existing - 1], value);
+        }
+
+        if (!duplicate)
+        {
+          --write;
+          std::swap(p[read - 1], p[write]);
+        }
+      }
+
+      return write - n;
+    }
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last) in place,
+    /// without a buffer, by rotation.
+    /// Equivalent values from [first, middle) are placed first.
+    //*************************************************************************
+    template <typename TPointer, typename TCompare>
+    void merge_in_place(TPointer first, TPointer middle, TPointer last, TCompare compare)
+    {
+      const size_t n1 = middle - first;
+      const size_t n2 = last - middle;
+
+      if ((n1 == 0) || (n2 == 0))
+      {
+        return;
+      }
+
+      if ((n1 + n2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          std::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      TPointer cut1;
+      TPointer cut2;
+
+      if (n1 > n2)
+      {
+        cut1 = first + (n1 / 2);
+        cut2 = std::lower_bound(middle, last, *cut1, compare);
+      }
+      else
+      {
+        cut2 = middle + (n2 / 2);
+        cut1 = std::upper_bound(first, middle, *cut2, compare);
+      }
+
+      std::rotate(cut1, middle, cut2);
+
+      TPointer new_middle = cut1 + (cut2 - middle);
+
+      merge_in_place(first, cut1, new_middle, compare);
+      merge_in_place(new_middle, cut2, last, compare);
+    }
+
+    //*************************************************************************
+    /// Merges the sorted existing pointers [0, n) with the sorted new pointers
+    /// [n + skip, size), discarding [n + skip) and leaving the lookup sorted.
+    /// Equivalent new values are placed before the existing ones, as they are
+    /// by a single insert.
+    /// The spare capacity of the lookup is used as the merge buffer. If there
+    /// is not enough, the two runs are merged in place by rotation instead.
+    //*************************************************************************
+    template <typename TLookup, typename TCompare>
+    void merge(TLookup& lookup, size_t n, size_t skip, TCompare compare)
+    {
+      typedef typename TLookup::value_type pointer_t;
+
+      const size_t size     = lookup.size();
+      const size_t n_new    = size - (n + skip);
+      const size_t new_size = n + n_new;
+
+      if (n == 0)
+      {
+        // Nothing to merge with.
+        etl::move(lookup.data() + skip, lookup.data() + size, lookup.data());
+      }
+      else if (n_new == 0)
+      {
+        // Nothing new.
+      }
+      else if ((lookup.capacity() - new_size) >= n_new)
+      {
+        const size_t capacity = lookup.capacity();
+
+        // The pointer vector does not initialise elements when resizing.
+        lookup.resize(capacity);
+
+        pointer_t* p = lookup.data();
+
+        // Park the new values at the top of the buffer.
+        etl::move_backward(p + n + skip, p + size, p + capacity);
+
+        pointer_t* p_new  = p + (capacity - n_new);
+        size_t     i      = n;
+        size_t     j      = n_new;
+        size_t     k      = new_size;
+
+        while (j > 0)
+        {
+          if ((i > 0) && !compare(p[i - 1], p_new[j - 1]))
+          {
+            p[--k] = p[--i];
+          }
+          else
+          {
+            p[--k] = p_new[--j];
+          }
+        }
+      }
+      else
+      {
+        pointer_t* p = lookup.data();
+
+        etl::move(p + n + skip, p + size, p + n);
+
+        // New values go first, so swap the runs.
+        std::rotate(p, p + n, p + new_size);
+        merge_in_place(p, p + n_new, p + new_size, compare);
+      }
+
+      lookup.resize(new_size);
+    }
+  }
+}
+
+#endif
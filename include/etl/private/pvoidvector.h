@@ -415,7 +415,7 @@ namespace etl
       if (position != end())
       {
         ++p_end;
-        std::copy_backward(position, end() - 1, end());
+        etl::move_backward(position, end() - 1, end());
         *position = value;
       }
       else
@@ -437,7 +437,7 @@ namespace etl
     {
       ETL_ASSERT((size() + 1) <= CAPACITY, ETL_ERROR(vector_full));
 
-      std::copy_backward(position, p_end, p_end + n);
+      etl::move_backward(position, p_end, p_end + n);
       std::fill_n(position, n, value);
 
       p_end += n;
@@ -458,7 +458,7 @@ namespace etl
 
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
-      std::copy_backward(position, p_end, p_end + count);
+      etl::move_backward(position, p_end, p_end + count);
       std::copy(first, last, position);
       p_end += count;
     }
@@ -470,7 +470,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
+      etl::move(i_element + 1, end(), i_element);
       --p_end;
 
       return i_element;
@@ -486,7 +486,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator first, iterator last)
     {
-      std::copy(last, end(), first);
+      etl::move(last, end(), first);
       size_t n_delete = std::distance(first, last);
 
       // Just adjust the count.
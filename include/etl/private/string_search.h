@@ -0,0 +1,346 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+
+#include "../platform.h"
+
+//*****************************************************************************
+/// Search kernels shared by etl::ibasic_string and etl::basic_string_view.
+/// Single characters are found with memchr for byte sized characters, which
+/// the C library vectorises. Sets of characters are tested against a 256 bit
+/// map. Longer substrings use Boyer-Moore-Horspool.
+//*****************************************************************************
+
+#if !defined(ETL_STRING_SEARCH_HORSPOOL_MIN_PATTERN)
+  /// Patterns shorter than this are found by scanning for the first character.
+  #define ETL_STRING_SEARCH_HORSPOOL_MIN_PATTERN 8
+#endif
+
+#if !defined(ETL_STRING_SEARCH_HORSPOOL_MIN_TEXT)
+  /// Text shorter than this is not worth building the skip table for.
+  #define ETL_STRING_SEARCH_HORSPOOL_MIN_TEXT 64
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// The value of a character as an unsigned index.
+    //*************************************************************************
+    template <typename T>
+    uint32_t to_index(T c)
+    {
+      return (sizeof(T) == 1) ? uint32_t(uint8_t(c)) : uint32_t(c);
+    }
+
+    //*************************************************************************
+    /// Finds the first 'c' in [first, last). Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c)
+    {
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    inline const char* find_char(const char* first, const char* last, char c)
+    {
+      const void* p = (first != last) ? memchr(first, c, last - first) : 0;
+
+      return (p != 0) ? static_cast<const char*>(p) : last;
+    }
+
+    //*************************************************************************
+    inline const signed char* find_char(const signed char* first, const signed char* last, signed char c)
+    {
+      const void* p = (first != last) ? memchr(first, c, last - first) : 0;
+
+      return (p != 0) ? static_cast<const signed char*>(p) : last;
+    }
+
+    //*************************************************************************
+    inline const unsigned char* find_char(const unsigned char* first, const unsigned char* last, unsigned char c)
+    {
+      const void* p = (first != last) ? memchr(first, c, last - first) : 0;
+
+      return (p != 0) ? static_cast<const unsigned char*>(p) : last;
+    }
+
+    //*************************************************************************
+    /// Is 'c' in [s, s + n)?
+    //*************************************************************************
+    template <typename T>
+    bool is_in(const T* s, size_t n, T c)
+    {
+      return find_char(s, s + n, c) != (s + n);
+    }
+
+    //*************************************************************************
+    /// A set of characters, as a 256 bit map.
+    /// Characters outside of the map, in wide strings, are checked against
+    /// the original list.
+    //*************************************************************************
+    template <typename T>
+    class char_set
+    {
+    public:
+
+      //***********************************************************************
+      char_set(const T* s_, size_t n_)
+        : s(s_),
+          n(n_),
+          has_wide(false)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          const uint32_t index = to_index(s[i]);
+
+          if (index < 256U)
+          {
+            bits[index >> 5U] |= (uint32_t(1U) << (index & 0x1FU));
+          }
+          else
+          {
+            has_wide = true;
+          }
+        }
+      }
+
+      //***********************************************************************
+      bool contains(T c) const
+      {
+        const uint32_t index = to_index(c);
+
+        if (index < 256U)
+        {
+          return (bits[index >> 5U] & (uint32_t(1U) << (index & 0x1FU))) != 0U;
+        }
+        else
+        {
+          return has_wide && is_in(s, n, c);
+        }
+      }
+
+    private:
+
+      uint32_t bits[256 / 32];
+      const T* s;
+      size_t   n;
+      bool     has_wide;
+    };
+
+    //*************************************************************************
+    /// Finds the first character in [first, last) that is (or is not) in [s, s + n).
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_of(const T* first, const T* last, const T* s, size_t n, bool in_set)
+    {
+      if (n == 1U)
+      {
+        if (in_set)
+        {
+          return find_char(first, last, *s);
+        }
+
+        while ((first != last) && (*first == *s))
+        {
+          ++first;
+        }
+
+        return first;
+      }
+
+      // Building the map costs about as much as checking n / 4 characters
+      // against the list, and short scans are common when parsing.
+      // So check the first few characters directly.
+      const size_t scan = n / 4U;
+
+      if (scan != 0U)
+      {
+        const T* scan_last = (size_t(last - first) > scan) ? first + scan : last;
+
+        while ((first != scan_last) && (is_in(s, n, *first) != in_set))
+        {
+          ++first;
+        }
+
+        if (first != scan_last)
+        {
+          return first;
+        }
+      }
+
+      const char_set<T> set(s, n);
+
+      while ((first != last) && (set.contains(*first) != in_set))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last character in [first, last) that is (or is not) in [s, s + n).
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last_of(const T* first, const T* last, const T* s, size_t n, bool in_set)
+    {
+      const T* p = last;
+
+      // Check the last few characters directly, as for find_first_of.
+      const size_t scan = n / 4U;
+
+      if (scan != 0U)
+      {
+        const T* scan_first = (size_t(last - first) > scan) ? last - scan : first;
+
+        while (p != scan_first)
+        {
+          --p;
+
+          if (is_in(s, n, *p) == in_set)
+          {
+            return p;
+          }
+        }
+      }
+
+      const char_set<T> set(s, n);
+
+      while (p != first)
+      {
+        --p;
+
+        if (set.contains(*p) == in_set)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of [s, s + n) in [first, last).
+    /// Returns 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* search(const T* first, const T* last, const T* s, size_t n)
+    {
+      const size_t length = last - first;
+
+      if (n == 0U)
+      {
+        return first;
+      }
+
+      if (n > length)
+      {
+        return last;
+      }
+
+      if ((n < ETL_STRING_SEARCH_HORSPOOL_MIN_PATTERN) || (length < ETL_STRING_SEARCH_HORSPOOL_MIN_TEXT))
+      {
+        // Scan for the first character, then compare the rest.
+        const T* const limit = last - n + 1;
+
+        while (first != limit)
+        {
+          first = find_char(first, limit, *s);
+
+          if (first == limit)
+          {
+            break;
+          }
+
+          if (std::equal(s + 1, s + n, first + 1))
+          {
+            return first;
+          }
+
+          ++first;
+        }
+
+        return last;
+      }
+
+      // Boyer-Moore-Horspool.
+      // Shifts are held in bytes, indexed by the low byte of the character.
+      // Capping a shift, or sharing one between characters, only makes it
+      // shorter, so the search stays correct.
+      uint8_t skip[256];
+
+      memset(skip, int((n < 255U) ? n : 255U), sizeof(skip));
+
+      for (size_t i = 0U; i < (n - 1U); ++i)
+      {
+        const size_t shift = n - 1U - i;
+        skip[to_index(s[i]) & 0xFFU] = uint8_t((shift < 255U) ? shift : 255U);
+      }
+
+      const T  last_char = s[n - 1U];
+      const T* limit     = last - n;
+
+      while (first <= limit)
+      {
+        const T c = first[n - 1U];
+
+        if ((c == last_char) && std::equal(s, s + n - 1U, first))
+        {
+          return first;
+        }
+
+        first += skip[to_index(c) & 0xFFU];
+      }
+
+      return last;
+    }
+  }
+}
+
+#endif
@@ -46,5 +46,7 @@ SOFTWARE.
 #define ETL_NO_NULLPTR_SUPPORT 1
 #define ETL_NO_LARGE_CHAR_SUPPORT 1
 #define ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED 0
+#define ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED 0
+#define ETL_BUILTIN_PREFETCH_SUPPORTED 0
 
 #endif
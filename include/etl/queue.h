@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include <stddef.h>
 #include <stdint.h>
+#include <utility>
 
 #include "platform.h"
 #include "container.h"
@@ -296,7 +297,7 @@ namespace etl
     /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
     ///\param value The value to push to the queue.
     //*************************************************************************
-    void push(parameter_t value)
+    void push(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(!full(), ETL_ERROR(queue_full));
@@ -305,6 +306,22 @@ namespace etl
       base_t::add_in();
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Adds a value to the queue by moving it.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push(T&& value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+#endif
+      ::new (&p_buffer[in]) T(std::move(value));
+      base_t::add_in();
+    }
+#endif
+
     //*************************************************************************
     /// Allows a possibly more efficient 'push' by moving to the next input value
     /// and returning a reference to it.
@@ -328,6 +345,7 @@ namespace etl
     /// Constructs a value in the queue 'in place'.
     /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
     ///\param value The value to use to construct the item to push to the queue.
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     template <typename T1>
     void emplace(const T1& value1)
@@ -386,6 +404,23 @@ namespace etl
 
     //*************************************************************************
     /// Clears the queue to the empty state.
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// If asserts or exceptions are enabled, throws an etl::queue_full if the queue if already full.
+    ///\param args The arguments used to construct the item to push to the queue.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+#endif
+      ::new (&p_buffer[in]) T(std::forward<Args>(args)...);
+      base_t::add_in();
+    }
+#endif
+
     //*************************************************************************
     void clear()
     {
@@ -426,7 +461,7 @@ namespace etl
     //*************************************************************************
     void pop_into(reference destination)
     {
-      destination = front();
+      destination = ETL_MOVE(front());
       pop();
     }
 
@@ -439,7 +474,7 @@ namespace etl
     template <typename TContainer>
     void pop_into(TContainer& destination)
     {
-      destination.push(front());
+      destination.push(ETL_MOVE(front()));
       pop();
     }
 
@@ -457,6 +492,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iqueue& operator = (iqueue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -475,6 +525,23 @@ namespace etl
       }
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Make this a clone of the supplied queue by moving its elements.
+    /// The supplied queue is left empty.
+    //*************************************************************************
+    void move_clone(iqueue&& other)
+    {
+      clear();
+
+      while (!other.empty())
+      {
+        push(std::move(other.front()));
+        other.pop();
+      }
+    }
+#endif
+
     //*************************************************************************
     /// The constructor that is called from derived classes.
     //*************************************************************************
@@ -538,6 +605,17 @@ namespace etl
       etl::iqueue<T>::clone(rhs);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor
+    //*************************************************************************
+    queue(queue&& rhs)
+      : etl::iqueue<T>(reinterpret_cast<T*>(&buffer[0]), SIZE)
+    {
+      etl::iqueue<T>::move_clone(std::move(rhs));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -559,6 +637,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    queue& operator = (queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        etl::iqueue<T>::move_clone(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The uninitialised buffer of T used in the stack.
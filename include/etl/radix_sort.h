@@ -0,0 +1,639 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_SORT_INCLUDED
+#define ETL_RADIX_SORT_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <iterator>
+#include <algorithm>
+
+#include "platform.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "exception.h"
+#include "error_handler.h"
+
+#undef ETL_FILE
+#define ETL_FILE "56"
+
+//*****************************************************************************
+///\defgroup radix_sort radix_sort
+/// Radix and counting sorts for integer and fixed length keys.
+/// They do not allocate. The caller supplies a scratch buffer, such as an
+/// etl::array, at least as large as the range being sorted.
+/// All of the sorts are stable.
+///\ingroup algorithm
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for radix sorts.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_exception : public etl::exception
+  {
+  public:
+
+    radix_sort_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The scratch buffer is smaller than the range to sort.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_buffer_too_small : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_buffer_too_small(string_type file_name_, numeric_type line_number_)
+      : radix_sort_exception(ETL_ERROR_TEXT("radix_sort:buffer", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A counting sort key is outside of the range of the counts.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  class radix_sort_key_out_of_range : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_key_out_of_range(string_type file_name_, numeric_type line_number_)
+      : radix_sort_exception(ETL_ERROR_TEXT("radix_sort:range", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix_sort
+  {
+    enum
+    {
+      RADIX                        = 256, ///< One byte per pass.
+      MSD_INSERTION_SORT_THRESHOLD = 32   ///< MSD ranges smaller than this are insertion sorted.
+    };
+
+    //*************************************************************************
+    /// Uses the value itself as the key.
+    //*************************************************************************
+    template <typename T>
+    struct identity_key
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Maps an integral key to an unsigned value with the same order.
+    /// Signed keys have their sign bit flipped.
+    //*************************************************************************
+    template <typename TKey>
+    typename etl::make_unsigned<TKey>::type to_unsigned(TKey key)
+    {
+      typedef typename etl::make_unsigned<TKey>::type ukey_t;
+
+      ukey_t result = ukey_t(key);
+
+      if (etl::is_signed<TKey>::value)
+      {
+        result ^= ukey_t(ukey_t(1U) << ((8U * sizeof(TKey)) - 1U));
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Moves each element of [first, last) to its bucket in 'destination',
+    /// for the byte at 'shift'. Advances the offsets.
+    //*************************************************************************
+    template <typename TSource, typename TDestination, typename TKeyFunctor>
+    void scatter(TSource first, TSource last, TDestination destination, TKeyFunctor key, size_t* offsets, uint_least8_t shift)
+    {
+      while (first != last)
+      {
+        const size_t digit = size_t(to_unsigned(key(*first)) >> shift) & 0xFFU;
+
+        *(destination + offsets[digit]++) = *first;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves each key and value to its bucket, for the byte at 'shift'.
+    //*************************************************************************
+    template <typename TKeySource, typename TValueSource, typename TKeyDestination, typename TValueDestination>
+    void scatter_pairs(TKeySource key_first, TKeySource key_last, TValueSource value_first,
+                       TKeyDestination key_destination, TValueDestination value_destination,
+                       size_t* offsets, uint_least8_t shift)
+    {
+      while (key_first != key_last)
+      {
+        const size_t digit    = size_t(to_unsigned(*key_first) >> shift) & 0xFFU;
+        const size_t position = offsets[digit]++;
+
+        *(key_destination + position)   = *key_first;
+        *(value_destination + position) = *value_first;
+
+        ++key_first;
+        ++value_first;
+      }
+    }
+
+    //*************************************************************************
+    /// Counts the bytes of every key for every pass, in one read of the data.
+    /// Marks the passes where every key has the same byte as not needed, as
+    /// they would not change the order.
+    //*************************************************************************
+    template <typename TIterator, typename TKeyFunctor, typename TKey>
+    void histogram(TIterator first, TIterator last, TKeyFunctor key, size_t (&counts)[sizeof(TKey)][RADIX], bool (&needed)[sizeof(TKey)], TKey)
+    {
+      memset(counts, 0, sizeof(counts));
+
+      const size_t length = size_t(std::distance(first, last));
+
+      if (length == 0U)
+      {
+        for (size_t pass = 0U; pass < sizeof(TKey); ++pass)
+        {
+          needed[pass] = false;
+        }
+
+        return;
+      }
+
+      const typename etl::make_unsigned<TKey>::type first_key = to_unsigned(TKey(key(*first)));
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        const typename etl::make_unsigned<TKey>::type k = to_unsigned(TKey(key(*itr)));
+
+        for (size_t pass = 0U; pass < sizeof(TKey); ++pass)
+        {
+          ++counts[pass][size_t(k >> (8U * pass)) & 0xFFU];
+        }
+      }
+
+      for (size_t pass = 0U; pass < sizeof(TKey); ++pass)
+      {
+        needed[pass] = (counts[pass][size_t(first_key >> (8U * pass)) & 0xFFU] != length);
+      }
+    }
+
+    //*************************************************************************
+    /// Turns counts into the offsets of each bucket.
+    //*************************************************************************
+    inline void exclusive_sum(size_t* counts)
+    {
+      size_t sum = 0U;
+
+      for (size_t i = 0U; i < RADIX; ++i)
+      {
+        const size_t count = counts[i];
+        counts[i] = sum;
+        sum += count;
+      }
+    }
+
+    //*************************************************************************
+    /// LSD radix sort, one byte per pass, alternating between the data and
+    /// the scratch buffer.
+    /// The unused last parameter deduces the type of the key.
+    //*************************************************************************
+    template <typename TIterator, typename TScratch, typename TKeyFunctor, typename TKey>
+    void lsd_radix_sort(TIterator first, TIterator last, TScratch scratch, TKeyFunctor key, TKey)
+    {
+      ETL_STATIC_ASSERT(etl::is_integral<TKey>::value, "Radix sort keys must be integral");
+
+      size_t counts[sizeof(TKey)][RADIX];
+      bool   needed[sizeof(TKey)];
+
+      histogram(first, last, key, counts, needed, TKey());
+
+      const typename std::iterator_traits<TIterator>::difference_type length = std::distance(first, last);
+
+      bool in_scratch = false;
+
+      for (size_t pass = 0U; pass < sizeof(TKey); ++pass)
+      {
+        if (needed[pass])
+        {
+          exclusive_sum(counts[pass]);
+
+          if (in_scratch)
+          {
+            scatter(scratch, scratch + length, first, key, counts[pass], uint_least8_t(8U * pass));
+          }
+          else
+          {
+            scatter(first, last, scratch, key, counts[pass], uint_least8_t(8U * pass));
+          }
+
+          in_scratch = !in_scratch;
+        }
+      }
+
+      if (in_scratch)
+      {
+        std::copy(scratch, scratch + length, first);
+      }
+    }
+
+    //*************************************************************************
+    /// LSD radix sort of keys, with values moved alongside.
+    //*************************************************************************
+    template <typename TKeyIterator, typename TValueIterator, typename TKeyScratch, typename TValueScratch>
+    void lsd_radix_sort_pairs(TKeyIterator key_first, TKeyIterator key_last, TValueIterator value_first,
+                              TKeyScratch key_scratch, TValueScratch value_scratch)
+    {
+      typedef typename std::iterator_traits<TKeyIterator>::value_type key_t;
+
+      ETL_STATIC_ASSERT(etl::is_integral<key_t>::value, "Radix sort keys must be integral");
+
+      size_t counts[sizeof(key_t)][RADIX];
+      bool   needed[sizeof(key_t)];
+
+      histogram(key_first, key_last, identity_key<key_t>(), counts, needed, key_t());
+
+      const typename std::iterator_traits<TKeyIterator>::difference_type length = std::distance(key_first, key_last);
+
+      bool in_scratch = false;
+
+      for (size_t pass = 0U; pass < sizeof(key_t); ++pass)
+      {
+        if (needed[pass])
+        {
+          exclusive_sum(counts[pass]);
+
+          if (in_scratch)
+          {
+            scatter_pairs(key_scratch, key_scratch + length, value_scratch, key_first, value_first, counts[pass], uint_least8_t(8U * pass));
+          }
+          else
+          {
+            scatter_pairs(key_first, key_last, value_first, key_scratch, value_scratch, counts[pass], uint_least8_t(8U * pass));
+          }
+
+          in_scratch = !in_scratch;
+        }
+      }
+
+      if (in_scratch)
+      {
+        std::copy(key_scratch,   key_scratch + length,   key_first);
+        std::copy(value_scratch, value_scratch + length, value_first);
+      }
+    }
+
+    //*************************************************************************
+    /// Compares fixed length keys from a given byte onwards.
+    //*************************************************************************
+    template <typename TKeyFunctor>
+    struct fixed_length_compare
+    {
+      fixed_length_compare(TKeyFunctor key_, size_t offset_, size_t length_)
+        : key(key_),
+          offset(offset_),
+          length(length_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T& lhs, const T& rhs) const
+      {
+        return memcmp(reinterpret_cast<const uint8_t*>(key(lhs)) + offset,
+                      reinterpret_cast<const uint8_t*>(key(rhs)) + offset,
+                      length - offset) < 0;
+      }
+
+      TKeyFunctor key;
+      size_t      offset;
+      size_t      length;
+    };
+
+    //*************************************************************************
+    /// The byte of the key at 'depth'.
+    //*************************************************************************
+    template <typename TKeyFunctor, typename T>
+    size_t byte_at(TKeyFunctor key, const T& value, size_t depth)
+    {
+      return reinterpret_cast<const uint8_t*>(key(value))[depth];
+    }
+
+    //*************************************************************************
+    /// Sorts [first, last) into buckets by the byte at 'depth'.
+    /// The counts are local, so that they are not held during recursion.
+    //*************************************************************************
+    template <typename TIterator, typename TScratch, typename TKeyFunctor>
+    void msd_distribute(TIterator first, TIterator last, TScratch scratch, TKeyFunctor key, size_t depth)
+    {
+      size_t counts[RADIX];
+      memset(counts, 0, sizeof(counts));
+
+      const size_t length = size_t(std::distance(first, last));
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        ++counts[byte_at(key, *itr, depth)];
+      }
+
+      // All in one bucket, so already in order.
+      if (counts[byte_at(key, *first, depth)] == length)
+      {
+        return;
+      }
+
+      exclusive_sum(counts);
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        *(scratch + counts[byte_at(key, *itr, depth)]++) = *itr;
+      }
+
+      std::copy(scratch, scratch + length, first);
+    }
+
+    //*************************************************************************
+    /// MSD radix sort of keys of 'key_length' bytes.
+    /// The recursion depth is at most the key length.
+    //*************************************************************************
+    template <typename TIterator, typename TScratch, typename TKeyFunctor>
+    void msd_radix_sort(TIterator first, TIterator last, TScratch scratch, TKeyFunctor key, size_t key_length, size_t depth)
+    {
+      if (std::distance(first, last) < MSD_INSERTION_SORT_THRESHOLD)
+      {
+        etl::private_algorithm::insertion_sort(first, last, fixed_length_compare<TKeyFunctor>(key, depth, key_length));
+        return;
+      }
+
+      msd_distribute(first, last, scratch, key, depth);
+
+      if ((depth + 1U) == key_length)
+      {
+        return;
+      }
+
+      // Sort each bucket on the next byte.
+      TIterator bucket = first;
+
+      while (bucket != last)
+      {
+        const size_t digit = byte_at(key, *bucket, depth);
+
+        TIterator bucket_end = bucket;
+
+        while ((++bucket_end != last) && (byte_at(key, *bucket_end, depth) == digit))
+        {
+        }
+
+        if (std::distance(bucket, bucket_end) > 1)
+        {
+          msd_radix_sort(bucket, bucket_end, scratch, key, key_length, depth + 1U);
+        }
+
+        bucket = bucket_end;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral values with an LSD radix sort, one byte per pass.
+  /// Signed values are supported. Passes where every value has the same byte
+  /// are skipped. The sort is stable.
+  /// Uses sizeof(T) * 256 * sizeof(size_t) bytes of stack for the counts.
+  ///\param scratch_first The start of a buffer of at least (last - first) elements.
+  ///\param scratch_last  The end of the buffer.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TScratch>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch_first, TScratch scratch_last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_t;
+
+    if (std::distance(scratch_first, scratch_last) < std::distance(first, last))
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_buffer_too_small));
+    }
+    else if (first != last)
+    {
+      etl::private_radix_sort::lsd_radix_sort(first, last, scratch_first, etl::private_radix_sort::identity_key<value_t>(), value_t());
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts values by an integral key with an LSD radix sort.
+  ///\param scratch_first The start of a buffer of at least (last - first) elements.
+  ///\param scratch_last  The end of the buffer.
+  ///\param key           Returns the integral key of a value.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TScratch, typename TKeyFunctor>
+  void radix_sort(TIterator first, TIterator last, TScratch scratch_first, TScratch scratch_last, TKeyFunctor key)
+  {
+    if (std::distance(scratch_first, scratch_last) < std::distance(first, last))
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_buffer_too_small));
+    }
+    else if (first != last)
+    {
+      etl::private_radix_sort::lsd_radix_sort(first, last, scratch_first, key, key(*first));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral keys with an LSD radix sort, moving the values in
+  /// [value_first, value_first + (key_last - key_first)) with them.
+  /// Sorting the keys apart from the values moves fewer bytes per pass.
+  ///\param key_scratch_first   The start of a key buffer of at least (key_last - key_first) elements.
+  ///\param key_scratch_last    The end of the key buffer.
+  ///\param value_scratch_first The start of a value buffer of the same size.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TKeyIterator, typename TValueIterator, typename TKeyScratch, typename TValueScratch>
+  void radix_sort_by_key(TKeyIterator   key_first,
+                         TKeyIterator   key_last,
+                         TValueIterator value_first,
+                         TKeyScratch    key_scratch_first,
+                         TKeyScratch    key_scratch_last,
+                         TValueScratch  value_scratch_first)
+  {
+    if (std::distance(key_scratch_first, key_scratch_last) < std::distance(key_first, key_last))
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_buffer_too_small));
+    }
+    else if (key_first != key_last)
+    {
+      etl::private_radix_sort::lsd_radix_sort_pairs(key_first, key_last, value_first, key_scratch_first, value_scratch_first);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts values by a fixed length key with an MSD radix sort.
+  /// Keys are ordered as by memcmp, so fixed length strings sort
+  /// lexicographically, and shorter strings padded with zeros sort first.
+  /// Small buckets are insertion sorted. The sort is stable.
+  ///\tparam KEY_LENGTH   The length of every key in bytes.
+  ///\param scratch_first The start of a buffer of at least (last - first) elements.
+  ///\param scratch_last  The end of the buffer.
+  ///\param key           Returns a pointer to the KEY_LENGTH bytes of the key of a value.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <const size_t KEY_LENGTH, typename TIterator, typename TScratch, typename TKeyFunctor>
+  void msd_radix_sort(TIterator first, TIterator last, TScratch scratch_first, TScratch scratch_last, TKeyFunctor key)
+  {
+    ETL_STATIC_ASSERT(KEY_LENGTH != 0U, "The key length must not be zero");
+
+    if (std::distance(scratch_first, scratch_last) < std::distance(first, last))
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_buffer_too_small));
+    }
+    else if (first != last)
+    {
+      etl::private_radix_sort::msd_radix_sort(first, last, scratch_first, key, KEY_LENGTH, 0U);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral values in the range [0, counts_last - counts_first) by
+  /// counting them, then writing them back in order.
+  /// Needs no scratch buffer, other than the counts.
+  ///\param counts_first The start of a buffer of counts, one per possible value.
+  ///\param counts_last  The end of the counts.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TCountIterator>
+  void counting_sort(TIterator first, TIterator last, TCountIterator counts_first, TCountIterator counts_last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type      value_t;
+    typedef typename std::iterator_traits<TCountIterator>::value_type count_t;
+
+    ETL_STATIC_ASSERT(etl::is_integral<value_t>::value, "Counting sort values must be integral");
+
+    const size_t range = size_t(std::distance(counts_first, counts_last));
+
+    std::fill(counts_first, counts_last, count_t(0));
+
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      const value_t value = *itr;
+
+      // Negative values convert to large indexes.
+      if (size_t(value) >= range)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_key_out_of_range));
+        return;
+      }
+
+      ++*(counts_first + size_t(value));
+    }
+
+    TIterator output = first;
+
+    for (size_t value = 0U; value < range; ++value)
+    {
+      output = std::fill_n(output, *(counts_first + value), value_t(value));
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts values by a key in the range [0, counts_last - counts_first).
+  /// The sort is stable.
+  ///\param scratch_first The start of a buffer of at least (last - first) elements.
+  ///\param scratch_last  The end of the buffer.
+  ///\param counts_first  The start of a buffer of counts, one per possible key.
+  ///\param counts_last   The end of the counts.
+  ///\param key           Returns the key of a value.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TScratch, typename TCountIterator, typename TKeyFunctor>
+  void counting_sort(TIterator      first,
+                     TIterator      last,
+                     TScratch       scratch_first,
+                     TScratch       scratch_last,
+                     TCountIterator counts_first,
+                     TCountIterator counts_last,
+                     TKeyFunctor    key)
+  {
+    typedef typename std::iterator_traits<TCountIterator>::value_type count_t;
+
+    const size_t range = size_t(std::distance(counts_first, counts_last));
+
+    if (std::distance(scratch_first, scratch_last) < std::distance(first, last))
+    {
+      ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_buffer_too_small));
+      return;
+    }
+
+    std::fill(counts_first, counts_last, count_t(0));
+
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      const size_t index = size_t(key(*itr));
+
+      if (index >= range)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::radix_sort_key_out_of_range));
+        return;
+      }
+
+      ++*(counts_first + index);
+    }
+
+    // Counts to offsets.
+    count_t sum = count_t(0);
+
+    for (TCountIterator itr = counts_first; itr != counts_last; ++itr)
+    {
+      const count_t count = *itr;
+      *itr = sum;
+      sum += count;
+    }
+
+    for (TIterator itr = first; itr != last; ++itr)
+    {
+      *(scratch_first + size_t((*(counts_first + size_t(key(*itr))))++)) = *itr;
+    }
+
+    std::copy(scratch_first, scratch_first + std::distance(first, last), first);
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -31,10 +31,14 @@ SOFTWARE.
 #ifndef ETL_RANDOM_INCLUDED
 #define ETL_RANDOM_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
+#include <iterator>
 
 #include "platform.h"
 
+#include "private/minmax_push.h"
+
 namespace etl
 {
   //***************************************************************************
@@ -162,6 +166,630 @@ namespace etl
     uint32_t value1;
     uint32_t value2;
   };
+
+  namespace private_random
+  {
+    //*************************************************************************
+    inline uint32_t rotl(uint32_t value, uint32_t shift)
+    {
+      return (value << shift) | (value >> (32U - shift));
+    }
+
+    //*************************************************************************
+    inline uint64_t rotl(uint64_t value, uint32_t shift)
+    {
+      return (value << shift) | (value >> (64U - shift));
+    }
+
+    //*************************************************************************
+    inline uint32_t rotr(uint32_t value, uint32_t shift)
+    {
+      return (value >> shift) | (value << ((0U - shift) & 31U));
+    }
+
+    //*************************************************************************
+    /// Expands a seed into well mixed state words.
+    /// http://xoshiro.di.unimi.it/splitmix64.c
+    //*************************************************************************
+    inline uint64_t splitmix64(uint64_t& x)
+    {
+      uint64_t z = (x += 0x9E3779B97F4A7C15);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+      return z ^ (z >> 31);
+    }
+
+    //*************************************************************************
+    /// The top 32 bits of a result.
+    //*************************************************************************
+    inline uint32_t top32(uint32_t value)
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    inline uint32_t top32(uint64_t value)
+    {
+      return uint32_t(value >> 32);
+    }
+  }
+
+  //***************************************************************************
+  /// The common interface of the non-virtual random number engines.
+  /// Calls are resolved at compile time and can be inlined.
+  /// Engines satisfy the C++11 UniformRandomBitGenerator requirements, so may
+  /// also be used with the distributions and algorithms of the STL.
+  ///\tparam TEngine The derived engine, which supplies 'next()'.
+  ///\tparam TResult The type of the result, uint32_t or uint64_t.
+  //***************************************************************************
+  template <typename TEngine, typename TResult>
+  class random_engine
+  {
+  public:
+
+    typedef TResult result_type;
+
+    //*************************************************************************
+    static ETL_CONSTEXPR result_type min()
+    {
+      return result_type(0U);
+    }
+
+    //*************************************************************************
+    static ETL_CONSTEXPR result_type max()
+    {
+      return result_type(~result_type(0U));
+    }
+
+    //*************************************************************************
+    /// Get the next random number.
+    //*************************************************************************
+    result_type operator()()
+    {
+      return engine().next();
+    }
+
+    //*************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    /// Every value is equally likely. Uses a multiply and shift, only
+    /// dividing when a rare rejection test is needed.
+    /// See "Fast Random Integer Generation in an Interval", Daniel Lemire, 2019.
+    //*************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      const uint32_t r = high - low + 1U;
+
+      uint32_t n = private_random::top32(engine().next());
+
+      if (r == 0U)
+      {
+        // The full 32 bit range.
+        return n;
+      }
+
+      uint64_t m = uint64_t(n) * r;
+      uint32_t l = uint32_t(m);
+
+      if (l < r)
+      {
+        const uint32_t threshold = (0U - r) % r;
+
+        while (l < threshold)
+        {
+          n = private_random::top32(engine().next());
+          m = uint64_t(n) * r;
+          l = uint32_t(m);
+        }
+      }
+
+      return low + uint32_t(m >> 32);
+    }
+
+    //*************************************************************************
+    /// Fills a range with random numbers.
+    //*************************************************************************
+    template <typename TIterator>
+    void fill(TIterator first, TIterator last)
+    {
+      TEngine& e = engine();
+
+      while (first != last)
+      {
+        *first++ = e.next();
+      }
+    }
+
+  protected:
+
+    random_engine()
+    {
+    }
+
+  private:
+
+    TEngine& engine()
+    {
+      return *static_cast<TEngine*>(this);
+    }
+  };
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// Uses the xoshiro256** algorithm.
+  /// The period is 2^256 - 1. For parallel use, give each worker a copy of
+  /// one generator, calling jump() once more for each, so that each worker
+  /// has its own 2^128 values of the sequence.
+  /// http://xoshiro.di.unimi.it
+  //***************************************************************************
+  class random_xoshiro256ss : public etl::random_engine<random_xoshiro256ss, uint64_t>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The seed value.
+    //*************************************************************************
+    explicit random_xoshiro256ss(uint64_t seed = 0U)
+    {
+      initialise(seed);
+    }
+
+    //*************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is expanded from the seed with splitmix64, so is never zero.
+    ///\param seed The new seed value.
+    //*************************************************************************
+    void initialise(uint64_t seed)
+    {
+      state[0] = private_random::splitmix64(seed);
+      state[1] = private_random::splitmix64(seed);
+      state[2] = private_random::splitmix64(seed);
+      state[3] = private_random::splitmix64(seed);
+    }
+
+    //*************************************************************************
+    /// Get the next random number.
+    //*************************************************************************
+    uint64_t next()
+    {
+      const uint64_t result = private_random::rotl(state[1] * 5U, 7U) * 9U;
+      const uint64_t t      = state[1] << 17;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = private_random::rotl(state[3], 45U);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Advances the sequence by 2^128 values.
+    /// Generates 2^128 non-overlapping subsequences.
+    //*************************************************************************
+    void jump()
+    {
+      static const uint64_t polynomial[4] =
+      {
+        0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C
+      };
+
+      jump(polynomial);
+    }
+
+    //*************************************************************************
+    /// Advances the sequence by 2^192 values.
+    /// Generates 2^64 starting points, from each of which jump() generates
+    /// 2^64 non-overlapping subsequences.
+    //*************************************************************************
+    void long_jump()
+    {
+      static const uint64_t polynomial[4] =
+      {
+        0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635
+      };
+
+      jump(polynomial);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Applies a jump polynomial, x^n mod the characteristic polynomial.
+    //*************************************************************************
+    void jump(const uint64_t (&polynomial)[4])
+    {
+      uint64_t s0 = 0U;
+      uint64_t s1 = 0U;
+      uint64_t s2 = 0U;
+      uint64_t s3 = 0U;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        for (uint32_t b = 0U; b < 64U; ++b)
+        {
+          if ((polynomial[i] & (uint64_t(1U) << b)) != 0U)
+          {
+            s0 ^= state[0];
+            s1 ^= state[1];
+            s2 ^= state[2];
+            s3 ^= state[3];
+          }
+
+          next();
+        }
+      }
+
+      state[0] = s0;
+      state[1] = s1;
+      state[2] = s2;
+      state[3] = s3;
+    }
+
+    uint64_t state[4];
+  };
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the PCG-XSH-RR algorithm with 64 bits of state.
+  /// Each of the 2^63 streams is a different sequence, with a period of 2^64.
+  /// discard() skips ahead in O(log n), so one stream may also be split into
+  /// non-overlapping blocks.
+  /// http://www.pcg-random.org
+  //***************************************************************************
+  class random_pcg32 : public etl::random_engine<random_pcg32, uint32_t>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The seed value.
+    //*************************************************************************
+    explicit random_pcg32(uint64_t seed = 0U)
+      : increment(DEFAULT_INCREMENT)
+    {
+      initialise(seed);
+    }
+
+    //*************************************************************************
+    /// Constructor with seed value and stream.
+    ///\param seed   The seed value.
+    ///\param stream The stream. Only the lower 63 bits are used.
+    //*************************************************************************
+    random_pcg32(uint64_t seed, uint64_t stream)
+    {
+      initialise(seed, stream);
+    }
+
+    //*************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The stream is unchanged.
+    ///\param seed The new seed value.
+    //*************************************************************************
+    void initialise(uint64_t seed)
+    {
+      state = 0U;
+      next();
+      state += seed;
+      next();
+    }
+
+    //*************************************************************************
+    /// Initialises the sequence with a new seed value and stream.
+    ///\param seed   The new seed value.
+    ///\param stream The stream. Only the lower 63 bits are used.
+    //*************************************************************************
+    void initialise(uint64_t seed, uint64_t stream)
+    {
+      increment = (stream << 1U) | 1U;
+      initialise(seed);
+    }
+
+    //*************************************************************************
+    /// Advances the sequence by n values.
+    /// See "Random Number Generation with Arbitrary Strides", F. Brown, 1994.
+    //*************************************************************************
+    void discard(uint64_t n)
+    {
+      uint64_t multiplier     = MULTIPLIER;
+      uint64_t plus           = increment;
+      uint64_t acc_multiplier = 1U;
+      uint64_t acc_plus       = 0U;
+
+      while (n != 0U)
+      {
+        if ((n & 1U) != 0U)
+        {
+          acc_multiplier *= multiplier;
+          acc_plus        = (acc_plus * multiplier) + plus;
+        }
+
+        plus        = (multiplier + 1U) * plus;
+        multiplier *= multiplier;
+        n >>= 1U;
+      }
+
+      state = (acc_multiplier * state) + acc_plus;
+    }
+
+    //*************************************************************************
+    /// Get the next random number.
+    //*************************************************************************
+    uint32_t next()
+    {
+      const uint64_t old = state;
+
+      state = (old * MULTIPLIER) + increment;
+
+      return private_random::rotr(uint32_t(((old >> 18) ^ old) >> 27), uint32_t(old >> 59));
+    }
+
+  private:
+
+    static const uint64_t MULTIPLIER        = 6364136223846793005U;
+    static const uint64_t DEFAULT_INCREMENT = 1442695040888963407U;
+
+    uint64_t state;
+    uint64_t increment;
+  };
+
+  //***************************************************************************
+  /// A 32 bit counter based random number generator.
+  /// Uses the Philox4x32-10 algorithm. Each output block is a function of a
+  /// 128 bit counter and a 64 bit key only, so blocks are independent of
+  /// each other and 'fill' computes several at once.
+  /// The upper 64 bits of the counter hold the stream, so the 2^64 streams
+  /// of a seed never overlap, each having 2^66 values.
+  /// See "Parallel Random Numbers: As Easy as 1, 2, 3", Salmon et al, 2011.
+  //***************************************************************************
+  class random_philox4x32 : public etl::random_engine<random_philox4x32, uint32_t>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The seed value, used as the key.
+    //*************************************************************************
+    explicit random_philox4x32(uint64_t seed = 0U)
+    {
+      initialise(seed, 0U);
+    }
+
+    //*************************************************************************
+    /// Constructor with seed value and stream.
+    ///\param seed   The seed value, used as the key.
+    ///\param stream The stream.
+    //*************************************************************************
+    random_philox4x32(uint64_t seed, uint64_t stream)
+    {
+      initialise(seed, stream);
+    }
+
+    //*************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The position in the stream is reset to the start.
+    ///\param seed The new seed value, used as the key.
+    //*************************************************************************
+    void initialise(uint64_t seed)
+    {
+      initialise(seed, uint64_t(counter[2]) | (uint64_t(counter[3]) << 32));
+    }
+
+    //*************************************************************************
+    /// Initialises the sequence with a new seed value and stream.
+    ///\param seed   The new seed value, used as the key.
+    ///\param stream The stream.
+    //*************************************************************************
+    void initialise(uint64_t seed, uint64_t stream)
+    {
+      key[0] = uint32_t(seed);
+      key[1] = uint32_t(seed >> 32);
+
+      counter[0] = 0U;
+      counter[1] = 0U;
+      counter[2] = uint32_t(stream);
+      counter[3] = uint32_t(stream >> 32);
+
+      index = BLOCK_SIZE;
+    }
+
+    //*************************************************************************
+    /// Advances the sequence by n values, in constant time.
+    //*************************************************************************
+    void discard(uint64_t n)
+    {
+      // Use up the current block.
+      while ((index != BLOCK_SIZE) && (n != 0U))
+      {
+        ++index;
+        --n;
+      }
+
+      // Skip whole blocks.
+      const uint64_t blocks = n / BLOCK_SIZE;
+      const uint64_t low    = (uint64_t(counter[1]) << 32) | counter[0];
+      const uint64_t sum    = low + blocks;
+
+      counter[0] = uint32_t(sum);
+      counter[1] = uint32_t(sum >> 32);
+
+      // Within a stream, the counter does not carry into the stream bits.
+      // Skip part of the next block.
+      n %= BLOCK_SIZE;
+
+      if (n != 0U)
+      {
+        next();
+        index += size_t(n - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Get the next random number.
+    //*************************************************************************
+    uint32_t next()
+    {
+      if (index == BLOCK_SIZE)
+      {
+        generate_block(counter[0], counter[1], counter[2], counter[3], block);
+        increment_counter(1U);
+        index = 0U;
+      }
+
+      return block[index++];
+    }
+
+    //*************************************************************************
+    /// Fills a range with random numbers.
+    /// Gives the same sequence as repeated calls to operator().
+    //*************************************************************************
+    template <typename TIterator>
+    void fill(TIterator first, TIterator last)
+    {
+      // Use up the current block.
+      while ((index != BLOCK_SIZE) && (first != last))
+      {
+        *first++ = block[index++];
+      }
+
+      // Whole groups of blocks, computed side by side.
+      uint32_t group[GROUP_SIZE][BLOCK_SIZE];
+
+      size_t remaining = size_t(std::distance(first, last));
+
+      while (remaining >= (GROUP_SIZE * BLOCK_SIZE))
+      {
+        generate_group(group);
+        remaining -= GROUP_SIZE * BLOCK_SIZE;
+
+        for (size_t b = 0U; b < GROUP_SIZE; ++b)
+        {
+          for (size_t i = 0U; i < BLOCK_SIZE; ++i)
+          {
+            *first++ = group[b][i];
+          }
+        }
+      }
+
+      while (first != last)
+      {
+        *first++ = next();
+      }
+    }
+
+  private:
+
+    enum
+    {
+      BLOCK_SIZE = 4,
+      GROUP_SIZE = 8,
+      ROUNDS     = 10
+    };
+
+    static const uint32_t M0 = 0xD2511F53U;
+    static const uint32_t M1 = 0xCD9E8D57U;
+    static const uint32_t W0 = 0x9E3779B9U;
+    static const uint32_t W1 = 0xBB67AE85U;
+
+    //*************************************************************************
+    /// Generates the block for one counter value.
+    //*************************************************************************
+    void generate_block(uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3, uint32_t* output) const
+    {
+      uint32_t k0 = key[0];
+      uint32_t k1 = key[1];
+
+      for (int r = 0; r < ROUNDS; ++r)
+      {
+        const uint64_t p0 = uint64_t(M0) * c0;
+        const uint64_t p1 = uint64_t(M1) * c2;
+
+        c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        c1 = uint32_t(p1);
+        c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c3 = uint32_t(p0);
+
+        k0 += W0;
+        k1 += W1;
+      }
+
+      output[0] = c0;
+      output[1] = c1;
+      output[2] = c2;
+      output[3] = c3;
+    }
+
+    //*************************************************************************
+    /// Generates GROUP_SIZE consecutive blocks, lane by lane, so that the
+    /// rounds of the independent blocks overlap in the pipeline.
+    //*************************************************************************
+    void generate_group(uint32_t (&output)[GROUP_SIZE][BLOCK_SIZE])
+    {
+      uint32_t c0[GROUP_SIZE];
+      uint32_t c1[GROUP_SIZE];
+      uint32_t c2[GROUP_SIZE];
+      uint32_t c3[GROUP_SIZE];
+
+      for (size_t b = 0U; b < GROUP_SIZE; ++b)
+      {
+        c0[b] = counter[0];
+        c1[b] = counter[1];
+        c2[b] = counter[2];
+        c3[b] = counter[3];
+        increment_counter(1U);
+      }
+
+      uint32_t k0 = key[0];
+      uint32_t k1 = key[1];
+
+      for (int r = 0; r < ROUNDS; ++r)
+      {
+        for (size_t b = 0U; b < GROUP_SIZE; ++b)
+        {
+          const uint64_t p0 = uint64_t(M0) * c0[b];
+          const uint64_t p1 = uint64_t(M1) * c2[b];
+
+          c0[b] = uint32_t(p1 >> 32) ^ c1[b] ^ k0;
+          c1[b] = uint32_t(p1);
+          c2[b] = uint32_t(p0 >> 32) ^ c3[b] ^ k1;
+          c3[b] = uint32_t(p0);
+        }
+
+        k0 += W0;
+        k1 += W1;
+      }
+
+      for (size_t b = 0U; b < GROUP_SIZE; ++b)
+      {
+        output[b][0] = c0[b];
+        output[b][1] = c1[b];
+        output[b][2] = c2[b];
+        output[b][3] = c3[b];
+      }
+    }
+
+    //*************************************************************************
+    /// Adds to the 64 bit position in the stream.
+    //*************************************************************************
+    void increment_counter(uint32_t n)
+    {
+      counter[0] += n;
+
+      if (counter[0] < n)
+      {
+        ++counter[1];
+      }
+    }
+
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t block[BLOCK_SIZE];
+    size_t   index;
+  };
 }
 
+#include "private/minmax_pop.h"
+
 #endif
@@ -35,12 +35,14 @@ SOFTWARE.
 
 #include "platform.h"
 #include "vector.h"
+#include "binary.h"
 #include "error_handler.h"
 #include "debug_count.h"
 #include "type_traits.h"
 #include "parameter_type.h"
 #include "exception.h"
 #include "static_assert.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "30"
@@ -50,6 +52,10 @@ SOFTWARE.
 /// An reference_flat_map with the capacity defined at compile time.
 /// Has insertion of O(N) and search of O(logN)
 /// Duplicate entries are not allowed.
+/// The keys are copied to a contiguous array that is searched without
+/// dereferencing the elements. A map that is built once may be frozen, which
+/// reorders the key array into an Eytzinger (breadth first) layout.
+/// The set and multi containers still search through the element pointers.
 ///\ingroup containers
 //*****************************************************************************
 
@@ -112,6 +118,7 @@ namespace etl
   protected:
 
     typedef etl::ivector<value_type*> lookup_t;
+    typedef etl::ivector<TKey>        key_lookup_t;
 
   public:
 
@@ -344,6 +351,19 @@ namespace etl
       }
     };
 
+    //*********************************************************************
+    /// How to compare lookup entries.
+    //*********************************************************************
+    class pointer_compare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return key_compare()(lhs->first, rhs->first);
+      }
+    };
+
   public:
 
     //*********************************************************************
@@ -530,11 +550,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the reference_flat_map from a range sorted by key.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If ETL_THROW_EXCEPTIONS & ETL_DEBUG are defined, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_map_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -562,18 +597,31 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_map.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Of several values in the range with the same key, the first is inserted, as by single inserts.
     /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values, sorted by key, to the reference_flat_map.
+    /// The range is merged with the existing elements in one pass.
+    /// Of several values in the range with the same key, the first is inserted.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -591,7 +639,7 @@ namespace etl
       }
       else
       {
-        lookup.erase(i_element.ilookup);
+        erase(i_element);
         return 1;
       }
     }
@@ -602,6 +650,8 @@ namespace etl
     //*********************************************************************
     void erase(iterator i_element)
     {
+      thaw();
+      keys.erase(keys.begin() + std::distance(lookup.begin(), i_element.ilookup));
       lookup.erase(i_element.ilookup);
     }
 
@@ -614,6 +664,9 @@ namespace etl
     //*********************************************************************
     void erase(iterator first, iterator last)
     {
+      thaw();
+      keys.erase(keys.begin() + std::distance(lookup.begin(), first.ilookup),
+                 keys.begin() + std::distance(lookup.begin(), last.ilookup));
       lookup.erase(first.ilookup, last.ilookup);
     }
 
@@ -623,6 +676,8 @@ namespace etl
     void clear()
     {
       lookup.clear();
+      keys.clear();
+      is_frozen = false;
     }
 
     //*********************************************************************
@@ -632,21 +687,7 @@ namespace etl
     //*********************************************************************
     iterator find(key_parameter_t key)
     {
-      iterator itr = lower_bound(key);
-
-      if (itr != end())
-      {
-        if (!key_compare()(itr->first, key) && !key_compare()(key, itr->first))
-        {
-          return itr;
-        }
-        else
-        {
-          return end();
-        }
-      }
-
-      return end();
+      return iterator(lookup.begin() + find_index(key));
     }
 
     //*********************************************************************
@@ -656,21 +697,7 @@ namespace etl
     //*********************************************************************
     const_iterator find(key_parameter_t key) const
     {
-      const_iterator itr = lower_bound(key);
-
-      if (itr != end())
-      {
-        if (!key_compare()(itr->first, key) && !key_compare()(key, itr->first))
-        {
-          return itr;
-        }
-        else
-        {
-          return end();
-        }
-      }
-
-      return end();
+      return const_iterator(lookup.cbegin() + find_index(key));
     }
 
     //*********************************************************************
@@ -680,7 +707,7 @@ namespace etl
     //*********************************************************************
     size_t count(key_parameter_t key) const
     {
-      return (find(key) == end()) ? 0 : 1;
+      return (find_index(key) == size()) ? 0 : 1;
     }
 
     //*********************************************************************
@@ -690,7 +717,7 @@ namespace etl
     //*********************************************************************
     iterator lower_bound(key_parameter_t key)
     {
-      return std::lower_bound(begin(), end(), key, compare());
+      return iterator(lookup.begin() + search(key, lower_step()));
     }
 
     //*********************************************************************
@@ -700,7 +727,7 @@ namespace etl
     //*********************************************************************
     const_iterator lower_bound(key_parameter_t key) const
     {
-      return std::lower_bound(cbegin(), cend(), key, compare());
+      return const_iterator(lookup.cbegin() + search(key, lower_step()));
     }
 
     //*********************************************************************
@@ -710,7 +737,7 @@ namespace etl
     //*********************************************************************
     iterator upper_bound(key_parameter_t key)
     {
-      return std::upper_bound(begin(), end(), key, compare());
+      return iterator(lookup.begin() + search(key, upper_step()));
     }
 
     //*********************************************************************
@@ -720,7 +747,7 @@ namespace etl
     //*********************************************************************
     const_iterator upper_bound(key_parameter_t key) const
     {
-      return std::upper_bound(begin(), end(), key, compare());
+      return const_iterator(lookup.cbegin() + search(key, upper_step()));
     }
 
     //*********************************************************************
@@ -730,9 +757,10 @@ namespace etl
     //*********************************************************************
     std::pair<iterator, iterator> equal_range(key_parameter_t key)
     {
-      iterator i_lower = std::lower_bound(begin(), end(), key, compare());
+      const size_t index = search(key, lower_step());
+      typename lookup_t::iterator i_lower = lookup.begin() + index;
 
-      return std::make_pair(i_lower, std::upper_bound(i_lower, end(), key, compare()));
+      return std::make_pair(iterator(i_lower), iterator(i_lower + (matches(index, key) ? 1 : 0)));
     }
 
     //*********************************************************************
@@ -742,9 +770,74 @@ namespace etl
     //*********************************************************************
     std::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
     {
-      const_iterator i_lower = std::lower_bound(cbegin(), cend(), key, compare());
+      const size_t index = search(key, lower_step());
+      typename lookup_t::const_iterator i_lower = lookup.cbegin() + index;
+
+      return std::make_pair(const_iterator(i_lower), const_iterator(i_lower + (matches(index, key) ? 1 : 0)));
+    }
+
+    //*********************************************************************
+    /// Freezes the reference_flat_map for read only use.
+    /// The key array is reordered into an Eytzinger layout, so that the first
+    /// levels of every search share the same few cache lines.
+    /// Inserting or erasing elements thaws the map again.
+    //*********************************************************************
+    void freeze()
+    {
+      const size_t n = lookup.size();
+
+      top_level = 0;
+
+      while ((size_t(2) << top_level) <= n)
+      {
+        ++top_level;
+      }
+
+      last_level_count = n - ((size_t(1) << top_level) - 1);
+
+      keys.clear();
+
+      size_t depth = 0;
+
+      for (size_t k = 1; k <= n; ++k)
+      {
+        if (k == (size_t(2) << depth))
+        {
+          ++depth;
+        }
+
+        keys.push_back(lookup[eytzinger_rank(k, depth)]->first);
+      }
+
+      is_frozen = true;
+    }
+
+    //*********************************************************************
+    /// Restores the sorted key array of a frozen reference_flat_map.
+    /// Does nothing if the map is not frozen.
+    //*********************************************************************
+    void thaw()
+    {
+      if (is_frozen)
+      {
+        keys.clear();
+
+        for (typename lookup_t::const_iterator itr = lookup.begin(); itr != lookup.end(); ++itr)
+        {
+          keys.push_back((*itr)->first);
+        }
+
+        is_frozen = false;
+      }
+    }
 
-      return std::make_pair(i_lower, std::upper_bound(i_lower, cend(), key, compare()));
+    //*********************************************************************
+    /// Checks the 'frozen' state of the reference_flat_map.
+    ///\return <b>true</b> if frozen.
+    //*********************************************************************
+    bool frozen() const
+    {
+      return is_frozen;
     }
 
     //*************************************************************************
@@ -806,8 +899,12 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    ireference_flat_map(lookup_t& lookup_)
-      : lookup(lookup_)
+    ireference_flat_map(lookup_t& lookup_, key_lookup_t& keys_)
+      : lookup(lookup_),
+        keys(keys_),
+        is_frozen(false),
+        top_level(0),
+        last_level_count(0)
     {
     }
 
@@ -825,6 +922,8 @@ namespace etl
         // At the end.
         ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_map_full));
 
+        thaw();
+        keys.push_back(value.first);
         lookup.push_back(&value);
         result.first = --end();
         result.second = true;
@@ -839,6 +938,8 @@ namespace etl
         {
           // A new one.
           ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_map_full));
+          thaw();
+          keys.insert(keys.begin() + std::distance(lookup.begin(), i_element.ilookup), value.first);
           lookup.insert(i_element.ilookup, &value);
           result.second = true;
         }
@@ -847,13 +948,200 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// Must be followed by sort_appended and merge_appended.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n'.
+    /// Those whose keys are already present are moved to begin() + n.
+    ///\return The number that were moved.
+    //*********************************************************************
+    size_t sort_appended(size_t n, bool sorted)
+    {
+      return etl::private_flat::prepare(lookup, n, sorted, true, pointer_compare());
+    }
+
+    //*********************************************************************
+    /// Merges the values appended after the first 'n' with the existing ones,
+    /// dropping the 'skip' values at begin() + n.
+    //*********************************************************************
+    void merge_appended(size_t n, size_t skip)
+    {
+      etl::private_flat::merge(lookup, n, skip, pointer_compare());
+
+      keys.clear();
+
+      for (typename lookup_t::const_iterator itr = lookup.begin(); itr != lookup.end(); ++itr)
+      {
+        keys.push_back((*itr)->first);
+      }
+
+      is_frozen = false;
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = lookup.size();
+
+      while ((first != last) && !lookup.full())
+      {
+        append(*first++);
+      }
+
+      merge_appended(n, sort_appended(n, sorted));
+
+      // Any that did not fit may still be duplicates, so insert one at a time.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     // Disable copy construction and assignment.
     ireference_flat_map(const ireference_flat_map&);
     ireference_flat_map& operator = (const ireference_flat_map&);
 
-    lookup_t& lookup;
+    //*********************************************************************
+    /// Search step for lower_bound. Moves past keys less than 'key'.
+    //*********************************************************************
+    struct lower_step
+    {
+      bool operator ()(const key_type& element, key_parameter_t key) const
+      {
+        return key_compare()(element, key);
+      }
+    };
+
+    //*********************************************************************
+    /// Search step for upper_bound. Moves past keys not greater than 'key'.
+    //*********************************************************************
+    struct upper_step
+    {
+      bool operator ()(const key_type& element, key_parameter_t key) const
+      {
+        return !key_compare()(key, element);
+      }
+    };
+
+    //*********************************************************************
+    /// Returns the index of the first element that 'step' does not move past.
+    //*********************************************************************
+    template <typename TStep>
+    size_t search(key_parameter_t key, TStep step) const
+    {
+      return is_frozen ? search_eytzinger(key, step) : search_sorted(key, step);
+    }
+
+    //*********************************************************************
+    /// Branchless binary search of the sorted key array.
+    /// The probe position is selected arithmetically, so the compiler can
+    /// use a conditional move instead of an unpredictable branch.
+    //*********************************************************************
+    template <typename TStep>
+    size_t search_sorted(key_parameter_t key, TStep step) const
+    {
+      size_t n = keys.size();
+
+      if (n == 0)
+      {
+        return 0;
+      }
+
+      const key_type* first = keys.data();
+      const key_type* base  = first;
+
+      while (n > 1)
+      {
+        const size_t half = n / 2;
+        base += step(base[half], key) ? half : 0;
+        n -= half;
+      }
+
+      return size_t(base - first) + (step(*base, key) ? 1 : 0);
+    }
+
+    //*********************************************************************
+    /// Search of the Eytzinger ordered key array.
+    /// Node 'k' has children '2k' and '2k + 1', stored at index 'k - 1'.
+    /// The sixteen descendants four levels down are prefetched on each step,
+    /// if the first of them exists.
+    //*********************************************************************
+    template <typename TStep>
+    size_t search_eytzinger(key_parameter_t key, TStep step) const
+    {
+      const size_t     n     = keys.size();
+      const key_type*  nodes = keys.data();
+      size_t           k     = 1;
+      size_t           depth = 0;
+
+      while (k <= n)
+      {
+#if ETL_BUILTIN_PREFETCH_SUPPORTED
+        if ((k << 4) <= n)
+        {
+          __builtin_prefetch(nodes + ((k << 4) - 1));
+        }
+#endif
+        k = (k << 1) + (step(nodes[k - 1], key) ? 1 : 0);
+        ++depth;
+      }
+
+      // Undo the trailing moves to the right, and the last move to the left.
+      const size_t shift = size_t(etl::count_trailing_zeros(uint64_t(~k))) + 1;
+
+      k >>= shift;
+
+      return (k == 0) ? n : eytzinger_rank(k, depth - shift);
+    }
+
+    //*********************************************************************
+    /// Returns the sorted position of Eytzinger node 'k' at 'depth'.
+    /// The position in a perfect tree is corrected for the nodes missing from
+    /// the right of the bottom level.
+    //*********************************************************************
+    size_t eytzinger_rank(size_t k, size_t depth) const
+    {
+      const size_t rank   = ((((k - (size_t(1) << depth)) << 1) + 1) << (top_level - depth)) - 1;
+      const size_t before = (rank + 1) >> 1;
+
+      return rank - ((before > last_level_count) ? (before - last_level_count) : 0);
+    }
+
+    //*********************************************************************
+    /// Returns the index of the element matching 'key', or size() if none.
+    //*********************************************************************
+    size_t find_index(key_parameter_t key) const
+    {
+      const size_t index = search(key, lower_step());
+
+      return matches(index, key) ? index : lookup.size();
+    }
+
+    //*********************************************************************
+    /// Checks whether the element at 'index' matches 'key'.
+    //*********************************************************************
+    bool matches(size_t index, key_parameter_t key) const
+    {
+      return (index != lookup.size()) && !key_compare()(key, lookup[index]->first);
+    }
+
+    lookup_t&     lookup;
+    key_lookup_t& keys;
+    bool          is_frozen;
+    size_t        top_level;
+    size_t        last_level_count;
 
     //*************************************************************************
     /// Destructor.
@@ -916,7 +1204,7 @@ namespace etl
     /// Constructor.
     //*************************************************************************
     reference_flat_map()
-      : ireference_flat_map<TKey, TValue, TCompare>(lookup)
+      : ireference_flat_map<TKey, TValue, TCompare>(lookup, keys)
     {
     }
 
@@ -928,7 +1216,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     reference_flat_map(TIterator first, TIterator last)
-      : ireference_flat_map<TKey, TValue, TCompare>(lookup)
+      : ireference_flat_map<TKey, TValue, TCompare>(lookup, keys)
     {
       ireference_flat_map<TKey, TValue, TCompare>::assign(first, last);
     }
@@ -962,6 +1250,9 @@ namespace etl
 
     // The vector that stores pointers to the nodes.
     etl::vector<node_t*, MAX_SIZE> lookup;
+
+    // The vector that stores a copy of the keys.
+    etl::vector<TKey, MAX_SIZE> keys;
   };
 
 }
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "platform.h"
 #include "type_traits.h"
 #include "vector.h"
+#include "private/flat_merge.h"
 #include "pool.h"
 #include "error_handler.h"
 #include "exception.h"
@@ -312,6 +313,21 @@ namespace etl
 
     typedef typename etl::parameter_type<T>::type parameter_t;
 
+  private:
+
+    //*********************************************************************
+    /// How to compare lookup entries.
+    //*********************************************************************
+    class pointer_compare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return key_compare()(*lhs, *rhs);
+      }
+    };
+
   public:
 
     typedef std::reverse_iterator<iterator>       reverse_iterator;
@@ -442,11 +458,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the reference_flat_multiset from a sorted range.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_multiset_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -493,18 +524,30 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multiset.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// New values are placed before existing equal ones.
     /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_multiset.
+    /// The range is merged with the existing elements in one pass.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -773,8 +816,56 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// Must be followed by sort_appended and merge_appended.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n'.
+    //*********************************************************************
+    void sort_appended(size_t n, bool sorted)
+    {
+      etl::private_flat::prepare(lookup, n, sorted, false, pointer_compare());
+    }
+
+    //*********************************************************************
+    /// Merges the values appended after the first 'n' with the existing ones.
+    //*********************************************************************
+    void merge_appended(size_t n)
+    {
+      etl::private_flat::merge(lookup, n, 0, pointer_compare());
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = lookup.size();
+
+      while ((first != last) && !lookup.full())
+      {
+        append(*first++);
+      }
+
+      sort_appended(n, sorted);
+      merge_appended(n);
+
+      // Any that did not fit are inserted one at a time, to report the overflow.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     // Disable copy construction.
     ireference_flat_multiset(const ireference_flat_multiset&);
     ireference_flat_multiset& operator =(const ireference_flat_multiset&);
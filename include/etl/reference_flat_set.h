@@ -43,6 +43,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 #include "vector.h"
+#include "private/flat_merge.h"
 
 #undef ETL_FILE
 #define ETL_FILE "32"
@@ -312,6 +313,21 @@ namespace etl
 
     typedef typename etl::parameter_type<T>::type parameter_t;
 
+  private:
+
+    //*********************************************************************
+    /// How to compare lookup entries.
+    //*********************************************************************
+    class pointer_compare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return key_compare()(*lhs, *rhs);
+      }
+    };
+
   public:
 
     typedef std::reverse_iterator<iterator>       reverse_iterator;
@@ -442,11 +458,26 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
 
-      while (first != last)
-      {
-        insert(*first++);
-      }
+    //*********************************************************************
+    /// Assigns values to the reference_flat_set from a sorted range.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = std::distance(first, last);
+      ETL_ASSERT(d <= difference_type(capacity()), ETL_ERROR(flat_set_full));
+#endif
+
+      clear();
+      insert_sorted(first, last);
     }
 
     //*********************************************************************
@@ -474,18 +505,31 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The range is sorted and merged with the existing elements in one pass.
+    /// Of several equal values in the range, the first is inserted, as by single inserts.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert_range(first, last, false);
+    }
+
+    //*********************************************************************
+    /// Inserts a sorted range of values to the reference_flat_set.
+    /// The range is merged with the existing elements in one pass.
+    /// Of several equal values in the range, the first is inserted.
+    /// If the range turns out not to be sorted, it is sorted first.
+    /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      insert_range(first, last, true);
     }
 
     //*********************************************************************
@@ -755,8 +799,58 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, out of order.
+    /// Must be followed by sort_appended and merge_appended.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Sorts the values appended after the first 'n'.
+    /// Those that are already present are moved to begin() + n.
+    ///\return The number that were moved.
+    //*********************************************************************
+    size_t sort_appended(size_t n, bool sorted)
+    {
+      return etl::private_flat::prepare(lookup, n, sorted, true, pointer_compare());
+    }
+
+    //*********************************************************************
+    /// Merges the values appended after the first 'n' with the existing ones,
+    /// dropping the 'skip' values at begin() + n.
+    //*********************************************************************
+    void merge_appended(size_t n, size_t skip)
+    {
+      etl::private_flat::merge(lookup, n, skip, pointer_compare());
+    }
+
   private:
 
+    //*********************************************************************
+    /// Inserts a range of values, in one pass for as many as there is room for.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(TIterator first, TIterator last, bool sorted)
+    {
+      const size_t n = lookup.size();
+
+      while ((first != last) && !lookup.full())
+      {
+        append(*first++);
+      }
+
+      merge_appended(n, sort_appended(n, sorted));
+
+      // Any that did not fit may still be duplicates, so insert one at a time.
+      while (first != last)
+      {
+        insert(*first++);
+      }
+    }
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "delegate.h"
 
 #undef ETL_FILE
 #define ETL_FILE "36"
@@ -241,6 +242,9 @@ namespace etl
     void set_idle_callback(etl::ifunction<void>& callback)
     {
       p_idle_callback = &callback;
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+      idle_delegate.clear();
+#endif
     }
 
     //*******************************************
@@ -249,7 +253,30 @@ namespace etl
     void set_watchdog_callback(etl::ifunction<void>& callback)
     {
       p_watchdog_callback = &callback;
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+      watchdog_delegate.clear();
+#endif
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*******************************************
+    /// Set the idle callback as a delegate.
+    //*******************************************
+    void set_idle_callback(const etl::delegate<void()>& callback)
+    {
+      p_idle_callback = nullptr;
+      idle_delegate   = callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback as a delegate.
+    //*******************************************
+    void set_watchdog_callback(const etl::delegate<void()>& callback)
+    {
+      p_watchdog_callback = nullptr;
+      watchdog_delegate   = callback;
     }
+#endif
 
     //*******************************************
     /// Set the running state for the scheduler.
@@ -327,6 +354,10 @@ namespace etl
     bool scheduler_exit;
     etl::ifunction<void>* p_idle_callback;
     etl::ifunction<void>* p_watchdog_callback;
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    etl::delegate<void()> idle_delegate;
+    etl::delegate<void()> watchdog_delegate;
+#endif
 
   private:
 
@@ -390,10 +421,25 @@ namespace etl
           {
             (*p_watchdog_callback)();
           }
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+          else
+          {
+            watchdog_delegate.call_if();
+          }
+#endif
 
-          if (idle && p_idle_callback)
+          if (idle)
           {
-            (*p_idle_callback)();
+            if (p_idle_callback)
+            {
+              (*p_idle_callback)();
+            }
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+            else
+            {
+              idle_delegate.call_if();
+            }
+#endif
           }
         }
       }
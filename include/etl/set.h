@@ -913,6 +913,23 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Moves the nodes so that they are in key order in memory, and so that
+    /// the free nodes follow them, undoing the scattering caused by inserts
+    /// and erases. The tree is rebuilt fully balanced.
+    /// O(N). Invalidates all iterators, pointers and references.
+    //*************************************************************************
+    void compact()
+    {
+      size_t index = 0;
+      number_nodes(root_node, index);
+
+      p_node_pool->compact(etl::private_pool::node_relocator<Data_Node, value_type, &Data_Node::value>());
+
+      size_t height;
+      root_node = build_tree(0, size(), height);
+    }
+
     //*********************************************************************
     /// Counts the number of elements that contain the key specified.
     ///\param key The key to search for.
@@ -1188,6 +1205,62 @@ namespace etl
       return node;
     }
 
+    //*************************************************************************
+    /// Numbers the nodes of the subtree in key order, over their first word.
+    //*************************************************************************
+    void number_nodes(Node* p_node, size_t& index)
+    {
+      if (p_node != nullptr)
+      {
+        Node* p_right = p_node->children[kRight];
+
+        number_nodes(p_node->children[kLeft], index);
+        *reinterpret_cast<uintptr_t*>(p_node) = index++;
+        number_nodes(p_right, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Links the nodes at pool items [first, last) as a balanced subtree.
+    /// Returns the root of the subtree and sets 'height' to its height.
+    //*************************************************************************
+    Node* build_tree(size_t first, size_t last, size_t& height)
+    {
+      if (first == last)
+      {
+        height = 0;
+        return nullptr;
+      }
+
+      const size_t middle = first + ((last - first) / 2);
+
+      Node* p_node = static_cast<Data_Node*>(p_node_pool->item_address(middle));
+
+      size_t left_height;
+      size_t right_height;
+
+      p_node->children[kLeft]  = build_tree(first, middle, left_height);
+      p_node->children[kRight] = build_tree(middle + 1, last, right_height);
+      p_node->dir = uint_least8_t(kNeither);
+
+      if (left_height > right_height)
+      {
+        p_node->weight = uint_least8_t(kLeft);
+      }
+      else if (right_height > left_height)
+      {
+        p_node->weight = uint_least8_t(kRight);
+      }
+      else
+      {
+        p_node->weight = uint_least8_t(kNeither);
+      }
+
+      height = 1 + std::max(left_height, right_height);
+
+      return p_node;
+    }
+
     //*************************************************************************
     /// Destroy a Data_Node.
     //*************************************************************************
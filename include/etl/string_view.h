@@ -39,6 +39,7 @@ SOFTWARE.
 #include "char_traits.h"
 #include "integral_limits.h"
 #include "hash.h"
+#include "private/string_search.h"
 
 #include <algorithm>
 
@@ -480,21 +481,14 @@ namespace etl
     //*************************************************************************
     size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
+      if ((size() < view.size()) || (position > size()))
       {
         return npos;
       }
 
-      const_iterator iposition = std::search(begin() + position, end(), view.begin(), view.end());
+      const T* p = private_string_search::search(mbegin + position, mend, view.data(), view.size());
 
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return std::distance(begin(), iposition);
-      }
+      return (p != mend) ? size_type(p - mbegin) : npos;
     }
 
     size_type find(T c, size_type position = 0) const
@@ -559,21 +553,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
+        const T* p = private_string_search::find_first_of(mbegin + position, mend, view.data(), view.size(), true);
+
+        if (p != mend)
         {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
+          return p - mbegin;
         }
       }
 
@@ -607,25 +593,9 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
+      const T* p = private_string_search::find_last_of(mbegin, mbegin + position + 1, view.data(), view.size(), true);
 
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p != (mbegin + position + 1)) ? size_type(p - mbegin) : npos;
     }
 
     size_type find_last_of(T c, size_type position = npos) const
@@ -648,28 +618,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
+        const T* p = private_string_search::find_first_of(mbegin + position, mend, view.data(), view.size(), false);
+
+        if (p != mend)
         {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
+          return p - mbegin;
         }
       }
 
@@ -703,32 +658,9 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const T* p = private_string_search::find_last_of(mbegin, mbegin + position + 1, view.data(), view.size(), false);
 
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return (p != (mbegin + position + 1)) ? size_type(p - mbegin) : npos;
     }
 
     size_type find_last_not_of(T c, size_type position = npos) const
@@ -0,0 +1,761 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_STRING_INCLUDED
+#define ETL_TO_STRING_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "basic_string.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "55"
+
+//*****************************************************************************
+///\defgroup to_string to_string
+/// Formats integral and floating point values directly into an etl string.
+/// No memory is allocated and no C library formatting functions are used.
+/// Characters that do not fit are discarded and the string is marked as
+/// truncated, as for ibasic_string::append.
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup to_string
+  /// Exception base for to_string
+  //***************************************************************************
+  class to_string_exception : public etl::exception
+  {
+  public:
+
+    to_string_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup to_string
+  /// Invalid base exception.
+  //***************************************************************************
+  class to_string_invalid_base : public etl::to_string_exception
+  {
+  public:
+
+    to_string_invalid_base(string_type file_name_, numeric_type line_number_)
+      : to_string_exception(ETL_ERROR_TEXT("to_string:base", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_to_string
+  {
+    enum
+    {
+      INTEGER_BUFFER_SIZE = 65, ///< A 64 bit value in binary, plus the sign.
+      FLOAT_BUFFER_SIZE   = 32  ///< The longest form, "-0.00000ddddddddddddddddd".
+    };
+
+    //*************************************************************************
+    /// The unsigned type used to format an integral type.
+    /// 32 bit arithmetic is used where possible, as it is much faster on
+    /// small targets.
+    //*************************************************************************
+    template <typename TValue>
+    struct unsigned_type
+    {
+      typedef typename etl::conditional<(sizeof(TValue) <= sizeof(uint32_t)), uint32_t, uint64_t>::type type;
+    };
+
+    //*************************************************************************
+    template <typename TValue>
+    bool is_negative(TValue value, etl::integral_constant<bool, true>)
+    {
+      return value < TValue(0);
+    }
+
+    //*************************************************************************
+    template <typename TValue>
+    bool is_negative(TValue, etl::integral_constant<bool, false>)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// The digits "00" to "99", to convert two digits per division.
+    //*************************************************************************
+    inline const char* digit_pairs()
+    {
+      static const char pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+      return pairs;
+    }
+
+    //*************************************************************************
+    /// Writes the decimal digits of 'value' backwards, ending before 'p'.
+    ///\return The first character written.
+    //*************************************************************************
+    template <typename T, typename TUnsigned>
+    T* format_decimal(T* p, TUnsigned value)
+    {
+      const char* pairs = digit_pairs();
+
+      while (value >= 100U)
+      {
+        const size_t index = size_t(value % 100U) * 2U;
+        value /= 100U;
+
+        *--p = T(pairs[index + 1U]);
+        *--p = T(pairs[index]);
+      }
+
+      if (value >= 10U)
+      {
+        const size_t index = size_t(value) * 2U;
+
+        *--p = T(pairs[index + 1U]);
+        *--p = T(pairs[index]);
+      }
+      else
+      {
+        *--p = T('0' + value);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Writes the digits of 'value' in 'base' backwards, ending before 'p'.
+    /// Digits above 9 are lower case letters.
+    ///\return The first character written.
+    //*************************************************************************
+    template <typename T, typename TUnsigned>
+    T* format_radix(T* p, TUnsigned value, uint32_t base)
+    {
+      static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+      if ((base & (base - 1U)) == 0U)
+      {
+        // Powers of two shift and mask.
+        uint32_t shift = 0U;
+
+        while ((1U << shift) != base)
+        {
+          ++shift;
+        }
+
+        const TUnsigned mask = TUnsigned(base - 1U);
+
+        do
+        {
+          *--p = T(digits[value & mask]);
+          value >>= shift;
+        } while (value != 0U);
+      }
+      else
+      {
+        do
+        {
+          *--p = T(digits[value % base]);
+          value /= base;
+        } while (value != 0U);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// A floating point value as f * 2^e, for the Grisu2 algorithm.
+    /// See "Printing Floating-Point Numbers Quickly and Accurately with
+    /// Integers", Florian Loitsch, 2010.
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp()
+        : f(0U),
+          e(0)
+      {
+      }
+
+      diy_fp(uint64_t f_, int e_)
+        : f(f_),
+          e(e_)
+      {
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// Shifts 'v' until the top bit of the significand is set.
+    //*************************************************************************
+    inline diy_fp normalise(diy_fp v)
+    {
+      if ((v.f & 0xFFFFFFFF00000000) == 0U) { v.f <<= 32; v.e -= 32; }
+      if ((v.f & 0xFFFF000000000000) == 0U) { v.f <<= 16; v.e -= 16; }
+      if ((v.f & 0xFF00000000000000) == 0U) { v.f <<= 8;  v.e -= 8; }
+      if ((v.f & 0xF000000000000000) == 0U) { v.f <<= 4;  v.e -= 4; }
+      if ((v.f & 0xC000000000000000) == 0U) { v.f <<= 2;  v.e -= 2; }
+      if ((v.f & 0x8000000000000000) == 0U) { v.f <<= 1;  v.e -= 1; }
+
+      return v;
+    }
+
+    //*************************************************************************
+    /// The upper 64 bits of the product, rounded.
+    //*************************************************************************
+    inline diy_fp multiply(const diy_fp& lhs, const diy_fp& rhs)
+    {
+      const uint64_t M32 = 0xFFFFFFFFU;
+
+      const uint64_t a = lhs.f >> 32;
+      const uint64_t b = lhs.f & M32;
+      const uint64_t c = rhs.f >> 32;
+      const uint64_t d = rhs.f & M32;
+
+      const uint64_t ac = a * c;
+      const uint64_t bc = b * c;
+      const uint64_t ad = a * d;
+      const uint64_t bd = b * d;
+
+      uint64_t mid = (bd >> 32) + (ad & M32) + (bc & M32);
+      mid += uint64_t(1U) << 31;
+
+      return diy_fp(ac + (ad >> 32) + (bc >> 32) + (mid >> 32), lhs.e + rhs.e + 64);
+    }
+
+    //*************************************************************************
+    /// Finds the cached power of ten, c = 10^-k, that brings the exponent of
+    /// a value with binary exponent 'e' into the range [-60, -32].
+    //*************************************************************************
+    inline diy_fp cached_power(int e, int& k)
+    {
+      // 10^-348 to 10^340, in steps of 8.
+      static const uint64_t significands[] =
+      {
+        0xFA8FD5A0081C0288, 0xBAAEE17FA23EBF76, 0x8B16FB203055AC76, 0xCF42894A5DCE35EA,
+        0x9A6BB0AA55653B2D, 0xE61ACF033D1A45DF, 0xAB70FE17C79AC6CA, 0xFF77B1FCBEBCDC4F,
+        0xBE5691EF416BD60C, 0x8DD01FAD907FFC3C, 0xD3515C2831559A83, 0x9D71AC8FADA6C9B5,
+        0xEA9C227723EE8BCB, 0xAECC49914078536D, 0x823C12795DB6CE57, 0xC21094364DFB5637,
+        0x9096EA6F3848984F, 0xD77485CB25823AC7, 0xA086CFCD97BF97F4, 0xEF340A98172AACE5,
+        0xB23867FB2A35B28E, 0x84C8D4DFD2C63F3B, 0xC5DD44271AD3CDBA, 0x936B9FCEBB25C996,
+        0xDBAC6C247D62A584, 0xA3AB66580D5FDAF6, 0xF3E2F893DEC3F126, 0xB5B5ADA8AAFF80B8,
+        0x87625F056C7C4A8B, 0xC9BCFF6034C13053, 0x964E858C91BA2655, 0xDFF9772470297EBD,
+        0xA6DFBD9FB8E5B88F, 0xF8A95FCF88747D94, 0xB94470938FA89BCF, 0x8A08F0F8BF0F156B,
+        0xCDB02555653131B6, 0x993FE2C6D07B7FAC, 0xE45C10C42A2B3B06, 0xAA242499697392D3,
+        0xFD87B5F28300CA0E, 0xBCE5086492111AEB, 0x8CBCCC096F5088CC, 0xD1B71758E219652C,
+        0x9C40000000000000, 0xE8D4A51000000000, 0xAD78EBC5AC620000, 0x813F3978F8940984,
+        0xC097CE7BC90715B3, 0x8F7E32CE7BEA5C70, 0xD5D238A4ABE98068, 0x9F4F2726179A2245,
+        0xED63A231D4C4FB27, 0xB0DE65388CC8ADA8, 0x83C7088E1AAB65DB, 0xC45D1DF942711D9A,
+        0x924D692CA61BE758, 0xDA01EE641A708DEA, 0xA26DA3999AEF774A, 0xF209787BB47D6B85,
+        0xB454E4A179DD1877, 0x865B86925B9BC5C2, 0xC83553C5C8965D3D, 0x952AB45CFA97A0B3,
+        0xDE469FBD99A05FE3, 0xA59BC234DB398C25, 0xF6C69A72A3989F5C, 0xB7DCBF5354E9BECE,
+        0x88FCF317F22241E2, 0xCC20CE9BD35C78A5, 0x98165AF37B2153DF, 0xE2A0B5DC971F303A,
+        0xA8D9D1535CE3B396, 0xFB9B7CD9A4A7443C, 0xBB764C4CA7A44410, 0x8BAB8EEFB6409C1A,
+        0xD01FEF10A657842C, 0x9B10A4E5E9913129, 0xE7109BFBA19C0C9D, 0xAC2820D9623BF429,
+        0x80444B5E7AA7CF85, 0xBF21E44003ACDD2D, 0x8E679C2F5E44FF8F, 0xD433179D9C8CB841,
+        0x9E19DB92B4E31BA9, 0xEB96BF6EBADF77D9, 0xAF87023B9BF0EE6B
+      };
+
+      static const int16_t exponents[] =
+      {
+        -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+        -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+        -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+        -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+        56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+        375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+        694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+        1013, 1039, 1066
+      };
+
+      const double dk = (-61 - e) * 0.30102999566398114 + 347.0;
+      int ik = int(dk);
+
+      if ((dk - ik) > 0.0)
+      {
+        ++ik;
+      }
+
+      const int index = (ik >> 3) + 1;
+      k = 348 - (index * 8);
+
+      return diy_fp(significands[index], exponents[index]);
+    }
+
+    //*************************************************************************
+    /// Powers of ten that fit in 64 bits.
+    //*************************************************************************
+    inline const uint64_t* powers_of_10()
+    {
+      static const uint64_t powers[] =
+      {
+        1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U, 100000000U, 1000000000U,
+        10000000000, 100000000000, 1000000000000, 10000000000000, 100000000000000,
+        1000000000000000, 10000000000000000, 100000000000000000, 1000000000000000000,
+        10000000000000000000U
+      };
+
+      return powers;
+    }
+
+    //*************************************************************************
+    /// Moves the last digit towards the value, while it stays in range.
+    //*************************************************************************
+    inline void grisu_round(char* buffer, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+    {
+      while ((rest < wp_w) &&
+             ((delta - rest) >= ten_kappa) &&
+             (((rest + ten_kappa) < wp_w) || ((wp_w - rest) > (rest + ten_kappa - wp_w))))
+      {
+        --buffer[length - 1];
+        rest += ten_kappa;
+      }
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits of 'w' that lie within 'delta' of 'mp'.
+    //*************************************************************************
+    inline void digit_gen(const diy_fp& w, const diy_fp& mp, uint64_t delta, char* buffer, int& length, int& k)
+    {
+      const uint64_t* powers = powers_of_10();
+
+      const int      shift = -mp.e;
+      const uint64_t one   = uint64_t(1U) << shift;
+      const uint64_t wp_w  = mp.f - w.f;
+
+      uint32_t p1 = uint32_t(mp.f >> shift);
+      uint64_t p2 = mp.f & (one - 1U);
+
+      int kappa = 10;
+
+      while ((kappa > 1) && (p1 < powers[kappa - 1]))
+      {
+        --kappa;
+      }
+
+      length = 0;
+
+      // The integral part.
+      while (kappa > 0)
+      {
+        const uint32_t power = uint32_t(powers[kappa - 1]);
+        const uint32_t d     = p1 / power;
+        p1 %= power;
+
+        if ((d != 0U) || (length != 0))
+        {
+          buffer[length++] = char('0' + d);
+        }
+
+        --kappa;
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+        if (rest <= delta)
+        {
+          k += kappa;
+          grisu_round(buffer, length, delta, rest, powers[kappa] << shift, wp_w);
+          return;
+        }
+      }
+
+      // The fractional part.
+      for (;;)
+      {
+        p2    *= 10U;
+        delta *= 10U;
+
+        const char d = char(p2 >> shift);
+
+        if ((d != 0) || (length != 0))
+        {
+          buffer[length++] = char('0' + d);
+        }
+
+        p2 &= one - 1U;
+        --kappa;
+
+        if (p2 < delta)
+        {
+          k += kappa;
+          grisu_round(buffer, length, delta, p2, one, (-kappa < 20) ? wp_w * powers[-kappa] : 0U);
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The parts of an IEEE 754 value.
+    //*************************************************************************
+    struct float_parts
+    {
+      uint64_t f;
+      int      e;
+      bool     negative;
+      bool     is_nan;
+      bool     is_inf;
+      bool     lower_boundary_is_closer;
+    };
+
+    //*************************************************************************
+    inline float_parts decompose(double value)
+    {
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const uint64_t hidden   = 0x0010000000000000;
+      const int      biased_e = int((bits >> 52) & 0x7FFU);
+
+      float_parts parts;
+      parts.f        = bits & (hidden - 1U);
+      parts.negative = (bits >> 63) != 0U;
+      parts.is_nan   = (biased_e == 0x7FF) && (parts.f != 0U);
+      parts.is_inf   = (biased_e == 0x7FF) && (parts.f == 0U);
+
+      if (biased_e != 0)
+      {
+        parts.f |= hidden;
+        parts.e  = biased_e - 1075;
+      }
+      else
+      {
+        parts.e = -1074;
+      }
+
+      parts.lower_boundary_is_closer = (parts.f == hidden) && (biased_e > 1);
+
+      return parts;
+    }
+
+    //*************************************************************************
+    inline float_parts decompose(float value)
+    {
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const uint32_t hidden   = 0x00800000U;
+      const int      biased_e = int((bits >> 23) & 0xFFU);
+
+      float_parts parts;
+      parts.f        = bits & (hidden - 1U);
+      parts.negative = (bits >> 31) != 0U;
+      parts.is_nan   = (biased_e == 0xFF) && (parts.f != 0U);
+      parts.is_inf   = (biased_e == 0xFF) && (parts.f == 0U);
+
+      if (biased_e != 0)
+      {
+        parts.f |= hidden;
+        parts.e  = biased_e - 150;
+      }
+      else
+      {
+        parts.e = -149;
+      }
+
+      parts.lower_boundary_is_closer = (parts.f == hidden) && (biased_e > 1);
+
+      return parts;
+    }
+
+    //*************************************************************************
+    /// Generates the digits of a value, as digits * 10^k.
+    /// The digits always convert back to the same value, and are the shortest
+    /// possible for all but about 0.1% of values.
+    //*************************************************************************
+    inline void grisu2(const float_parts& parts, char* buffer, int& length, int& k)
+    {
+      const diy_fp v     = normalise(diy_fp(parts.f, parts.e));
+      const diy_fp plus  = normalise(diy_fp((parts.f << 1) + 1U, parts.e - 1));
+      diy_fp       minus = parts.lower_boundary_is_closer ? diy_fp((parts.f << 2) - 1U, parts.e - 2)
+                                                          : diy_fp((parts.f << 1) - 1U, parts.e - 1);
+
+      minus.f <<= (minus.e - plus.e);
+      minus.e   = plus.e;
+
+      const diy_fp c_mk = cached_power(plus.e, k);
+
+      const diy_fp w  = multiply(v, c_mk);
+      diy_fp       wp = multiply(plus, c_mk);
+      diy_fp       wm = multiply(minus, c_mk);
+
+      ++wm.f;
+      --wp.f;
+
+      digit_gen(w, wp, wp.f - wm.f, buffer, length, k);
+    }
+
+    //*************************************************************************
+    /// Formats a value in its short form.
+    /// Fixed notation is used from 1e-6 up to 1e21, otherwise scientific.
+    ///\return The number of characters written.
+    //*************************************************************************
+    template <typename T, typename TFloat>
+    size_t format_float(T* buffer, TFloat value)
+    {
+      const float_parts parts = decompose(value);
+
+      T* p = buffer;
+
+      if (parts.is_nan)
+      {
+        *p++ = T('n'); *p++ = T('a'); *p++ = T('n');
+        return size_t(p - buffer);
+      }
+
+      if (parts.negative)
+      {
+        *p++ = T('-');
+      }
+
+      if (parts.is_inf)
+      {
+        *p++ = T('i'); *p++ = T('n'); *p++ = T('f');
+        return size_t(p - buffer);
+      }
+
+      if (parts.f == 0U)
+      {
+        *p++ = T('0');
+        return size_t(p - buffer);
+      }
+
+      char digits[20];
+      int  length;
+      int  k;
+
+      grisu2(parts, digits, length, k);
+
+      // The position of the decimal point, relative to the first digit.
+      const int point = length + k;
+
+      if ((length <= point) && (point <= 21))
+      {
+        // dddd000
+        for (int i = 0; i < length; ++i)
+        {
+          *p++ = T(digits[i]);
+        }
+
+        for (int i = length; i < point; ++i)
+        {
+          *p++ = T('0');
+        }
+      }
+      else if ((0 < point) && (point <= 21))
+      {
+        // dd.dd
+        for (int i = 0; i < length; ++i)
+        {
+          if (i == point)
+          {
+            *p++ = T('.');
+          }
+
+          *p++ = T(digits[i]);
+        }
+      }
+      else if ((-6 < point) && (point <= 0))
+      {
+        // 0.000dddd
+        *p++ = T('0');
+        *p++ = T('.');
+
+        for (int i = point; i < 0; ++i)
+        {
+          *p++ = T('0');
+        }
+
+        for (int i = 0; i < length; ++i)
+        {
+          *p++ = T(digits[i]);
+        }
+      }
+      else
+      {
+        // d.ddde+xx
+        *p++ = T(digits[0]);
+
+        if (length > 1)
+        {
+          *p++ = T('.');
+
+          for (int i = 1; i < length; ++i)
+          {
+            *p++ = T(digits[i]);
+          }
+        }
+
+        const int exponent = point - 1;
+
+        *p++ = T('e');
+        *p++ = (exponent < 0) ? T('-') : T('+');
+
+        T  exponent_digits[4];
+        T* const exponent_end = exponent_digits + 4;
+        const T* first = format_decimal(exponent_end, uint32_t((exponent < 0) ? -exponent : exponent));
+
+        while (first != exponent_end)
+        {
+          *p++ = *first++;
+        }
+      }
+
+      return size_t(p - buffer);
+    }
+
+    //*************************************************************************
+    /// The type used to format a floating point type.
+    /// long double is formatted as double.
+    //*************************************************************************
+    template <typename TValue>
+    struct float_type
+    {
+      typedef typename etl::conditional<etl::is_same<TValue, float>::value, float, double>::type type;
+    };
+  }
+
+  //***************************************************************************
+  /// Appends an integral value to the string.
+  ///\ingroup to_string
+  ///\param str   The string to append to.
+  ///\param value The value.
+  ///\param base  The base, 2 to 36. Digits above 9 are lower case.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_integral<TValue>::value, etl::ibasic_string<T>&>::type
+    append_integer(etl::ibasic_string<T>& str, TValue value, uint32_t base = 10U)
+  {
+    typedef typename private_to_string::unsigned_type<TValue>::type unsigned_t;
+
+    if ((base < 2U) || (base > 36U))
+    {
+      ETL_ASSERT(false, ETL_ERROR(to_string_invalid_base));
+      return str;
+    }
+
+    T buffer[private_to_string::INTEGER_BUFFER_SIZE];
+    T* const last = buffer + private_to_string::INTEGER_BUFFER_SIZE;
+
+    const bool negative  = private_to_string::is_negative(value, etl::integral_constant<bool, etl::is_signed<TValue>::value>());
+    const unsigned_t magnitude = negative ? unsigned_t(unsigned_t(0U) - unsigned_t(value)) : unsigned_t(value);
+
+    T* first = (base == 10U) ? private_to_string::format_decimal(last, magnitude)
+                             : private_to_string::format_radix(last, magnitude, base);
+
+    if (negative)
+    {
+      *--first = T('-');
+    }
+
+    return str.append(first, size_t(last - first));
+  }
+
+  //***************************************************************************
+  /// Appends a floating point value to the string, in a short form that
+  /// always converts back to the same value. The form is the shortest possible
+  /// for all but about 0.1% of values, which have one more digit.
+  /// Fixed notation is used from 1e-6 up to 1e21, otherwise scientific.
+  /// Infinities are "inf" or "-inf", and not-a-number is "nan".
+  ///\ingroup to_string
+  ///\param str   The string to append to.
+  ///\param value The value.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename T, typename TValue>
+  typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::ibasic_string<T>&>::type
+    append_float(etl::ibasic_string<T>& str, TValue value)
+  {
+    typedef typename private_to_string::float_type<TValue>::type float_t;
+
+    T buffer[private_to_string::FLOAT_BUFFER_SIZE];
+
+    const size_t length = private_to_string::format_float(buffer, float_t(value));
+
+    return str.append(buffer, length);
+  }
+
+  //***************************************************************************
+  /// Replaces the contents of the string with an integral value.
+  ///\ingroup to_string
+  ///\param value The value.
+  ///\param str   The string.
+  ///\param base  The base, 2 to 36.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename TValue, typename T>
+  typename etl::enable_if<etl::is_integral<TValue>::value, etl::ibasic_string<T>&>::type
+    to_string(TValue value, etl::ibasic_string<T>& str, uint32_t base = 10U)
+  {
+    str.clear();
+
+    return etl::append_integer(str, value, base);
+  }
+
+  //***************************************************************************
+  /// Replaces the contents of the string with a floating point value.
+  ///\ingroup to_string
+  ///\param value The value.
+  ///\param str   The string.
+  ///\return A reference to the string.
+  //***************************************************************************
+  template <typename TValue, typename T>
+  typename etl::enable_if<etl::is_floating_point<TValue>::value, etl::ibasic_string<T>&>::type
+    to_string(TValue value, etl::ibasic_string<T>& str)
+  {
+    str.clear();
+
+    return etl::append_float(str, value);
+  }
+}
+
+#undef ETL_FILE
+
+#endif
@@ -847,6 +847,52 @@ namespace etl
       return insert(key_value_pair).first;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Inserts a value to the unordered_map by moving it.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    std::pair<iterator, bool> insert(value_type&& key_value_pair)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
+
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(std::move(key_value_pair));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return link_node(node);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_map by moving it.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, value_type&& key_value_pair)
+    {
+      return insert(std::move(key_value_pair)).first;
+    }
+
+    //*********************************************************************
+    /// Constructs a value in the unordered_map from the arguments.
+    /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map is already full.
+    ///\param args The arguments used to construct the value_type.
+    //*********************************************************************
+    template <typename ... Args>
+    std::pair<iterator, bool> emplace(Args&& ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
+
+      node_t& node = *pnodepool->allocate<node_t>();
+      ::new (&node.key_value_pair) value_type(std::forward<Args>(args)...);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return link_node(node);
+    }
+#endif
+
     //*********************************************************************
     /// Inserts a range of values to the unordered_map.
     /// If asserts or exceptions are enabled, emits unordered_map_full if the unordered_map does not have enough free space.
@@ -989,6 +1035,56 @@ namespace etl
       initialise();
     }
 
+    //*************************************************************************
+    /// Moves the nodes so that they are in iteration order in memory, and so
+    /// that the free nodes follow them, undoing the scattering caused by
+    /// inserts and erases.
+    /// O(N). Invalidates all iterators, pointers and references.
+    //*************************************************************************
+    void compact()
+    {
+      const size_t n = size();
+      size_t index = 0;
+
+      // Number the nodes in iteration order and empty the buckets.
+      for (size_t i = 0; i < number_of_buckets; ++i)
+      {
+        bucket_t& bucket = pbuckets[i];
+        local_iterator inode = bucket.begin();
+
+        while (inode != bucket.end())
+        {
+          node_t& node = *inode++;
+          *reinterpret_cast<uintptr_t*>(&node) = index++;
+        }
+
+        bucket.clear();
+      }
+
+      pnodepool->compact(etl::private_pool::node_relocator<node_t, value_type, &node_t::key_value_pair>());
+
+      first = pbuckets + number_of_buckets;
+      last  = pbuckets;
+
+      // Rebuild the buckets from the back, so that each keeps its order.
+      for (size_t i = n; i > 0; --i)
+      {
+        node_t& node = *static_cast<node_t*>(pnodepool->item_address(i - 1));
+        bucket_t* pbucket = pbuckets + get_bucket_index(node.key_value_pair.first);
+
+        pbucket->push_front(node);
+
+        first = (pbucket < first) ? pbucket : first;
+        last  = (pbucket > last)  ? pbucket : last;
+      }
+
+      if (n == 0)
+      {
+        first = pbuckets;
+        last  = first;
+      }
+    }
+
     //*********************************************************************
     /// Counts an element.
     ///\param key The key to search for.
@@ -1191,6 +1287,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_map& operator = (iunordered_map&& rhs)
+    {
+      move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   protected:
 
     //*********************************************************************
@@ -1242,8 +1350,83 @@ namespace etl
       last = first;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Move the elements of another unordered_map in to this one.
+    /// The nodes live in each map's own pool, so the values are moved one by one.
+    //*********************************************************************
+    void move_container(iunordered_map&& other)
+    {
+      if (&other != this)
+      {
+        ETL_ASSERT(other.size() <= max_size(), ETL_ERROR(unordered_map_full));
+
+        initialise();
+
+        for (size_t i = 0; i < other.number_of_buckets; ++i)
+        {
+          bucket_t& bucket = other.pbuckets[i];
+          local_iterator inode = bucket.begin();
+
+          while (inode != bucket.end())
+          {
+            insert(std::move(inode->key_value_pair));
+            ++inode;
+          }
+        }
+
+        other.initialise();
+      }
+    }
+#endif
+
   private:
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Links a constructed node in to its bucket.
+    /// If the key is already present the node is destroyed and released.
+    //*********************************************************************
+    std::pair<iterator, bool> link_node(node_t& node)
+    {
+      const key_type& key = node.key_value_pair.first;
+
+      bucket_t* pbucket = pbuckets + get_bucket_index(key);
+      bucket_t& bucket = *pbucket;
+
+      bool was_empty = bucket.empty();
+
+      local_iterator inode_previous = bucket.before_begin();
+      local_iterator inode = bucket.begin();
+
+      while (inode != bucket.end())
+      {
+        // Do we already have this key?
+        if (key_equal_function(key, inode->key_value_pair.first))
+        {
+          node.key_value_pair.~value_type();
+          pnodepool->release(&node);
+          ETL_DECREMENT_DEBUG_COUNT;
+
+          return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode), false);
+        }
+
+        ++inode_previous;
+        ++inode;
+      }
+
+      bucket.insert_after(inode_previous, node);
+      ++inode_previous;
+
+      if (was_empty)
+      {
+        adjust_first_last_markers(pbucket);
+      }
+
+      return std::pair<iterator, bool>(iterator((pbuckets + number_of_buckets), pbucket, inode_previous), true);
+    }
+#endif
+
     //*********************************************************************
     /// Adjust the first and last markers according to the new entry.
     //*********************************************************************
@@ -1372,6 +1555,18 @@ namespace etl
       base::assign(first_, last_);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_map(unordered_map&& other)
+      : base(node_pool, buckets, MAX_BUCKETS_)
+    {
+      base::initialise();
+      base::move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1394,6 +1589,18 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_map& operator = (unordered_map&& rhs)
+    {
+      base::move_container(std::move(rhs));
+
+      return *this;
+    }
+#endif
+
   private:
 
     /// The pool of nodes used for the unordered_map.
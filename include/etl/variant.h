@@ -32,6 +32,8 @@ SOFTWARE.
 #define ETL_VARIANT_INCLUDED
 
 #include <stdint.h>
+#include <new>
+#include <utility>
 
 #include "platform.h"
 #include "array.h"
@@ -41,6 +43,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "static_assert.h"
 #include "alignment.h"
+#include "parameter_type.h"
 #include "error_handler.h"
 
 #if defined(ETL_COMPILER_KEIL)
@@ -97,6 +100,624 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// 'Not valid' exception for the variant class.
+  ///\ingroup variant
+  //***************************************************************************
+  class variant_invalid_exception : public variant_exception
+  {
+  public:
+    variant_invalid_exception(string_type file_name_, numeric_type line_number_)
+      : variant_exception(ETL_ERROR_TEXT("variant: not valid", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+  namespace private_variant
+  {
+    //*************************************************************************
+    /// The id of a type in the list, or 'integral_limits<uint_least8_t>::max' if not found.
+    //*************************************************************************
+    template <size_t INDEX, typename T, typename... TTypes>
+    struct type_id_lookup
+    {
+      static const uint_least8_t value = integral_limits<uint_least8_t>::max;
+    };
+
+    template <size_t INDEX, typename T, typename T1, typename... TRest>
+    struct type_id_lookup<INDEX, T, T1, TRest...>
+    {
+      static const uint_least8_t value = etl::is_same<T, T1>::value ? uint_least8_t(INDEX) : type_id_lookup<INDEX + 1, T, TRest...>::value;
+    };
+
+    //*************************************************************************
+    /// The first type in the list.
+    //*************************************************************************
+    template <typename T1, typename... TRest>
+    struct first_type
+    {
+      typedef T1 type;
+    };
+
+    //*************************************************************************
+    /// The largest size and alignment of the types in the list.
+    //*************************************************************************
+    template <typename T1, typename... TRest>
+    struct largest
+    {
+      static const size_t size      = (sizeof(T1) > largest<TRest...>::size) ? sizeof(T1) : largest<TRest...>::size;
+      static const size_t alignment = (etl::alignment_of<T1>::value > largest<TRest...>::alignment) ? etl::alignment_of<T1>::value : largest<TRest...>::alignment;
+    };
+
+    template <typename T1>
+    struct largest<T1>
+    {
+      static const size_t size      = sizeof(T1);
+      static const size_t alignment = etl::alignment_of<T1>::value;
+    };
+
+    //*************************************************************************
+    /// Are all of the types trivially copyable and destructible?
+    //*************************************************************************
+    template <typename T1, typename... TRest>
+    struct all_trivial
+    {
+      static const bool value = all_trivial<T1>::value && all_trivial<TRest...>::value;
+    };
+
+    template <typename T1>
+    struct all_trivial<T1>
+    {
+      static const bool value = etl::is_trivially_copyable<T1>::value && etl::is_trivially_destructible<T1>::value;
+    };
+
+    //*************************************************************************
+    /// Base reader type functor class.
+    /// Declares a 'read' for each type.
+    //*************************************************************************
+    template <typename R1, typename... RRest>
+    class reader_type : public reader_type<RRest...>
+    {
+    public:
+
+      using reader_type<RRest...>::read;
+
+      virtual void read(typename etl::parameter_type<R1>::type value) = 0;
+    };
+
+    template <typename R1>
+    class reader_type<R1>
+    {
+    public:
+
+      virtual ~reader_type()
+      {
+      }
+
+      virtual void read(typename etl::parameter_type<R1>::type value) = 0;
+    };
+
+    //*************************************************************************
+    /// The storage for the variant.
+    /// Copies, moves and destroys through a table indexed by the type id.
+    //*************************************************************************
+    template <bool IS_TRIVIAL, typename... TTypes>
+    class variant_storage
+    {
+    protected:
+
+      typedef uint_least8_t type_id_t;
+
+      static const type_id_t NO_TYPE_ID = integral_limits<type_id_t>::max;
+
+      //***********************************************************************
+      variant_storage()
+        : type_id(NO_TYPE_ID)
+      {
+      }
+
+      //***********************************************************************
+      variant_storage(const variant_storage& other)
+        : type_id(NO_TYPE_ID)
+      {
+        copy_construct(other);
+      }
+
+      //***********************************************************************
+      variant_storage(variant_storage&& other)
+        : type_id(NO_TYPE_ID)
+      {
+        move_construct(other);
+      }
+
+      //***********************************************************************
+      ~variant_storage()
+      {
+        destruct_current();
+      }
+
+      //***********************************************************************
+      variant_storage& operator =(const variant_storage& other)
+      {
+        if (this != &other)
+        {
+          destruct_current();
+          copy_construct(other);
+        }
+
+        return *this;
+      }
+
+      //***********************************************************************
+      variant_storage& operator =(variant_storage&& other)
+      {
+        if (this != &other)
+        {
+          destruct_current();
+          move_construct(other);
+        }
+
+        return *this;
+      }
+
+      //***********************************************************************
+      void destruct_current()
+      {
+        typedef void (*destroy_t)(void*);
+
+        static const destroy_t destroy[] = { &destroy_type<TTypes>... };
+
+        if (type_id != NO_TYPE_ID)
+        {
+          destroy[type_id](&data);
+          type_id = NO_TYPE_ID;
+        }
+      }
+
+      typename etl::aligned_storage<largest<TTypes...>::size, largest<TTypes...>::alignment>::type data;
+      type_id_t type_id;
+
+    private:
+
+      //***********************************************************************
+      void copy_construct(const variant_storage& other)
+      {
+        typedef void (*copy_t)(void*, const void*);
+
+        static const copy_t copy[] = { &copy_type<TTypes>... };
+
+        if (other.type_id != NO_TYPE_ID)
+        {
+          copy[other.type_id](&data, &other.data);
+          type_id = other.type_id;
+        }
+      }
+
+      //***********************************************************************
+      void move_construct(variant_storage& other)
+      {
+        typedef void (*move_t)(void*, void*);
+
+        static const move_t move[] = { &move_type<TTypes>... };
+
+        if (other.type_id != NO_TYPE_ID)
+        {
+          move[other.type_id](&data, &other.data);
+          type_id = other.type_id;
+        }
+      }
+
+      //***********************************************************************
+      template <typename T>
+      static void destroy_type(void* p)
+      {
+        static_cast<T*>(p)->~T();
+      }
+
+      //***********************************************************************
+      template <typename T>
+      static void copy_type(void* destination, const void* source)
+      {
+        ::new (destination) T(*static_cast<const T*>(source));
+      }
+
+      //***********************************************************************
+      template <typename T>
+      static void move_type(void* destination, void* source)
+      {
+        ::new (destination) T(std::move(*static_cast<T*>(source)));
+      }
+    };
+
+    //*************************************************************************
+    /// The storage for the variant when all of the types are trivially
+    /// copyable. The variant is then trivially copyable itself.
+    //*************************************************************************
+    template <typename... TTypes>
+    class variant_storage<true, TTypes...>
+    {
+    protected:
+
+      typedef uint_least8_t type_id_t;
+
+      static const type_id_t NO_TYPE_ID = integral_limits<type_id_t>::max;
+
+      //***********************************************************************
+      variant_storage()
+        : type_id(NO_TYPE_ID)
+      {
+      }
+
+      //***********************************************************************
+      void destruct_current()
+      {
+        type_id = NO_TYPE_ID;
+      }
+
+      typename etl::aligned_storage<largest<TTypes...>::size, largest<TTypes...>::alignment>::type data;
+      type_id_t type_id;
+    };
+  }
+
+  //***************************************************************************
+  /// A template class that can store any of the types defined in the template parameter list.
+  /// Supports up to 254 types.
+  /// Copies, moves, destruction and visits are dispatched through a table of
+  /// functions indexed by the type id.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename... TTypes>
+  class variant : private private_variant::variant_storage<private_variant::all_trivial<TTypes...>::value, TTypes...>
+  {
+  private:
+
+    typedef private_variant::variant_storage<private_variant::all_trivial<TTypes...>::value, TTypes...> storage_t;
+
+    typedef typename private_variant::first_type<TTypes...>::type first_t;
+
+  public:
+
+    //***************************************************************************
+    /// The type used for ids.
+    //***************************************************************************
+    typedef uint_least8_t type_id_t;
+
+    //***************************************************************************
+    /// The id a unsupported types.
+    //***************************************************************************
+    static const type_id_t UNSUPPORTED_TYPE_ID = integral_limits<type_id_t>::max;
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) < UNSUPPORTED_TYPE_ID, "Too many types");
+
+  private:
+
+    //***************************************************************************
+    /// Lookup the id of type.
+    //***************************************************************************
+    template <typename T>
+    struct Type_Id_Lookup
+    {
+      static const uint_least8_t type_id = private_variant::type_id_lookup<0, T, TTypes...>::value;
+    };
+
+    //***************************************************************************
+    /// Lookup for the id of type.
+    //***************************************************************************
+    template <typename T>
+    struct Type_Is_Supported : public integral_constant<bool, Type_Id_Lookup<T>::type_id != UNSUPPORTED_TYPE_ID>
+    {
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Base reader type functor class.
+    /// Allows for typesafe access to the stored value types.
+    //*************************************************************************
+    template <typename... RTypes>
+    using reader_type = private_variant::reader_type<RTypes...>;
+
+    //***************************************************************************
+    /// The base type for derived readers.
+    //***************************************************************************
+    typedef reader_type<TTypes...> reader;
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Sets the state of the instance to containing no valid data.
+    //***************************************************************************
+    variant()
+    {
+    }
+
+    //***************************************************************************
+    /// Constructor from a value of one of the types.
+    /// Unsupported types force a ETL_STATIC_ASSERT.
+    //***************************************************************************
+    template <typename T, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<T>::type, variant>::value, void>::type>
+    variant(T&& value)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      ETL_STATIC_ASSERT(Type_Is_Supported<type>::value, "Unsupported type");
+
+      ::new (static_cast<type*>(this->data)) type(std::forward<T>(value));
+      this->type_id = Type_Id_Lookup<type>::type_id;
+    }
+
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T& emplace(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(Type_Is_Supported<T>::value, "Unsupported type");
+
+      this->destruct_current();
+      ::new (static_cast<T*>(this->data)) T(std::forward<Args>(args)...);
+      this->type_id = Type_Id_Lookup<T>::type_id;
+
+      return *static_cast<T*>(this->data);
+    }
+
+    //***************************************************************************
+    /// Assignment from a value of one of the types.
+    ///\param value The value to assign.
+    //***************************************************************************
+    template <typename T, typename = typename etl::enable_if<!etl::is_same<typename etl::decay<T>::type, variant>::value, void>::type>
+    variant& operator =(T&& value)
+    {
+      typedef typename etl::decay<T>::type type;
+
+      ETL_STATIC_ASSERT(Type_Is_Supported<type>::value, "Unsupported type");
+
+      this->destruct_current();
+      ::new (static_cast<type*>(this->data)) type(std::forward<T>(value));
+      this->type_id = Type_Id_Lookup<type>::type_id;
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Checks if the type is the same as the current stored type.
+    ///\return <b>true</b> if the types are the same, otherwise <b>false</b>.
+    //***************************************************************************
+    template <typename... UTypes>
+    bool is_same_type(const variant<UTypes...>& other) const
+    {
+      static const type_id_t type_ids[] = { Type_Id_Lookup<UTypes>::type_id... };
+
+      return other.is_valid() && (type_ids[other.index()] == this->type_id);
+    }
+
+    //***************************************************************************
+    /// Calls the supplied reader instance.
+    /// The 'read' function appropriate to the current type is called with the stored value.
+    //***************************************************************************
+    void call(reader& r)
+    {
+      typedef void (*read_t)(reader&, void*);
+
+      static const read_t read[] = { &read_type<TTypes>... };
+
+      if (is_valid())
+      {
+        read[this->type_id](r, &this->data);
+      }
+    }
+
+    //***************************************************************************
+    /// Calls the visitor with the stored value.
+    /// The visitor must be callable with each of the types and return the same
+    /// type for each.
+    /// If asserts or exceptions are enabled, emits an etl::variant_invalid_exception
+    /// if the variant is not valid.
+    //***************************************************************************
+    template <typename TVisitor>
+    auto visit(TVisitor&& visitor) -> decltype(visitor(std::declval<first_t&>()))
+    {
+      typedef typename etl::remove_reference<TVisitor>::type   visitor_t;
+      typedef decltype(visitor(std::declval<first_t&>()))      result_t;
+      typedef result_t (*visit_t)(visitor_t&, void*);
+
+      static const visit_t visit_function[] = { &visit_type<visitor_t, result_t, TTypes>... };
+
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_invalid_exception));
+
+      return visit_function[this->type_id](visitor, &this->data);
+    }
+
+    //***************************************************************************
+    /// Calls the visitor with the stored value as const.
+    //***************************************************************************
+    template <typename TVisitor>
+    auto visit(TVisitor&& visitor) const -> decltype(visitor(std::declval<const first_t&>()))
+    {
+      typedef typename etl::remove_reference<TVisitor>::type   visitor_t;
+      typedef decltype(visitor(std::declval<const first_t&>())) result_t;
+      typedef result_t (*visit_t)(visitor_t&, const void*);
+
+      static const visit_t visit_function[] = { &visit_const_type<visitor_t, result_t, TTypes>... };
+
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_invalid_exception));
+
+      return visit_function[this->type_id](visitor, &this->data);
+    }
+
+    //***************************************************************************
+    /// Checks whether a valid value is currently stored.
+    ///\return <b>true</b> if the value is valid, otherwise <b>false</b>.
+    //***************************************************************************
+    bool is_valid() const
+    {
+      return this->type_id != UNSUPPORTED_TYPE_ID;
+    }
+
+    //***************************************************************************
+    /// Checks to see if the type currently stored is the same as that specified in the template parameter.
+    ///\return <b>true</b> if it is the specified type, otherwise <b>false</b>.
+    //***************************************************************************
+    template <typename T>
+    bool is_type() const
+    {
+      return this->type_id == Type_Id_Lookup<T>::type_id;
+    }
+
+    //***************************************************************************
+    /// Gets the index of the type currently stored or UNSUPPORTED_TYPE_ID
+    //***************************************************************************
+    size_t index() const
+    {
+      return this->type_id;
+    }
+
+    //***************************************************************************
+    /// Clears the value to 'no valid stored value'.
+    //***************************************************************************
+    void clear()
+    {
+      this->destruct_current();
+    }
+
+    //***************************************************************************
+    /// Gets the value stored as the specified template type.
+    /// Throws a variant_incorrect_type_exception if the actual type is not that specified.
+    ///\return A reference to the value.
+    //***************************************************************************
+    template <typename T>
+    T& get()
+    {
+      ETL_STATIC_ASSERT(Type_Is_Supported<T>::value, "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return static_cast<T&>(this->data);
+    }
+
+    //***************************************************************************
+    /// Gets the value stored as the specified template type.
+    /// Throws a variant_incorrect_type_exception if the actual type is not that specified.
+    ///\return A const reference to the value.
+    //***************************************************************************
+    template <typename T>
+    const T& get() const
+    {
+      ETL_STATIC_ASSERT(Type_Is_Supported<T>::value, "Unsupported type");
+      ETL_ASSERT(is_type<T>(), ETL_ERROR(variant_incorrect_type_exception));
+
+      return static_cast<const T&>(this->data);
+    }
+
+    //***************************************************************************
+    /// Gets the value stored as the specified template type.
+    ///\return A reference to the value.
+    //***************************************************************************
+    template <typename TBase>
+    TBase& upcast()
+    {
+      typedef TBase& (*upcast_t)(void*);
+
+      static const upcast_t upcast_function[] = { &upcast_type<TBase, TTypes>... };
+
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_invalid_exception));
+
+      return upcast_function[this->type_id](&this->data);
+    }
+
+    //***************************************************************************
+    /// Gets the value stored as the specified template type.
+    ///\return A const reference to the value.
+    //***************************************************************************
+    template <typename TBase>
+    const TBase& upcast() const
+    {
+      typedef const TBase& (*upcast_t)(const void*);
+
+      static const upcast_t upcast_function[] = { &upcast_const_type<TBase, TTypes>... };
+
+      ETL_ASSERT(is_valid(), ETL_ERROR(variant_invalid_exception));
+
+      return upcast_function[this->type_id](&this->data);
+    }
+
+    //***************************************************************************
+    /// Conversion operator for each type.
+    //***************************************************************************
+    template <typename T, typename = typename etl::enable_if<Type_Is_Supported<typename etl::remove_cv<T>::type>::value, void>::type>
+    operator T&()
+    {
+      return get<typename etl::remove_cv<T>::type>();
+    }
+
+    //***************************************************************************
+    /// Checks if the template type is supported by the implementation of variant..
+    ///\return <b>true</b> if the type is supported, otherwise <b>false</b>.
+    //***************************************************************************
+    template <typename T>
+    static bool is_supported_type()
+    {
+      return Type_Is_Supported<T>::value;
+    }
+
+  private:
+
+    //***************************************************************************
+    template <typename T>
+    static void read_type(reader& r, void* p)
+    {
+      r.read(*static_cast<T*>(p));
+    }
+
+    //***************************************************************************
+    template <typename TVisitor, typename TResult, typename T>
+    static TResult visit_type(TVisitor& visitor, void* p)
+    {
+      return visitor(*static_cast<T*>(p));
+    }
+
+    //***************************************************************************
+    template <typename TVisitor, typename TResult, typename T>
+    static TResult visit_const_type(TVisitor& visitor, const void* p)
+    {
+      return visitor(*static_cast<const T*>(p));
+    }
+
+    //***************************************************************************
+    template <typename TBase, typename T>
+    static TBase& upcast_type(void* p)
+    {
+      return *static_cast<T*>(p);
+    }
+
+    //***************************************************************************
+    template <typename TBase, typename T>
+    static const TBase& upcast_const_type(const void* p)
+    {
+      return *static_cast<const T*>(p);
+    }
+  };
+
+  //***************************************************************************
+  /// Calls the visitor with the value stored in the variant.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename TVisitor, typename... TTypes>
+  auto visit(TVisitor&& visitor, etl::variant<TTypes...>& v) -> decltype(v.visit(visitor))
+  {
+    return v.visit(visitor);
+  }
+
+  //***************************************************************************
+  /// Calls the visitor with the value stored in the const variant.
+  ///\ingroup variant
+  //***************************************************************************
+  template <typename TVisitor, typename... TTypes>
+  auto visit(TVisitor&& visitor, const etl::variant<TTypes...>& v) -> decltype(v.visit(visitor))
+  {
+    return v.visit(visitor);
+  }
+
+#else
   //***************************************************************************
   /// A template class that can store any of the types defined in the template parameter list.
   /// Supports up to 8 types.
@@ -1029,6 +1650,7 @@ namespace etl
     //***************************************************************************
     type_id_t type_id;
   };
+#endif
 }
 
 #undef ETL_FILE
@@ -414,7 +414,7 @@ namespace etl
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
     ///\param value The value to add.
     //*********************************************************************
-    void push_back(parameter_t value)
+    void push_back(const_reference value)
     {
 #if defined(ETL_CHECK_PUSH_POP)
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
@@ -422,6 +422,22 @@ namespace etl
       create_back(value);
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Inserts a value at the end of the vector by moving it.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param value The value to add.
+    //*********************************************************************
+    void push_back(T&& value)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+      create_back(std::move(value));
+    }
+#endif
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*********************************************************************
     /// Constructs a value at the end of the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -485,6 +501,23 @@ namespace etl
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
     }
+#else
+    //*********************************************************************
+    /// Constructs a value at the end of the vector.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param args The constructor arguments.
+    //*********************************************************************
+    template <typename ... Args>
+    void emplace_back(Args&& ... args)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+      ::new (p_end) T(std::forward<Args>(args)...);
+      ++p_end;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+#endif
 
     //*************************************************************************
     /// Removes an element from the end of the vector.
@@ -504,7 +537,7 @@ namespace etl
     ///\param position The position to insert before.
     ///\param value    The value to insert.
     //*********************************************************************
-    iterator insert(iterator position, parameter_t value)
+    iterator insert(iterator position, const_reference value)
     {
       ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
@@ -514,14 +547,41 @@ namespace etl
       }
       else
       {
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
-        *position = value;
+        // 'value' may refer to an element that is about to be shifted.
+        T copy(value);
+        shift_up(position);
+        *position = ETL_MOVE(copy);
       }
 
       return position;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Inserts a value to the vector by moving it.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    ///\param position The position to insert before.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(iterator position, T&& value)
+    {
+      ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
+
+      if (position == end())
+      {
+        create_back(std::move(value));
+      }
+      else
+      {
+        shift_up(position);
+        *position = std::move(value);
+      }
+
+      return position;
+    }
+#endif
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT)
     //*************************************************************************
     /// Emplaces a value to the vextor at the specified position.
     //*************************************************************************
@@ -540,8 +600,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
+        shift_up(position);
         (*position).~T();
       }
 
@@ -568,8 +627,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
+        shift_up(position);
         (*position).~T();
       }
 
@@ -596,8 +654,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
+        shift_up(position);
         (*position).~T();
       }
 
@@ -624,8 +681,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 1, p_end);
+        shift_up(position);
         (*position).~T();
       }
 
@@ -633,6 +689,34 @@ namespace etl
 
       return position;
     }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the vector at the specified position.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(iterator position, Args&& ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(vector_full));
+
+      void* p;
+
+      if (position == end())
+      {
+        p = p_end++;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+      else
+      {
+        p = etl::addressof(*position);
+        shift_up(position);
+        (*position).~T();
+      }
+
+      ::new (p) T(std::forward<Args>(args)...);
+
+      return position;
+    }
+#endif
 
     //*********************************************************************
     /// Inserts 'n' values to the vector.
@@ -645,6 +729,14 @@ namespace etl
     {
       ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if (n == 0)
+      {
+        return;
+      }
+
+      // 'value' may refer to an element that is about to be moved.
+      const T copy(value);
+
       size_t insert_n = n;
       size_t insert_begin = std::distance(begin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -671,18 +763,18 @@ namespace etl
       size_t construct_new_n = insert_n - copy_new_n;
 
       // Construct old.
-      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
+      etl::uninitialized_move_n(p_end - construct_old_n, construct_old_n, p_construct_old);
       ETL_ADD_DEBUG_COUNT(construct_old_n);
 
-      // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      // Move old.
+      etl::move_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
-      etl::uninitialized_fill_n(p_end, construct_new_n, value);
+      etl::uninitialized_fill_n(p_end, construct_new_n, copy);
       ETL_ADD_DEBUG_COUNT(construct_new_n);
 
       // Copy new.
-      std::fill_n(p_buffer + insert_begin, copy_new_n, value);
+      std::fill_n(p_buffer + insert_begin, copy_new_n, copy);
 
       p_end += n;
     }
@@ -702,6 +794,11 @@ namespace etl
 
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if (count == 0)
+      {
+        return;
+      }
+
       size_t insert_n = count;
       size_t insert_begin = std::distance(begin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -728,11 +825,11 @@ namespace etl
       size_t construct_new_n = insert_n - copy_new_n;
 
       // Construct old.
-      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
+      etl::uninitialized_move_n(p_end - construct_old_n, construct_old_n, p_construct_old);
       ETL_ADD_DEBUG_COUNT(construct_old_n);
 
-      // Copy old.
-      etl::copy_n(p_buffer + insert_begin, copy_old_n, p_buffer + insert_end);
+      // Move old.
+      etl::move_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
 
       // Construct new.
       etl::uninitialized_copy_n(first + copy_new_n, construct_new_n, p_end);
@@ -751,7 +848,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
+      etl::move(i_element + 1, end(), i_element);
       destroy_back();
 
       return i_element;
@@ -773,7 +870,7 @@ namespace etl
       }
       else
       {
-        std::copy(last, end(), first);
+        etl::move(last, end(), first);
         size_t n_delete = std::distance(first, last);
 
         // Destroy the elements left over at the end.
@@ -798,6 +895,22 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    /// The elements are moved and 'rhs' is left empty.
+    //*************************************************************************
+    ivector& operator = (ivector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Gets the current size of the vector.
     ///\return The current size of the vector.
@@ -853,6 +966,24 @@ namespace etl
     {
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Moves the elements of 'other' to this vector and clears 'other'.
+    /// If asserts or exceptions are enabled, emits vector_full if 'other' is larger than the capacity.
+    //*********************************************************************
+    void move_container(ivector&& other)
+    {
+      ETL_ASSERT(other.size() <= CAPACITY, ETL_ERROR(vector_full));
+
+      initialise();
+
+      p_end = etl::uninitialized_move(other.begin(), other.end(), p_buffer);
+      ETL_ADD_DEBUG_COUNT(int32_t(other.size()));
+
+      other.initialise();
+    }
+#endif
+
     //*********************************************************************
     /// Initialise the vector.
     //*********************************************************************
@@ -893,7 +1024,7 @@ namespace etl
     //*********************************************************************
     /// Create a new element with a value at the back
     //*********************************************************************
-    inline void create_back(parameter_t value)
+    inline void create_back(const_reference value)
     {
       etl::create_copy_at(p_end, value);
       ETL_INCREMENT_DEBUG_COUNT;
@@ -901,6 +1032,29 @@ namespace etl
       ++p_end;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*********************************************************************
+    /// Create a new element at the back by moving a value.
+    //*********************************************************************
+    inline void create_back(T&& value)
+    {
+      ::new (p_end) T(std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      ++p_end;
+    }
+#endif
+
+    //*********************************************************************
+    /// Moves the elements from 'position' to the end up by one.
+    /// The element at 'position' is left in a moved from state.
+    //*********************************************************************
+    inline void shift_up(iterator position)
+    {
+      create_back(ETL_MOVE(back()));
+      etl::move_backward(position, p_end - 2, p_end - 1);
+    }
+
     //*********************************************************************
     /// Destroy an element at the back.
     //*********************************************************************
@@ -1087,6 +1241,18 @@ namespace etl
       this->assign(other.begin(), other.end());
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move constructor.
+    /// The elements are moved and 'other' is left empty.
+    //*************************************************************************
+    vector(vector&& other)
+      : etl::ivector<T>(reinterpret_cast<T*>(&buffer), MAX_SIZE)
+    {
+      this->move_container(std::move(other));
+    }
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1108,6 +1274,21 @@ namespace etl
       return *this;
     }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    vector& operator = (vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(std::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
     //*************************************************************************
@@ -64,7 +64,7 @@ namespace etl
   ///\return <b>true</b> if the first vector is lexicographically less than the second, otherwise <b>false</b>
   ///\ingroup vector
   //***************************************************************************
-  inline bool operator <(const etl::pvoidvector& lhs, const etl::pvoidvector& rhs)
+  bool operator <(const etl::pvoidvector& lhs, const etl::pvoidvector& rhs)
   {
     return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
   }
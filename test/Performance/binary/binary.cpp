@@ -0,0 +1,79 @@
+// binary.cpp : Times the etl::binary bit functions.
+//
+// Build once with a profile that enables the builtin bit functions and once
+// with one that does not, then compare the results.
+//   g++ -O2 -DPROFILE_GCC_GENERIC  -I../../../include/etl -I../../../include/etl/profiles binary.cpp
+//   g++ -O2 -DPROFILE_CPP14_GENERIC -I../../../include/etl -I../../../include/etl/profiles binary.cpp
+// On x86 add -mpopcnt (or a suitable -march) to allow count_bits to use the
+// population count instruction.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "binary.h"
+
+const size_t TESTSIZE        = 1024 * 1024;
+const size_t TESTINTERATIONS = 64;
+
+std::vector<uint32_t> values32(TESTSIZE);
+std::vector<uint64_t> values64(TESTSIZE);
+
+//*****************************************************************************
+template <typename T, typename TFunction>
+void Time(const char* name, const std::vector<T>& values, TFunction function)
+{
+  uint64_t sum = 0;
+
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    for (size_t j = 0; j < values.size(); ++j)
+    {
+      sum += function(values[j]);
+    }
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(TESTINTERATIONS * values.size());
+
+  std::cout << std::left << std::setw(28) << name << std::right << std::setw(8) << std::fixed << std::setprecision(3) << ns << " ns  (" << (sum & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < TESTSIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    values32[i] = uint32_t(seed);
+    values64[i] = seed;
+  }
+
+#if ETL_BUILTIN_BIT_FUNCTIONS_SUPPORTED
+  std::cout << "Builtin bit functions\n";
+#else
+  std::cout << "Portable bit functions\n";
+#endif
+
+  Time("count_bits(uint32_t)",           values32, [](uint32_t v) { return etl::count_bits(v); });
+  Time("count_bits(uint64_t)",           values64, [](uint64_t v) { return etl::count_bits(v); });
+  Time("parity(uint32_t)",               values32, [](uint32_t v) { return etl::parity(v); });
+  Time("parity(uint64_t)",               values64, [](uint64_t v) { return etl::parity(v); });
+  Time("reverse_bits(uint32_t)",         values32, [](uint32_t v) { return etl::reverse_bits(v); });
+  Time("reverse_bits(uint64_t)",         values64, [](uint64_t v) { return etl::reverse_bits(v); });
+  Time("reverse_bytes(uint32_t)",        values32, [](uint32_t v) { return etl::reverse_bytes(v); });
+  Time("reverse_bytes(uint64_t)",        values64, [](uint64_t v) { return etl::reverse_bytes(v); });
+  Time("count_trailing_zeros(uint32_t)", values32, [](uint32_t v) { return etl::count_trailing_zeros(v); });
+  Time("count_trailing_zeros(uint64_t)", values64, [](uint64_t v) { return etl::count_trailing_zeros(v); });
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+// btree_map.cpp : Compares etl::btree_map with etl::map and etl::flat_map.
+//
+// Times random inserts, random lookups, a full iteration and short range scans
+// on 100000 entry maps.
+//   g++ -O2 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles btree_map.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "btree_map.h"
+#include "map.h"
+#include "flat_map.h"
+
+const size_t SIZE       = 100000;
+const size_t SCANLENGTH = 100;
+
+typedef etl::btree_map<uint32_t, uint32_t, SIZE> BTree;
+typedef etl::map<uint32_t, uint32_t, SIZE>       Map;
+typedef etl::flat_map<uint32_t, uint32_t, SIZE>  FlatMap;
+
+BTree   btree;
+Map     map;
+FlatMap flat_map;
+
+std::vector<uint32_t> keys;
+std::vector<uint32_t> lookups;
+
+//*****************************************************************************
+template <typename TFunction>
+void Time(const char* name, size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  uint64_t sum = function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+
+  std::cout << "  " << std::left << std::setw(12) << name << std::right << std::setw(10) << std::fixed << std::setprecision(1) << ns << " ns/op  (" << (sum & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, TMap& data)
+{
+  std::cout << name << "\n";
+
+  Time("insert", keys.size(), [&data]()
+  {
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      data.insert(std::make_pair(keys[i], uint32_t(i)));
+    }
+
+    return uint64_t(data.size());
+  });
+
+  Time("find", lookups.size(), [&data]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      sum += data.find(lookups[i])->second;
+    }
+
+    return sum;
+  });
+
+  Time("iterate", data.size() * 10, [&data]()
+  {
+    uint64_t sum = 0;
+
+    for (int pass = 0; pass < 10; ++pass)
+    {
+      for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        sum += itr->second;
+      }
+    }
+
+    return sum;
+  });
+
+  Time("range scan", lookups.size() * SCANLENGTH, [&data]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      typename TMap::const_iterator itr = data.lower_bound(lookups[i]);
+
+      for (size_t j = 0; (j < SCANLENGTH) && (itr != data.end()); ++j, ++itr)
+      {
+        sum += itr->second;
+      }
+    }
+
+    return sum;
+  });
+}
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    keys.push_back(uint32_t(i * 7));
+  }
+
+  // Random insertion order.
+  for (size_t i = SIZE - 1; i > 0; --i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    std::swap(keys[i], keys[seed % (i + 1)]);
+  }
+
+  lookups = keys;
+  std::reverse(lookups.begin(), lookups.end());
+
+  Run("etl::btree_map", btree);
+  Run("etl::map",       map);
+  Run("etl::flat_map",  flat_map);
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+// compressed_bitmap.cpp : Compares etl::compressed_bitmap with etl::bitset.
+//
+// Both hold values from a 4M value range, at a sparse, a clustered and a dense
+// population. Reports the storage used and the time for set, test and the set
+// operations.
+//   g++ -O2 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles compressed_bitmap.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "compressed_bitmap.h"
+#include "bitset.h"
+
+const uint32_t RANGE           = 4 * 1024 * 1024;
+const size_t   TESTINTERATIONS = 16;
+
+typedef etl::compressed_bitmap<RANGE / 65536, RANGE / 65536, 4096> Compressed;
+typedef etl::bitset<RANGE>                                          Dense;
+
+Compressed compressed_a;
+Compressed compressed_b;
+Compressed compressed_r;
+Dense      dense_a;
+Dense      dense_b;
+Dense      dense_r;
+
+std::vector<uint32_t> values_a;
+std::vector<uint32_t> values_b;
+
+//*****************************************************************************
+template <typename TFunction>
+void Time(const char* name, TFunction function)
+{
+  size_t sum = 0;
+
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    sum += function();
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double us = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(TESTINTERATIONS * 1000);
+
+  std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(12) << std::fixed << std::setprecision(1) << us << " us  (" << (sum & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+void Generate(std::vector<uint32_t>& values, uint64_t seed, size_t n, uint32_t cluster)
+{
+  values.clear();
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    uint32_t first = uint32_t(seed) % RANGE;
+
+    for (uint32_t j = 0; (j < cluster) && ((first + j) < RANGE); ++j)
+    {
+      values.push_back(first + j);
+    }
+  }
+}
+
+//*****************************************************************************
+void Run(const char* name, size_t n, uint32_t cluster)
+{
+  Generate(values_a, 1, n, cluster);
+  Generate(values_b, 2, n, cluster);
+
+  std::cout << name << " (" << values_a.size() << " values)\n";
+
+  Time("compressed set", []()
+  {
+    compressed_a.reset();
+    for (size_t i = 0; i < values_a.size(); ++i) compressed_a.set(values_a[i]);
+    return compressed_a.count();
+  });
+
+  Time("bitset set", []()
+  {
+    dense_a.reset();
+    for (size_t i = 0; i < values_a.size(); ++i) dense_a.set(values_a[i]);
+    return dense_a.count();
+  });
+
+  compressed_b.reset();
+  dense_b.reset();
+
+  for (size_t i = 0; i < values_b.size(); ++i)
+  {
+    compressed_b.set(values_b[i]);
+    dense_b.set(values_b[i]);
+  }
+
+  Time("compressed test", []()
+  {
+    size_t n = 0;
+    for (size_t i = 0; i < values_b.size(); ++i) n += compressed_a.test(values_b[i]) ? 1 : 0;
+    return n;
+  });
+
+  Time("bitset test", []()
+  {
+    size_t n = 0;
+    for (size_t i = 0; i < values_b.size(); ++i) n += dense_a.test(values_b[i]) ? 1 : 0;
+    return n;
+  });
+
+  Time("compressed and", []() { compressed_r = compressed_a; compressed_r &= compressed_b; return compressed_r.count(); });
+  Time("bitset and",     []() { dense_r = dense_a; dense_r &= dense_b; return dense_r.count(); });
+  Time("compressed or",  []() { compressed_r = compressed_a; compressed_r |= compressed_b; return compressed_r.count(); });
+  Time("bitset or",      []() { dense_r = dense_a; dense_r |= dense_b; return dense_r.count(); });
+  Time("compressed xor", []() { compressed_r = compressed_a; compressed_r ^= compressed_b; return compressed_r.count(); });
+  Time("bitset xor",     []() { dense_r = dense_a; dense_r ^= dense_b; return dense_r.count(); });
+
+  std::cout << "  serialized size " << compressed_a.serialized_size() << " bytes, bitset " << (RANGE / 8) << " bytes\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  Run("Sparse",    2000,  1);
+  Run("Clustered", 200,   1000);
+  Run("Dense",     2000000, 1);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+// delegate_call.cpp : Times calls through etl::delegate against etl::ifunction
+// and std::function.
+//
+// Each callable is chosen at run time from a table of two, so that the
+// compiler cannot see through the call and inline it.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles delegate_call.cpp
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+
+#include "function.h"
+#include "delegate.h"
+
+const size_t CALLS = 100000000;
+
+volatile size_t selector = 0;
+
+//*****************************************************************************
+struct Accumulator
+{
+  Accumulator()
+    : total(0)
+  {
+  }
+
+  void add(int i)
+  {
+    total += i;
+  }
+
+  void subtract(int i)
+  {
+    total -= i;
+  }
+
+  uint64_t total;
+};
+
+Accumulator accumulator;
+
+uint64_t free_total = 0;
+
+//*****************************************************************************
+void free_add(int i)
+{
+  free_total += i;
+}
+
+void free_subtract(int i)
+{
+  free_total -= i;
+}
+
+//*****************************************************************************
+template <typename TCallable>
+void Time(const char* name, TCallable& callable, const uint64_t& total)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t i = 0; i < CALLS; ++i)
+  {
+    callable(int(i));
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(CALLS);
+
+  std::cout << "  " << std::left << std::setw(32) << name << std::right << std::setw(8) << std::fixed << std::setprecision(3) << ns << " ns/call  (" << (total & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::delegate<void(int)> Delegate;
+
+  // Member function.
+  etl::function_mp<Accumulator, int, &Accumulator::add>      ifunction_add(accumulator);
+  etl::function_mp<Accumulator, int, &Accumulator::subtract> ifunction_subtract(accumulator);
+  etl::ifunction<int>* ifunctions[] = { &ifunction_add, &ifunction_subtract };
+
+  Delegate member_delegates[] = { Delegate::create<Accumulator, &Accumulator::add>(accumulator),
+                                  Delegate::create<Accumulator, &Accumulator::subtract>(accumulator) };
+
+  Delegate runtime_member_delegates[] = { Delegate::create(accumulator, &Accumulator::add),
+                                          Delegate::create(accumulator, &Accumulator::subtract) };
+
+  Delegate lambda_delegates[] = { Delegate([](int i) { accumulator.add(i); }),
+                                  Delegate([](int i) { accumulator.subtract(i); }) };
+
+  std::function<void(int)> std_functions[] = { std::bind(&Accumulator::add, &accumulator, std::placeholders::_1),
+                                               std::bind(&Accumulator::subtract, &accumulator, std::placeholders::_1) };
+
+  std::function<void(int)> std_lambdas[] = { [](int i) { accumulator.add(i); },
+                                             [](int i) { accumulator.subtract(i); } };
+
+  // Free function.
+  etl::function_fp<int, free_add>      ifunction_free_add;
+  etl::function_fp<int, free_subtract> ifunction_free_subtract;
+  etl::ifunction<int>* ifunctions_free[] = { &ifunction_free_add, &ifunction_free_subtract };
+
+  Delegate free_delegates[] = { Delegate::create<free_add>(), Delegate::create<free_subtract>() };
+
+  Delegate runtime_free_delegates[] = { Delegate(free_add), Delegate(free_subtract) };
+
+  std::function<void(int)> std_free_functions[] = { free_add, free_subtract };
+
+  size_t s = selector;
+
+  std::cout << "Member function\n";
+  Time("etl::ifunction (function_mp)", *ifunctions[s], accumulator.total);
+  Time("etl::delegate compile time", member_delegates[s], accumulator.total);
+  Time("etl::delegate run time", runtime_member_delegates[s], accumulator.total);
+  Time("etl::delegate lambda", lambda_delegates[s], accumulator.total);
+  Time("std::function bind", std_functions[s], accumulator.total);
+  Time("std::function lambda", std_lambdas[s], accumulator.total);
+
+  std::cout << "Free function\n";
+  Time("etl::ifunction (function_fp)", *ifunctions_free[s], free_total);
+  Time("etl::delegate compile time", free_delegates[s], free_total);
+  Time("etl::delegate run time", runtime_free_delegates[s], free_total);
+  Time("std::function", std_free_functions[s], free_total);
+
+  std::cout << "sizeof(etl::delegate<void(int)>) = " << sizeof(Delegate) << "\n";
+  std::cout << "sizeof(std::function<void(int)>) = " << sizeof(std::function<void(int)>) << "\n";
+
+  return 0;
+}
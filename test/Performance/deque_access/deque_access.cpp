@@ -0,0 +1,237 @@
+// deque_access.cpp : Times element access and bulk copies in etl::deque
+// against std::deque.
+//
+// The deques are first rotated so that the contents wrap around the end of
+// the etl::deque buffer, as they do in use.
+// 'array_one/two' sums the two contiguous runs directly, with no index
+// arithmetic per element.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles deque_access.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <deque>
+
+#include "deque.h"
+
+const size_t SIZE    = 4096;
+const size_t REPEATS = 2000;
+
+typedef etl::deque<uint32_t, SIZE> EtlDeque;
+typedef std::deque<uint32_t>       StdDeque;
+
+EtlDeque etl_deque;
+StdDeque std_deque;
+
+std::vector<uint32_t> source;
+std::vector<uint32_t> indexes;
+
+volatile uint64_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+}
+
+//*****************************************************************************
+template <typename TDeque>
+void Fill(TDeque& deque)
+{
+  deque.clear();
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    deque.push_back(source[i]);
+  }
+
+  // Wrap the contents.
+  for (size_t i = 0; i < (SIZE / 3); ++i)
+  {
+    deque.pop_front();
+    deque.push_back(source[i]);
+  }
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double SequentialIndex(TDeque& deque)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < deque.size(); ++i)
+      {
+        sum += deque[i];
+      }
+    }
+
+    sink = sum;
+  });
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double RandomIndex(TDeque& deque)
+{
+  return Time(indexes.size() * (REPEATS / 4), [&]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t r = 0; r < (REPEATS / 4); ++r)
+    {
+      for (size_t i = 0; i < indexes.size(); ++i)
+      {
+        sum += deque[indexes[i]];
+      }
+    }
+
+    sink = sum;
+  });
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double Iterate(TDeque& deque)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (typename TDeque::const_iterator itr = deque.begin(); itr != deque.end(); ++itr)
+      {
+        sum += *itr;
+      }
+    }
+
+    sink = sum;
+  });
+}
+
+//*****************************************************************************
+double ArrayRanges(EtlDeque& deque)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    uint64_t sum = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      EtlDeque::array_range one = deque.array_one();
+      EtlDeque::array_range two = deque.array_two();
+
+      for (size_t i = 0; i < one.size(); ++i)
+      {
+        sum += one[i];
+      }
+
+      for (size_t i = 0; i < two.size(); ++i)
+      {
+        sum += two[i];
+      }
+    }
+
+    sink = sum;
+  });
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double Assign(TDeque& deque)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      deque.assign(source.data(), source.data() + SIZE);
+    }
+  });
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double InsertBack(TDeque& deque)
+{
+  const size_t half = SIZE / 2;
+
+  return Time(half * REPEATS, [&]()
+  {
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      deque.insert(deque.end(), source.data(), source.data() + half);
+      deque.erase(deque.begin(), deque.begin() + half);
+    }
+  });
+}
+
+//*****************************************************************************
+template <typename TDeque>
+double InsertFront(TDeque& deque)
+{
+  const size_t half = SIZE / 2;
+
+  return Time(half * REPEATS, [&]()
+  {
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      deque.insert(deque.begin(), source.data(), source.data() + half);
+      deque.erase(deque.end() - half, deque.end());
+    }
+  });
+}
+
+//*****************************************************************************
+void Print(const char* name, double etl_ns, double std_ns)
+{
+  std::cout << "  " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(3)
+            << std::setw(10) << etl_ns << std::setw(12) << std_ns << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    source.push_back(uint32_t(seed));
+    indexes.push_back(uint32_t(seed >> 32) % SIZE);
+  }
+
+  std::cout << SIZE << " uint32_t          etl::deque   std::deque  (ns/element)\n";
+
+  Fill(etl_deque);
+  Fill(std_deque);
+  Print("operator[] sequential", SequentialIndex(etl_deque), SequentialIndex(std_deque));
+  Print("operator[] random", RandomIndex(etl_deque), RandomIndex(std_deque));
+  Print("iterate", Iterate(etl_deque), Iterate(std_deque));
+  Print("array_one/two", ArrayRanges(etl_deque), 0.0);
+
+  Print("assign", Assign(etl_deque), Assign(std_deque));
+
+  Fill(etl_deque);
+  Fill(std_deque);
+  etl_deque.erase(etl_deque.begin(), etl_deque.begin() + SIZE / 2);
+  std_deque.erase(std_deque.begin(), std_deque.begin() + SIZE / 2);
+  Print("insert range at back", InsertBack(etl_deque), InsertBack(std_deque));
+  Print("insert range at front", InsertFront(etl_deque), InsertFront(std_deque));
+
+  return 0;
+}
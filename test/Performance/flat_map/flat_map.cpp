@@ -0,0 +1,136 @@
+// flat_map.cpp : Times etl::flat_map lookups.
+//
+// Compares std::lower_bound over the element pointers (the previous search),
+// the branchless search of the key array, and the frozen Eytzinger layout,
+// for maps from cache resident to larger than the last level cache.
+//   g++ -O2 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles flat_map.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "flat_map.h"
+
+const size_t MAX_SIZE = 1000000;
+const size_t LOOKUPS  = 1000000;
+
+typedef etl::flat_map<uint32_t, uint32_t, MAX_SIZE> FlatMap;
+
+FlatMap flat_map;
+
+std::vector<uint32_t> lookups;
+
+//*****************************************************************************
+struct Compare
+{
+  bool operator ()(const FlatMap::value_type& element, uint32_t key) const
+  {
+    return element.first < key;
+  }
+};
+
+//*****************************************************************************
+template <typename TFunction>
+void Time(const char* name, size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  uint64_t sum = function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+
+  std::cout << "  " << std::left << std::setw(16) << name << std::right << std::setw(10) << std::fixed << std::setprecision(1) << ns << " ns/op  (" << (sum & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+void Run(size_t size)
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  flat_map.clear();
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    flat_map.insert(std::make_pair(uint32_t(i * 3), uint32_t(i)));
+  }
+
+  lookups.clear();
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    lookups.push_back(uint32_t(seed % (size * 3)));
+  }
+
+  std::cout << size << " entries\n";
+
+  Time("std::lower_bound", lookups.size(), []()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      FlatMap::const_iterator itr = std::lower_bound(flat_map.cbegin(), flat_map.cend(), lookups[i], Compare());
+      sum += (itr != flat_map.cend()) ? itr->second : 0;
+    }
+
+    return sum;
+  });
+
+  Time("lower_bound", lookups.size(), []()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      FlatMap::const_iterator itr = flat_map.lower_bound(lookups[i]);
+      sum += (itr != flat_map.cend()) ? itr->second : 0;
+    }
+
+    return sum;
+  });
+
+  flat_map.freeze();
+
+  Time("frozen", lookups.size(), []()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      FlatMap::const_iterator itr = flat_map.lower_bound(lookups[i]);
+      sum += (itr != flat_map.cend()) ? itr->second : 0;
+    }
+
+    return sum;
+  });
+
+  Time("frozen find", lookups.size(), []()
+  {
+    uint64_t sum = 0;
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      FlatMap::const_iterator itr = flat_map.find(lookups[i]);
+      sum += (itr != flat_map.cend()) ? itr->second : 0;
+    }
+
+    return sum;
+  });
+}
+
+//*****************************************************************************
+int main()
+{
+  Run(1000);
+  Run(100000);
+  Run(MAX_SIZE);
+
+  return 0;
+}
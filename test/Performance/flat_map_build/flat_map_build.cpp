@@ -0,0 +1,116 @@
+// flat_map_build.cpp : Times building an etl::flat_map from a range.
+//
+// Compares inserting the entries one at a time (the previous range insert)
+// with the bulk range insert, which sorts the new entries and merges them in
+// one pass, and with assign_sorted for input that is already in key order.
+// Also times adding a batch to a map that is already half full.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles flat_map_build.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "flat_map.h"
+
+const size_t MAX_SIZE = 50000;
+
+typedef etl::flat_map<uint32_t, uint32_t, MAX_SIZE> FlatMap;
+typedef std::pair<uint32_t, uint32_t>              Entry;
+
+FlatMap flat_map;
+
+std::vector<Entry> shuffled;
+std::vector<Entry> sorted;
+
+//*****************************************************************************
+template <typename TFunction>
+void Time(const char* name, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ms = double(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()) / 1000.0;
+
+  std::cout << "  " << std::left << std::setw(28) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2) << ms << " ms  (" << flat_map.size() << ")\n";
+}
+
+//*****************************************************************************
+void Run(size_t size)
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  shuffled.clear();
+
+  for (size_t i = 0; i < size; ++i)
+  {
+    shuffled.push_back(Entry(uint32_t(i * 3), uint32_t(i)));
+  }
+
+  for (size_t i = size - 1; i > 0; --i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    std::swap(shuffled[i], shuffled[seed % (i + 1)]);
+  }
+
+  sorted = shuffled;
+  std::sort(sorted.begin(), sorted.end());
+
+  std::cout << size << " entries\n";
+
+  Time("one at a time", []()
+  {
+    flat_map.clear();
+
+    for (size_t i = 0; i < shuffled.size(); ++i)
+    {
+      flat_map.insert(shuffled[i]);
+    }
+  });
+
+  Time("insert(first, last)", []()
+  {
+    flat_map.clear();
+    flat_map.insert(shuffled.begin(), shuffled.end());
+  });
+
+  Time("assign_sorted", []()
+  {
+    flat_map.assign_sorted(sorted.begin(), sorted.end());
+  });
+
+  const size_t half = shuffled.size() / 2;
+
+  flat_map.assign(shuffled.begin(), shuffled.begin() + half);
+
+  Time("half, one at a time", [half]()
+  {
+    for (size_t i = half; i < shuffled.size(); ++i)
+    {
+      flat_map.insert(shuffled[i]);
+    }
+  });
+
+  flat_map.assign(shuffled.begin(), shuffled.begin() + half);
+
+  Time("half, insert(first, last)", [half]()
+  {
+    flat_map.insert(shuffled.begin() + half, shuffled.end());
+  });
+}
+
+//*****************************************************************************
+int main()
+{
+  Run(1000);
+  Run(10000);
+  Run(MAX_SIZE);
+
+  return 0;
+}
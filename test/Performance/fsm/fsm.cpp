@@ -0,0 +1,255 @@
+// fsm.cpp : Times etl::fsm, etl::queued_fsm and etl::fsm_table for the same
+// state machine.
+//
+// A connection cycles through Closed, Opening, Open and Closing, with data
+// events handled internally while open.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles fsm.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+#include "fsm.h"
+#include "fsm_table.h"
+
+const size_t CYCLES = 2000000;
+
+//*****************************************************************************
+// Events, usable by both state machines.
+//*****************************************************************************
+struct Connect    : public etl::message<0> {};
+struct Connected  : public etl::message<1> {};
+struct Data       : public etl::message<2> { Data(int size_) : size(size_) {} int size; };
+struct Disconnect : public etl::message<3> {};
+struct Closed     : public etl::message<4> {};
+
+//*****************************************************************************
+// The etl::fsm version.
+//*****************************************************************************
+namespace virtual_fsm
+{
+  enum
+  {
+    CLOSED,
+    OPENING,
+    OPEN,
+    CLOSING,
+    NUMBER_OF_STATES
+  };
+
+  template <typename TBase>
+  class ConnectionT : public TBase
+  {
+  public:
+
+    ConnectionT(etl::ifsm_state** p_states, size_t size)
+      : TBase(0),
+        bytes(0),
+        opens(0)
+    {
+      this->set_states(p_states, size);
+    }
+
+    long bytes;
+    long opens;
+  };
+
+  typedef ConnectionT<etl::fsm> Connection;
+
+  typedef etl::largest<Connect, Connected, Data, Disconnect, Closed> Largest;
+  typedef ConnectionT<etl::queued_fsm<NUMBER_OF_STATES, 4, Largest::size, Largest::alignment> > QueuedConnection;
+
+  template <typename TConnection>
+  class Closed_ : public etl::fsm_state<TConnection, Closed_<TConnection>, CLOSED, Connect>
+  {
+  public:
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Connect&) { return OPENING; }
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&) { return CLOSED; }
+  };
+
+  template <typename TConnection>
+  class Opening : public etl::fsm_state<TConnection, Opening<TConnection>, OPENING, Connected, Disconnect>
+  {
+  public:
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Connected&) { return OPEN; }
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Disconnect&) { return CLOSING; }
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&) { return OPENING; }
+  };
+
+  template <typename TConnection>
+  class Open : public etl::fsm_state<TConnection, Open<TConnection>, OPEN, Data, Disconnect>
+  {
+  public:
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Data& data) { this->get_fsm_context().bytes += data.size; return OPEN; }
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Disconnect&) { return CLOSING; }
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&) { return OPEN; }
+    etl::fsm_state_id_t on_enter_state() { ++this->get_fsm_context().opens; return OPEN; }
+  };
+
+  template <typename TConnection>
+  class Closing : public etl::fsm_state<TConnection, Closing<TConnection>, CLOSING, Closed>
+  {
+  public:
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Closed&) { return CLOSED; }
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&) { return CLOSING; }
+  };
+
+  //***************************************************************************
+  template <typename TConnection>
+  struct States
+  {
+    States()
+    {
+      list[CLOSED]  = &closed;
+      list[OPENING] = &opening;
+      list[OPEN]    = &open;
+      list[CLOSING] = &closing;
+    }
+
+    Closed_<TConnection> closed;
+    Opening<TConnection> opening;
+    Open<TConnection>    open;
+    Closing<TConnection> closing;
+
+    etl::ifsm_state* list[NUMBER_OF_STATES];
+  };
+}
+
+//*****************************************************************************
+// The etl::fsm_table version.
+//*****************************************************************************
+namespace table_fsm
+{
+  struct Connection
+  {
+    Connection() : bytes(0), opens(0) {}
+
+    long bytes;
+    long opens;
+  };
+
+  struct Closed_ {};
+  struct Opening {};
+  struct Open    { static void on_enter(Connection& connection) { ++connection.opens; } };
+  struct Closing {};
+
+  struct CountBytes
+  {
+    void operator ()(Connection& connection, const Data& data) const { connection.bytes += data.size; }
+  };
+
+  typedef etl::fsm_table_states<etl::fsm_table_state<Closed_>,
+                                etl::fsm_table_state<Opening>,
+                                etl::fsm_table_state<Open>,
+                                etl::fsm_table_state<Closing> > States;
+
+  typedef etl::fsm_table_transitions<etl::fsm_table_transition<Closed_, Connect,    Opening>,
+                                     etl::fsm_table_transition<Opening, Connected,  Open>,
+                                     etl::fsm_table_transition<Opening, Disconnect, Closing>,
+                                     etl::fsm_table_transition<Open,    Data,       void, CountBytes>,
+                                     etl::fsm_table_transition<Open,    Disconnect, Closing>,
+                                     etl::fsm_table_transition<Closing, Closed,     Closed_> > Transitions;
+
+  typedef etl::fsm_table<Connection, States, Transitions> ConnectionFsm;
+}
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  // Each cycle is 4 transitions and 8 data events.
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(CYCLES * 12);
+}
+
+//*****************************************************************************
+void Print(const char* name, double ns, long bytes)
+{
+  std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << ns << " ns/event  (" << bytes << ")\n";
+}
+
+//*****************************************************************************
+template <typename TFsm>
+void Cycle(TFsm& fsm)
+{
+  for (size_t i = 0; i < CYCLES; ++i)
+  {
+    fsm.receive(Connect());
+    fsm.receive(Connected());
+
+    for (int d = 0; d < 8; ++d)
+    {
+      fsm.receive(Data(d));
+    }
+
+    fsm.receive(Disconnect());
+    fsm.receive(Closed());
+  }
+}
+
+//*****************************************************************************
+/// The same events, passed to etl::queued_fsm as a batch for each cycle.
+//*****************************************************************************
+void CycleBatch(virtual_fsm::QueuedConnection& fsm)
+{
+  struct Batch
+  {
+    Batch()
+      : data0(0), data1(1), data2(2), data3(3), data4(4), data5(5), data6(6), data7(7)
+    {
+    }
+
+    Connect    connect;
+    Connected  connected;
+    Data       data0, data1, data2, data3, data4, data5, data6, data7;
+    Disconnect disconnect;
+    Closed     closed;
+  };
+
+  static const Batch batch;
+
+  const etl::imessage* messages[] =
+  {
+    &batch.connect, &batch.connected,
+    &batch.data0, &batch.data1, &batch.data2, &batch.data3, &batch.data4, &batch.data5, &batch.data6, &batch.data7,
+    &batch.disconnect, &batch.closed
+  };
+
+  for (size_t i = 0; i < CYCLES; ++i)
+  {
+    fsm.receive(messages, messages + 12);
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  static virtual_fsm::States<virtual_fsm::Connection> states;
+  static virtual_fsm::Connection virtual_connection(states.list, virtual_fsm::NUMBER_OF_STATES);
+  virtual_connection.start();
+
+  static virtual_fsm::States<virtual_fsm::QueuedConnection> queued_states;
+  static virtual_fsm::QueuedConnection queued_connection(queued_states.list, virtual_fsm::NUMBER_OF_STATES);
+  queued_connection.start();
+
+  static table_fsm::Connection    table_connection;
+  static table_fsm::ConnectionFsm table(table_connection);
+  table.start();
+
+  const double virtual_ns = Time([] { Cycle(virtual_connection); });
+  Print("etl::fsm", virtual_ns, virtual_connection.bytes);
+
+  const double queued_ns = Time([] { CycleBatch(queued_connection); });
+  Print("etl::queued_fsm", queued_ns, queued_connection.bytes);
+
+  const double table_ns = Time([] { Cycle(table); });
+  Print("etl::fsm_table", table_ns, table_connection.bytes);
+
+  return 0;
+}
@@ -0,0 +1,215 @@
+// node_locality.cpp : Times iteration and lookup in pool based containers
+// after heavy churn, before and after compact().
+//
+// Random inserts and erases leave the nodes scattered through the pool, so
+// that iteration is a random walk through memory. compact() moves the nodes
+// back into iteration order.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles node_locality.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "list.h"
+#include "map.h"
+#include "unordered_map.h"
+
+const size_t SIZE    = 200000;
+const size_t CHURN   = 4 * SIZE;
+const size_t LOOKUPS = 1000000;
+
+struct Payload
+{
+  uint32_t key;
+  uint32_t data[7];
+};
+
+typedef etl::list<Payload, SIZE>                    List;
+typedef etl::map<uint32_t, Payload, SIZE>           Map;
+typedef etl::unordered_map<uint32_t, Payload, SIZE> UnorderedMap;
+
+List         list;
+Map          map;
+UnorderedMap unordered_map;
+
+std::vector<uint32_t> lookups;
+
+uint64_t seed = 0x123456789ABCDEF1;
+
+//*****************************************************************************
+uint32_t Random()
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+
+  return uint32_t(seed);
+}
+
+//*****************************************************************************
+Payload MakePayload(uint32_t key)
+{
+  Payload payload = { key, { key } };
+
+  return payload;
+}
+
+//*****************************************************************************
+struct PayloadCompare
+{
+  bool operator ()(const Payload& lhs, const Payload& rhs) const
+  {
+    return lhs.key < rhs.key;
+  }
+};
+
+//*****************************************************************************
+template <typename TFunction>
+void Time(const char* name, size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  uint64_t sum = function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+
+  std::cout << "  " << std::left << std::setw(28) << name << std::right << std::setw(8) << std::fixed << std::setprecision(2) << ns << " ns/op  (" << (sum & 0xFF) << ")\n";
+}
+
+//*****************************************************************************
+uint64_t IterateList()
+{
+  uint64_t sum = 0;
+
+  for (List::const_iterator itr = list.begin(); itr != list.end(); ++itr)
+  {
+    sum += itr->key;
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+uint64_t IterateMap()
+{
+  uint64_t sum = 0;
+
+  for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+  {
+    sum += itr->second.key;
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+uint64_t LookupMap()
+{
+  uint64_t sum = 0;
+
+  for (size_t i = 0; i < lookups.size(); ++i)
+  {
+    Map::const_iterator itr = map.find(lookups[i]);
+    sum += (itr != map.end()) ? itr->second.data[0] : 0;
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+uint64_t IterateUnorderedMap()
+{
+  uint64_t sum = 0;
+
+  for (UnorderedMap::const_iterator itr = unordered_map.begin(); itr != unordered_map.end(); ++itr)
+  {
+    sum += itr->second.key;
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+void Churn()
+{
+  std::vector<uint32_t> keys;
+
+  for (uint32_t i = 0; i < SIZE; ++i)
+  {
+    keys.push_back(i);
+  }
+
+  // Insert in random order, so that bucket order is not pool order.
+  for (size_t i = SIZE - 1; i > 0; --i)
+  {
+    std::swap(keys[i], keys[Random() % (i + 1)]);
+  }
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    list.push_back(MakePayload(Random()));
+    map.insert(std::make_pair(keys[i], MakePayload(keys[i])));
+    unordered_map.insert(std::make_pair(keys[i], MakePayload(keys[i])));
+  }
+
+  for (size_t i = 0; i < CHURN; ++i)
+  {
+    // Replace a random entry with a new one.
+    // The new key hashes to the same bucket, as unordered_map::erase does not
+    // move the begin() marker past a bucket that it empties.
+    size_t   index   = Random() % keys.size();
+    uint32_t key     = keys[index];
+    uint32_t new_key = key + SIZE;
+
+    map.erase(key);
+    unordered_map.erase(key);
+    map.insert(std::make_pair(new_key, MakePayload(new_key)));
+    unordered_map.insert(std::make_pair(new_key, MakePayload(new_key)));
+    keys[index] = new_key;
+  }
+
+  // Sorting relinks the list nodes without moving them.
+  list.sort(PayloadCompare());
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    lookups.push_back(keys[Random() % keys.size()]);
+  }
+}
+
+//*****************************************************************************
+void Run(const char* title)
+{
+  std::cout << title << "\n";
+
+  Time("list iterate", list.size(), IterateList);
+  Time("map iterate", map.size(), IterateMap);
+  Time("map find", lookups.size(), LookupMap);
+  Time("unordered_map iterate", unordered_map.size(), IterateUnorderedMap);
+}
+
+//*****************************************************************************
+int main()
+{
+  Churn();
+
+  Run("After churn");
+
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  list.compact();
+  map.compact();
+  unordered_map.compact();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  std::cout << "compact() " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " ms\n";
+
+  Run("After compact()");
+
+  return 0;
+}
@@ -0,0 +1,210 @@
+// observable_atomic.cpp : Measures notification throughput of etl::observable_atomic
+// against an etl::observable guarded by a mutex, while another thread
+// continually adds and removes an observer.
+//
+// Each notifier thread sends its own readings to eight observers.
+//   g++ -O2 -std=c++11 -pthread -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles observable_atomic.cpp
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "observer.h"
+#include "observable_atomic.h"
+
+const std::chrono::milliseconds DURATION(500);
+
+//*****************************************************************************
+/// Owned by one notifier thread, so the observers need no locking.
+//*****************************************************************************
+struct Reading
+{
+  uint32_t value;
+  uint64_t total;
+};
+
+typedef etl::observer<Reading*> SensorObserver;
+
+//*****************************************************************************
+template <const int K>
+class Statistic final : public SensorObserver
+{
+public:
+
+  void notification(Reading* reading) override
+  {
+    reading->total += (reading->value * K) ^ (reading->total >> 7);
+  }
+};
+
+Statistic<1> s1;
+Statistic<2> s2;
+Statistic<3> s3;
+Statistic<4> s4;
+Statistic<5> s5;
+Statistic<6> s6;
+Statistic<7> s7;
+Statistic<8> s8;
+
+SensorObserver* const observers[] = { &s1, &s2, &s3, &s4, &s5, &s6, &s7, &s8 };
+
+//*****************************************************************************
+/// etl::observable, with every access guarded by a mutex.
+//*****************************************************************************
+class LockedObservable
+{
+public:
+
+  void add_observer(SensorObserver& observer)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    observable.add_observer(observer);
+  }
+
+  void remove_observer(SensorObserver& observer)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    observable.remove_observer(observer);
+  }
+
+  void notify_observers(Reading* reading)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    observable.notify_observers(reading);
+  }
+
+private:
+
+  std::mutex                         mutex;
+  etl::observable<SensorObserver, 9> observable;
+};
+
+typedef etl::observable_atomic<SensorObserver, 9> AtomicObservable;
+
+//*****************************************************************************
+/// Returns the notifications per microsecond, summed over the notifier threads.
+//*****************************************************************************
+template <typename TObservable>
+double Run(size_t notifiers, bool churn, uint64_t& checksum)
+{
+  static TObservable observable;
+
+  for (size_t i = 0; i < 8; ++i)
+  {
+    observable.add_observer(*observers[i]);
+  }
+
+  std::atomic<bool>     stop(false);
+  std::atomic<uint64_t> count(0);
+  std::atomic<uint64_t> sum(0);
+
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0; t < notifiers; ++t)
+  {
+    threads.push_back(std::thread([&, t]
+    {
+      Reading  reading = { uint32_t(t + 1), 0 };
+      uint64_t n       = 0;
+
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        for (int i = 0; i < 64; ++i)
+        {
+          reading.value = (reading.value * 1103515245U) + 12345U;
+          observable.notify_observers(&reading);
+        }
+
+        n += 64;
+      }
+
+      count += n;
+      sum   += reading.total;
+    }));
+  }
+
+  if (churn)
+  {
+    threads.push_back(std::thread([&]
+    {
+      Statistic<9> temporary;
+
+      while (!stop.load(std::memory_order_relaxed))
+      {
+        observable.add_observer(temporary);
+        observable.remove_observer(temporary);
+      }
+    }));
+  }
+
+  std::this_thread::sleep_for(DURATION);
+  stop = true;
+
+  for (size_t t = 0; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  for (size_t i = 0; i < 8; ++i)
+  {
+    observable.remove_observer(*observers[i]);
+  }
+
+  checksum += sum;
+
+  return double(count) / double(std::chrono::duration_cast<std::chrono::microseconds>(DURATION).count());
+}
+
+//*****************************************************************************
+void Print(const char* name, size_t notifiers, bool churn, double rate)
+{
+  std::cout << "  " << std::left << std::setw(20) << name
+            << std::right << std::setw(3) << notifiers << " notifier(s)"
+            << (churn ? ", churn   " : ", no churn")
+            << std::fixed << std::setprecision(2) << std::setw(10) << rate << " notifications/us\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  size_t cores = std::thread::hardware_concurrency();
+
+  if (cores < 2)
+  {
+    cores = 2;
+  }
+
+  uint64_t checksum = 0;
+
+  std::vector<size_t> counts(1, 1);
+
+  if (cores > 2)
+  {
+    counts.push_back(cores - 1);
+  }
+
+  for (size_t c = 0; c < counts.size(); ++c)
+  {
+    const size_t notifiers = counts[c];
+
+    for (int churn = 0; churn < 2; ++churn)
+    {
+      double rate;
+
+      rate = Run<LockedObservable>(notifiers, churn != 0, checksum);
+      Print("mutex + observable", notifiers, churn != 0, rate);
+
+      rate = Run<AtomicObservable>(notifiers, churn != 0, checksum);
+      Print("observable_atomic", notifiers, churn != 0, rate);
+    }
+  }
+
+  std::cout << "  (" << checksum << ")\n";
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+// observer.cpp : Times etl::observable against etl::static_observable, sending
+// each notification singly, and in batches.
+//
+// A sensor sends readings to twelve observers.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles observer.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <stdint.h>
+
+#include "observer.h"
+
+const size_t NOTIFICATIONS = 1000000;
+const size_t BATCH         = 64;
+const size_t REPEATS       = 10;
+
+struct Reading
+{
+  int32_t value;
+};
+
+typedef etl::observer<const Reading&> SensorObserver;
+
+//*****************************************************************************
+/// Each observer keeps a different statistic.
+//*****************************************************************************
+template <const int K>
+class Statistic final : public SensorObserver
+{
+public:
+
+  Statistic()
+    : total(0)
+  {
+  }
+
+  void notification(const Reading& reading) override
+  {
+    total += (reading.value * K) ^ (total >> 7);
+  }
+
+  int64_t total;
+};
+
+Statistic<1>  s1;
+Statistic<2>  s2;
+Statistic<3>  s3;
+Statistic<4>  s4;
+Statistic<5>  s5;
+Statistic<6>  s6;
+Statistic<7>  s7;
+Statistic<8>  s8;
+Statistic<9>  s9;
+Statistic<10> s10;
+Statistic<11> s11;
+Statistic<12> s12;
+
+Reading readings[NOTIFICATIONS];
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < REPEATS; ++r)
+  {
+    function();
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(REPEATS * NOTIFICATIONS);
+}
+
+//*****************************************************************************
+void Print(const char* name, double ns)
+{
+  std::cout << "  " << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << ns << " ns/notification\n";
+}
+
+//*****************************************************************************
+template <typename TObservable>
+void Single(TObservable& observable)
+{
+  for (size_t i = 0; i < NOTIFICATIONS; ++i)
+  {
+    observable.notify_observers(readings[i]);
+  }
+}
+
+//*****************************************************************************
+template <typename TObservable>
+void Batched(TObservable& observable)
+{
+  for (size_t i = 0; i < NOTIFICATIONS; i += BATCH)
+  {
+    observable.notify_observers(readings + i, readings + i + BATCH);
+  }
+}
+
+//*****************************************************************************
+int64_t Checksum()
+{
+  return s1.total + s2.total + s3.total + s4.total + s5.total + s6.total +
+         s7.total + s8.total + s9.total + s10.total + s11.total + s12.total;
+}
+
+//*****************************************************************************
+int main()
+{
+  static_assert((NOTIFICATIONS % BATCH) == 0, "Whole batches only");
+
+  uint32_t seed = 1;
+
+  for (size_t i = 0; i < NOTIFICATIONS; ++i)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    readings[i].value = int32_t(seed >> 20);
+  }
+
+  static etl::observable<SensorObserver, 12> observable;
+
+  SensorObserver* observers[] = { &s1, &s2, &s3, &s4, &s5, &s6, &s7, &s8, &s9, &s10, &s11, &s12 };
+
+  for (size_t i = 0; i < 12; ++i)
+  {
+    observable.add_observer(*observers[i]);
+  }
+
+  static etl::static_observable<Statistic<1>, Statistic<2>, Statistic<3>,  Statistic<4>,  Statistic<5>,  Statistic<6>,
+                                Statistic<7>, Statistic<8>, Statistic<9>, Statistic<10>, Statistic<11>, Statistic<12> >
+    static_observable(s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12);
+
+  Print("observable",                 Time([] { Single(observable); }));
+  Print("observable, batched",        Time([] { Batched(observable); }));
+  Print("static_observable",          Time([] { Single(static_observable); }));
+  Print("static_observable, batched", Time([] { Batched(static_observable); }));
+
+  std::cout << "  (" << Checksum() << ")\n";
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+// parallel_algorithm.cpp : Times the parallel algorithms over 10M elements
+// with pools of 1, 2, 4 and 8 threads, against the sequential algorithms.
+//
+// Speedup is relative to the sequential algorithm. It is limited by the
+// number of cores, and for the transforms by memory bandwidth.
+//   g++ -O2 -std=c++11 -pthread -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles parallel_algorithm.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+#include "parallel_algorithm.h"
+
+const size_t SIZE    = 10000000;
+const size_t REPEATS = 3;
+
+std::vector<float>    input;
+std::vector<float>    output;
+std::vector<uint32_t> source;
+std::vector<uint32_t> data;
+std::vector<uint32_t> scratch;
+
+//*****************************************************************************
+struct Transform
+{
+  float operator()(float f) const
+  {
+    return std::sqrt(f) * 1.5f + 0.25f;
+  }
+};
+
+struct IsSmall
+{
+  bool operator()(uint32_t i) const
+  {
+    return i < 0x80000000U;
+  }
+};
+
+//*****************************************************************************
+template <typename TFill, typename TFunction>
+double Time(TFill fill, TFunction function)
+{
+  double best = 1e30;
+
+  for (size_t r = 0; r < REPEATS; ++r)
+  {
+    fill();
+
+    std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    function();
+
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    best = std::min(best, double(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()) / 1000.0);
+  }
+
+  return best;
+}
+
+//*****************************************************************************
+void Print(const char* name, double sequential, double parallel)
+{
+  std::cout << "    " << std::left << std::setw(24) << name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(10) << parallel << " ms" << std::setw(8) << std::setprecision(2) << (sequential / parallel) << "x\n";
+}
+
+//*****************************************************************************
+struct Sequential
+{
+  double transform;
+  double reduce;
+  double sort;
+  double partition;
+};
+
+void NoFill()
+{
+}
+
+void FillData()
+{
+  data = source;
+}
+
+//*****************************************************************************
+void Run(etl::iworker_pool& pool, const Sequential& sequential)
+{
+  std::cout << "  " << pool.size() << " thread(s)\n";
+
+  Print("parallel_transform", sequential.transform,
+        Time(NoFill, [&]() { etl::parallel_transform(pool, input.begin(), input.end(), output.begin(), Transform()); }));
+
+  volatile double sink = 0;
+  Print("parallel_reduce", sequential.reduce,
+        Time(NoFill, [&]() { sink = etl::parallel_reduce(pool, input.begin(), input.end(), 0.0); }));
+
+  Print("parallel_sort (scratch)", sequential.sort,
+        Time(FillData, [&]() { etl::parallel_sort(pool, data.begin(), data.end(), scratch.begin(), scratch.end()); }));
+
+  Print("parallel_partition", sequential.partition,
+        Time(FillData, [&]() { etl::parallel_partition(pool, data.begin(), data.end(), IsSmall()); }));
+}
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    source.push_back(uint32_t(seed));
+    input.push_back(float(seed >> 40));
+  }
+
+  output.resize(SIZE);
+  scratch.resize(SIZE);
+
+  Sequential sequential;
+
+  volatile double sink = 0;
+  sequential.transform = Time(NoFill,   [&]() { std::transform(input.begin(), input.end(), output.begin(), Transform()); });
+  sequential.reduce    = Time(NoFill,   [&]() { sink = std::accumulate(input.begin(), input.end(), 0.0); });
+  sequential.sort      = Time(FillData, [&]() { etl::sort(data.begin(), data.end()); });
+  sequential.partition = Time(FillData, [&]() { std::partition(data.begin(), data.end(), IsSmall()); });
+
+  std::cout << SIZE << " elements, " << std::thread::hardware_concurrency() << " hardware threads\n";
+  std::cout << "  sequential\n";
+  std::cout << "    transform " << sequential.transform << " ms, accumulate " << sequential.reduce
+            << " ms, etl::sort " << sequential.sort << " ms, partition " << sequential.partition << " ms\n";
+
+  { etl::worker_pool<1> pool; Run(pool, sequential); }
+  { etl::worker_pool<2> pool; Run(pool, sequential); }
+  { etl::worker_pool<4> pool; Run(pool, sequential); }
+  { etl::worker_pool<8> pool; Run(pool, sequential); }
+
+  return 0;
+}
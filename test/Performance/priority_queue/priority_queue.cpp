@@ -0,0 +1,202 @@
+// priority_queue.cpp : Times the d-ary heap options of etl::priority_queue,
+// re-prioritising with etl::indexed_priority_queue, and etl::bucket_priority_queue.
+//
+// Each queue is held at SIZE - 1 entries, and each operation pops the top
+// entry and pushes a new one, as a scheduler would.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles priority_queue.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <functional>
+#include <stdint.h>
+
+#include "priority_queue.h"
+#include "indexed_priority_queue.h"
+#include "bucket_priority_queue.h"
+
+const size_t SIZE       = 4096;
+const size_t OPERATIONS = 10000000;
+const size_t PRIORITIES = 64;
+
+uint32_t seed;
+
+//*****************************************************************************
+uint32_t Random()
+{
+  seed = seed * 1664525U + 1013904223U;
+  return seed >> 8;
+}
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  uint32_t result = function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  // Stop the work being optimised away.
+  if (result == 0xFFFFFFFFU)
+  {
+    std::cout << result;
+  }
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(OPERATIONS);
+}
+
+//*****************************************************************************
+void Print(const char* name, double ns)
+{
+  std::cout << "  " << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << ns << " ns/operation\n";
+}
+
+//*****************************************************************************
+/// Pop the earliest deadline, push a later one.
+//*****************************************************************************
+template <typename TQueue>
+uint32_t Hold(TQueue& queue)
+{
+  seed = 1;
+  uint32_t sum = 0;
+
+  while (queue.size() < (SIZE - 1))
+  {
+    queue.push(Random() % 100000);
+  }
+
+  for (size_t i = 0; i < OPERATIONS; ++i)
+  {
+    const uint32_t now = queue.top();
+    sum += now;
+    queue.pop();
+    queue.push(now + (Random() % 100000));
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+/// Change the deadline of a random entry, by erasing and pushing it, or by
+/// updating it in place.
+//*****************************************************************************
+template <typename TQueue>
+uint32_t Reprioritise(TQueue& queue, bool use_update)
+{
+  seed = 1;
+  uint32_t sum = 0;
+
+  while (!queue.full())
+  {
+    queue.push(Random() % 100000);
+  }
+
+  for (size_t i = 0; i < OPERATIONS; ++i)
+  {
+    const size_t   handle   = Random() % SIZE;
+    const uint32_t deadline = Random() % 100000;
+
+    if (use_update)
+    {
+      queue.update(handle, deadline);
+    }
+    else
+    {
+      queue.erase(handle);
+      queue.push(deadline);
+    }
+
+    sum += queue.top();
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+/// Pop the highest priority, push a random priority.
+//*****************************************************************************
+template <typename TQueue>
+uint32_t Buckets(TQueue& queue)
+{
+  seed = 1;
+  uint32_t sum = 0;
+
+  while (queue.size() < (SIZE - 1))
+  {
+    queue.push(Random() % PRIORITIES, 0);
+  }
+
+  for (size_t i = 0; i < OPERATIONS; ++i)
+  {
+    sum += uint32_t(queue.top_priority());
+    queue.pop();
+    queue.push(Random() % PRIORITIES, i);
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+/// Pop the highest priority, push a random priority, with a heap ordered by
+/// priority and then by sequence number, to keep the same FIFO order.
+//*****************************************************************************
+uint32_t BucketsAsHeap()
+{
+  typedef etl::priority_queue<uint64_t, SIZE, etl::vector<uint64_t, SIZE>, std::greater<uint64_t>, 4> Queue;
+
+  static Queue queue;
+  seed = 1;
+  uint32_t sum = 0;
+  uint64_t sequence = 0;
+
+  while (queue.size() < (SIZE - 1))
+  {
+    queue.push((uint64_t(Random() % PRIORITIES) << 32) | sequence++);
+  }
+
+  for (size_t i = 0; i < OPERATIONS; ++i)
+  {
+    sum += uint32_t(queue.top() >> 32);
+    queue.pop();
+    queue.push((uint64_t(Random() % PRIORITIES) << 32) | sequence++);
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef std::greater<uint32_t> Earliest;
+
+  static etl::priority_queue<uint32_t, SIZE, etl::vector<uint32_t, SIZE>, Earliest, 2> binary;
+  static etl::priority_queue<uint32_t, SIZE, etl::vector<uint32_t, SIZE>, Earliest, 4> quaternary;
+  static etl::priority_queue<uint32_t, SIZE, etl::vector<uint32_t, SIZE>, Earliest, 8> octonary;
+
+  std::cout << "Hold, " << SIZE << " entries\n";
+  Print("priority_queue, 2-ary", Time([] { return Hold(binary); }));
+  Print("priority_queue, 4-ary", Time([] { return Hold(quaternary); }));
+  Print("priority_queue, 8-ary", Time([] { return Hold(octonary); }));
+
+  static etl::indexed_priority_queue<uint32_t, SIZE, Earliest, 2> indexed_binary;
+  static etl::indexed_priority_queue<uint32_t, SIZE, Earliest, 4> indexed_quaternary;
+
+  std::cout << "\nRe-prioritise, " << SIZE << " entries\n";
+  Print("indexed 2-ary, erase + push", Time([] { return Reprioritise(indexed_binary, false); }));
+  indexed_binary.clear();
+  Print("indexed 2-ary, update", Time([] { return Reprioritise(indexed_binary, true); }));
+  Print("indexed 4-ary, erase + push", Time([] { return Reprioritise(indexed_quaternary, false); }));
+  indexed_quaternary.clear();
+  Print("indexed 4-ary, update", Time([] { return Reprioritise(indexed_quaternary, true); }));
+
+  static etl::bucket_priority_queue<size_t, SIZE, PRIORITIES> buckets;
+
+  std::cout << "\nFIFO within " << PRIORITIES << " priorities, " << SIZE << " entries\n";
+  Print("priority_queue, 4-ary, sequenced", Time([] { return BucketsAsHeap(); }));
+  Print("bucket_priority_queue", Time([] { return Buckets(buckets); }));
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+// radix_sort.cpp : Times etl::radix_sort, etl::radix_sort_by_key and
+// etl::msd_radix_sort against etl::sort and std::sort.
+//
+// The scratch buffers are allocated once, outside of the timing, as a caller
+// would keep them between sorts.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles radix_sort.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <string.h>
+
+#include "radix_sort.h"
+#include "algorithm.h"
+
+const size_t SIZE    = 1000000;
+const size_t REPEATS = 10;
+
+std::vector<uint32_t> source;
+std::vector<uint32_t> data;
+std::vector<uint32_t> scratch;
+
+//*****************************************************************************
+template <typename TFill, typename TFunction>
+double Time(TFill fill, TFunction function)
+{
+  double total = 0.0;
+
+  for (size_t r = 0; r < REPEATS; ++r)
+  {
+    fill();
+
+    std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    function();
+
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    total += double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+  }
+
+  return total / double(REPEATS * SIZE);
+}
+
+//*****************************************************************************
+void Print(const char* name, double ns)
+{
+  std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << ns << " ns/element " << std::setw(8) << (1000.0 / ns) << " M/s\n";
+}
+
+//*****************************************************************************
+struct Name
+{
+  char text[16];
+};
+
+struct NameText
+{
+  const char* operator()(const Name& name) const
+  {
+    return name.text;
+  }
+};
+
+struct NameLess
+{
+  bool operator()(const Name& lhs, const Name& rhs) const
+  {
+    return memcmp(lhs.text, rhs.text, sizeof(lhs.text)) < 0;
+  }
+};
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    source.push_back(uint32_t(seed));
+  }
+
+  scratch.resize(SIZE);
+
+  auto fill = [&]() { data = source; };
+
+  std::cout << SIZE << " random uint32_t ids\n";
+  Print("etl::radix_sort", Time(fill, [&]() { etl::radix_sort(data.begin(), data.end(), scratch.begin(), scratch.end()); }));
+  Print("etl::sort", Time(fill, [&]() { etl::sort(data.begin(), data.end()); }));
+  Print("std::sort", Time(fill, [&]() { std::sort(data.begin(), data.end()); }));
+
+  // Ids below 2^20 need only three of the four passes.
+  std::vector<uint32_t> small_source(source);
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    small_source[i] &= 0xFFFFFU;
+  }
+
+  auto fill_small = [&]() { data = small_source; };
+
+  std::cout << SIZE << " uint32_t ids < 2^20\n";
+  Print("etl::radix_sort", Time(fill_small, [&]() { etl::radix_sort(data.begin(), data.end(), scratch.begin(), scratch.end()); }));
+  Print("std::sort", Time(fill_small, [&]() { std::sort(data.begin(), data.end()); }));
+
+  // Key and value.
+  std::vector<uint32_t> values(SIZE);
+  std::vector<uint32_t> value_scratch(SIZE);
+  std::vector<std::pair<uint32_t, uint32_t> > pairs(SIZE);
+
+  auto fill_pairs = [&]()
+  {
+    data = source;
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+      values[i] = uint32_t(i);
+      pairs[i]  = std::make_pair(source[i], uint32_t(i));
+    }
+  };
+
+  std::cout << SIZE << " uint32_t key, uint32_t value\n";
+  Print("etl::radix_sort_by_key", Time(fill_pairs, [&]() { etl::radix_sort_by_key(data.begin(), data.end(), values.begin(), scratch.begin(), scratch.end(), value_scratch.begin()); }));
+  Print("std::sort pairs", Time(fill_pairs, [&]() { std::sort(pairs.begin(), pairs.end()); }));
+
+  // Fixed length strings.
+  std::vector<Name> names(SIZE);
+  std::vector<Name> name_source(SIZE);
+  std::vector<Name> name_scratch(SIZE);
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    for (size_t c = 0; c < sizeof(Name::text); ++c)
+    {
+      name_source[i].text[c] = char('a' + ((source[i] >> (c % 16)) + c) % 26);
+    }
+  }
+
+  auto fill_names = [&]() { names = name_source; };
+
+  std::cout << SIZE << " char[16] keys\n";
+  Print("etl::msd_radix_sort", Time(fill_names, [&]() { etl::msd_radix_sort<16>(names.begin(), names.end(), name_scratch.begin(), name_scratch.end(), NameText()); }));
+  Print("std::sort", Time(fill_names, [&]() { std::sort(names.begin(), names.end(), NameLess()); }));
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+// random.cpp : Times the virtual etl::random generators against the
+// non-virtual engines, one value at a time, in bulk with fill(), and in a
+// range.
+//
+// The virtual generator is called through an etl::random reference, as it
+// is when the generator is chosen at run time.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles random.cpp ../../../src/random.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+#include "random.h"
+
+const size_t SIZE    = 4096;
+const size_t REPEATS = 2000;
+
+std::vector<uint32_t> buffer(SIZE);
+
+volatile uint32_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+}
+
+//*****************************************************************************
+__attribute__((noinline)) double VirtualCall(etl::random& r)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t i = 0; i < REPEATS; ++i)
+    {
+      for (size_t j = 0; j < SIZE; ++j)
+      {
+        buffer[j] = r();
+      }
+    }
+
+    sink = buffer[SIZE / 2];
+  });
+}
+
+//*****************************************************************************
+__attribute__((noinline)) double VirtualRange(etl::random& r)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t i = 0; i < REPEATS; ++i)
+    {
+      for (size_t j = 0; j < SIZE; ++j)
+      {
+        buffer[j] = r.range(1, 1000);
+      }
+    }
+
+    sink = buffer[SIZE / 2];
+  });
+}
+
+//*****************************************************************************
+template <typename TEngine>
+double Call(TEngine& r)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t i = 0; i < REPEATS; ++i)
+    {
+      for (size_t j = 0; j < SIZE; ++j)
+      {
+        buffer[j] = uint32_t(r());
+      }
+    }
+
+    sink = buffer[SIZE / 2];
+  });
+}
+
+//*****************************************************************************
+template <typename TEngine>
+double Fill(TEngine& r)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t i = 0; i < REPEATS; ++i)
+    {
+      r.fill(buffer.begin(), buffer.end());
+    }
+
+    sink = buffer[SIZE / 2];
+  });
+}
+
+//*****************************************************************************
+template <typename TEngine>
+double Range(TEngine& r)
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    for (size_t i = 0; i < REPEATS; ++i)
+    {
+      for (size_t j = 0; j < SIZE; ++j)
+      {
+        buffer[j] = r.range(1, 1000);
+      }
+    }
+
+    sink = buffer[SIZE / 2];
+  });
+}
+
+//*****************************************************************************
+void Print(const char* name, double call_ns, double fill_ns, double range_ns)
+{
+  std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << call_ns << std::setw(8) << fill_ns << std::setw(8) << range_ns << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  etl::random_xorshift     xorshift(1);
+  etl::random_clcg         clcg(1);
+  etl::random_xoshiro256ss xoshiro(1);
+  etl::random_pcg32        pcg(1);
+  etl::random_philox4x32   philox(1);
+
+  std::cout << "ns/value                  call    fill   range\n";
+  Print("random_xorshift (virtual)", VirtualCall(xorshift), 0.0, VirtualRange(xorshift));
+  Print("random_clcg (virtual)", VirtualCall(clcg), 0.0, VirtualRange(clcg));
+  Print("random_xoshiro256ss", Call(xoshiro), Fill(xoshiro), Range(xoshiro));
+  Print("random_pcg32", Call(pcg), Fill(pcg), Range(pcg));
+  Print("random_philox4x32", Call(philox), Fill(philox), Range(philox));
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+// random_streams.cpp : Measures how random number generation scales across
+// threads, when each thread has its own independent stream.
+//
+// xoshiro256** workers are split with jump(). Philox workers each have a
+// stream id. A shared, mutex protected generator is shown for comparison.
+// The maximum number of threads may be given on the command line.
+//   g++ -O2 -std=c++11 -pthread -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles random_streams.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <stdlib.h>
+
+#include "random.h"
+
+const size_t VALUES_PER_THREAD = 1 << 24;
+const size_t BLOCK             = 4096;
+
+std::mutex shared_mutex;
+
+//*****************************************************************************
+template <typename TEngine>
+uint64_t Work(TEngine& engine)
+{
+  std::vector<uint32_t> buffer(BLOCK);
+  uint64_t sum = 0;
+
+  for (size_t i = 0; i < (VALUES_PER_THREAD / BLOCK); ++i)
+  {
+    engine.fill(buffer.begin(), buffer.end());
+    sum += buffer[i % BLOCK];
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+uint64_t SharedWork(etl::random_xoshiro256ss& engine)
+{
+  uint64_t sum = 0;
+
+  for (size_t i = 0; i < VALUES_PER_THREAD / 16; ++i)
+  {
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    sum += engine();
+  }
+
+  return sum;
+}
+
+//*****************************************************************************
+/// Returns the total number of values per second, in millions.
+//*****************************************************************************
+template <typename TFunction>
+double Run(size_t n_threads, size_t values_per_thread, TFunction function)
+{
+  std::vector<std::thread> threads;
+  std::vector<uint64_t>    sums(n_threads);
+
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads.push_back(std::thread([&, t]() { sums[t] = function(t); }));
+  }
+
+  for (size_t t = 0; t < n_threads; ++t)
+  {
+    threads[t].join();
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  const double seconds = std::chrono::duration<double>(end - begin).count();
+
+  return double(n_threads * values_per_thread) / seconds / 1e6;
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  size_t max_threads = (argc > 1) ? size_t(atoi(argv[1])) : size_t(std::thread::hardware_concurrency());
+
+  if (max_threads == 0)
+  {
+    max_threads = 4;
+  }
+
+  std::cout << "Million values per second\n";
+  std::cout << "threads   xoshiro jump   philox stream   shared + mutex\n";
+
+  for (size_t n = 1; n <= max_threads; n *= 2)
+  {
+    std::vector<etl::random_xoshiro256ss> xoshiro(n);
+    std::vector<etl::random_philox4x32>   philox(n);
+
+    xoshiro[0].initialise(2018);
+
+    for (size_t t = 0; t < n; ++t)
+    {
+      if (t != 0)
+      {
+        xoshiro[t] = xoshiro[t - 1];
+        xoshiro[t].jump();
+      }
+
+      philox[t].initialise(2018, t);
+    }
+
+    etl::random_xoshiro256ss shared(2018);
+
+    const double x = Run(n, VALUES_PER_THREAD, [&](size_t t) { return Work(xoshiro[t]); });
+    const double p = Run(n, VALUES_PER_THREAD, [&](size_t t) { return Work(philox[t]); });
+    const double s = Run(n, VALUES_PER_THREAD / 16, [&](size_t) { return SharedWork(shared); });
+
+    std::cout << std::setw(7) << n << std::fixed << std::setprecision(0)
+              << std::setw(15) << x << std::setw(16) << p << std::setw(17) << s << "\n";
+  }
+
+  return 0;
+}
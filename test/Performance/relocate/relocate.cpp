@@ -0,0 +1,130 @@
+// relocate.cpp : Times element shifting in etl::vector and etl::deque.
+//
+// Each type is measured twice: as a trivially copyable POD, which takes the
+// block memmove path, and as a type of the same size with user defined copy
+// operations, which is shifted one element at a time.
+// Insert and erase are done at the front of the vector and in the middle of
+// the deque, so every operation shifts all (or half) of the elements.
+//   g++ -O2 -std=c++14 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles relocate.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string.h>
+
+#include "vector.h"
+#include "deque.h"
+
+const size_t MAX_ELEMENTS = 1024;
+const size_t OPERATIONS   = 200000;
+
+//*****************************************************************************
+template <size_t N>
+struct Pod
+{
+  char data[N];
+};
+
+//*****************************************************************************
+template <size_t N>
+struct NonTrivial
+{
+  NonTrivial()
+  {
+  }
+
+  NonTrivial(const NonTrivial& other)
+  {
+    memcpy(data, other.data, N);
+  }
+
+  NonTrivial& operator =(const NonTrivial& other)
+  {
+    memcpy(data, other.data, N);
+    return *this;
+  }
+
+  char data[N];
+};
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+}
+
+//*****************************************************************************
+template <typename T>
+double TimeVector(size_t count)
+{
+  static etl::vector<T, MAX_ELEMENTS + 1> data;
+
+  data.assign(count, T());
+
+  const size_t operations = OPERATIONS / count + 1;
+
+  return Time(operations, [&]()
+  {
+    for (size_t i = 0; i < operations; ++i)
+    {
+      data.insert(data.begin(), T());
+      data.erase(data.begin());
+    }
+  });
+}
+
+//*****************************************************************************
+template <typename T>
+double TimeDeque(size_t count)
+{
+  static etl::deque<T, MAX_ELEMENTS + 1> data;
+
+  data.assign(count, T());
+
+  const size_t operations = OPERATIONS / count + 1;
+
+  return Time(operations, [&]()
+  {
+    for (size_t i = 0; i < operations; ++i)
+    {
+      data.insert(data.begin() + (count / 2), T());
+      data.erase(data.begin() + (count / 2));
+    }
+  });
+}
+
+//*****************************************************************************
+template <size_t N>
+void Run()
+{
+  std::cout << N << " byte elements\n";
+  std::cout << "  elements  vector memmove  vector per-element  deque memmove  deque per-element  (ns/op)\n";
+
+  for (size_t count = 16; count <= MAX_ELEMENTS; count *= 4)
+  {
+    std::cout << std::fixed << std::setprecision(1)
+              << "  " << std::setw(8)  << count
+              << std::setw(16) << TimeVector<Pod<N> >(count)
+              << std::setw(20) << TimeVector<NonTrivial<N> >(count)
+              << std::setw(15) << TimeDeque<Pod<N> >(count)
+              << std::setw(19) << TimeDeque<NonTrivial<N> >(count)
+              << "\n";
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  Run<8>();
+  Run<64>();
+  Run<512>();
+
+  return 0;
+}
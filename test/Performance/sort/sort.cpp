@@ -0,0 +1,143 @@
+// sort.cpp : Times etl::sort, etl::stable_sort, etl::partial_sort and
+// etl::nth_element against the std equivalents.
+//
+// Each line is the mean time per element over the repeats, followed by the
+// slowest single repeat, as the worst case matters for real time use.
+// std::stable_sort uses a heap allocated buffer when it can get one, and
+// etl::stable_sort does not, so it trades speed for predictable memory.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles sort.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+
+#include "algorithm.h"
+#include "vector.h"
+
+const size_t SIZE    = 100000;
+const size_t REPEATS = 20;
+
+typedef etl::vector<uint32_t, SIZE> Data;
+
+Data                  data;
+std::vector<uint32_t> source;
+
+enum Pattern
+{
+  RANDOM,
+  ASCENDING,
+  DESCENDING,
+  FEW_UNIQUE,
+  ORGAN_PIPE,
+  NEARLY_SORTED
+};
+
+const char* pattern_names[] = { "random", "ascending", "descending", "few unique", "organ pipe", "nearly sorted" };
+
+//*****************************************************************************
+void Fill(Pattern pattern)
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  source.clear();
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    const uint32_t random = uint32_t(seed);
+
+    switch (pattern)
+    {
+      case RANDOM:        source.push_back(random); break;
+      case ASCENDING:     source.push_back(uint32_t(i)); break;
+      case DESCENDING:    source.push_back(uint32_t(SIZE - i)); break;
+      case FEW_UNIQUE:    source.push_back(random % 16); break;
+      case ORGAN_PIPE:    source.push_back(uint32_t((i < (SIZE / 2)) ? i : SIZE - i)); break;
+      case NEARLY_SORTED: source.push_back(((random % 100) == 0) ? random : uint32_t(i)); break;
+    }
+  }
+}
+
+//*****************************************************************************
+struct Result
+{
+  double mean;
+  double worst;
+};
+
+//*****************************************************************************
+template <typename TFunction>
+Result Time(TFunction function)
+{
+  Result result = { 0.0, 0.0 };
+
+  for (size_t r = 0; r < REPEATS; ++r)
+  {
+    data.assign(source.begin(), source.end());
+
+    std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+    function();
+
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    const double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(SIZE);
+
+    result.mean += ns;
+    result.worst = std::max(result.worst, ns);
+  }
+
+  result.mean /= double(REPEATS);
+
+  return result;
+}
+
+//*****************************************************************************
+void Print(const char* name, Result etl_result, Result std_result)
+{
+  std::cout << "  " << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(8) << etl_result.mean << std::setw(8) << etl_result.worst
+            << std::setw(10) << std_result.mean << std::setw(8) << std_result.worst << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  etl::ivector<uint32_t>& idata = data;
+
+  std::cout << SIZE << " uint32_t                   etl mean/worst   std mean/worst  (ns/element)\n";
+
+  for (int p = RANDOM; p <= NEARLY_SORTED; ++p)
+  {
+    Fill(Pattern(p));
+
+    std::cout << pattern_names[p] << "\n";
+
+    Print("sort",
+          Time([&]() { etl::sort(idata.begin(), idata.end()); }),
+          Time([&]() { std::sort(idata.begin(), idata.end()); }));
+
+    Print("stable_sort",
+          Time([&]() { etl::stable_sort(idata.begin(), idata.end()); }),
+          Time([&]() { std::stable_sort(idata.begin(), idata.end()); }));
+
+    Print("heap_sort / std::sort_heap",
+          Time([&]() { etl::heap_sort(idata.begin(), idata.end()); }),
+          Time([&]() { std::make_heap(idata.begin(), idata.end()); std::sort_heap(idata.begin(), idata.end()); }));
+
+    Print("partial_sort 1%",
+          Time([&]() { etl::partial_sort(idata.begin(), idata.begin() + (SIZE / 100), idata.end()); }),
+          Time([&]() { std::partial_sort(idata.begin(), idata.begin() + (SIZE / 100), idata.end()); }));
+
+    Print("nth_element median",
+          Time([&]() { etl::nth_element(idata.begin(), idata.begin() + (SIZE / 2), idata.end()); }),
+          Time([&]() { std::nth_element(idata.begin(), idata.begin() + (SIZE / 2), idata.end()); }));
+  }
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+// string_search.cpp : Times the search functions of etl::string and
+// etl::string_view against std::string, over a 4KB buffer of HTTP style
+// header lines.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles string_search.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include "cstring.h"
+#include "string_view.h"
+
+const size_t SIZE    = 4096;
+const size_t REPEATS = 20000;
+
+typedef etl::string<SIZE> Text;
+
+Text             etl_text;
+std::string      std_text;
+etl::string_view etl_view;
+
+volatile size_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  size_t sum = 0;
+
+  for (size_t i = 0; i < REPEATS; ++i)
+  {
+    sum += function();
+  }
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  sink = sum;
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(REPEATS);
+}
+
+//*****************************************************************************
+template <typename TEtl, typename TView, typename TStd>
+void Print(const char* name, TEtl etl_function, TView view_function, TStd std_function)
+{
+  std::cout << "  " << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(0)
+            << std::setw(12) << Time(etl_function) << std::setw(14) << Time(view_function) << std::setw(14) << Time(std_function) << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  while (std_text.size() < (SIZE - 100))
+  {
+    std_text += "X-Request-Header: some-value; q=0.9, other-value\r\n";
+  }
+
+  std_text += "Content-Type: application/octet-stream\r\n\r\n";
+
+  etl_text.assign(std_text.c_str());
+  etl_view = etl::string_view(etl_text.data(), etl_text.size());
+
+  const char* needle = "application/octet-stream";
+  const char* set    = ";,=\r";
+  const char* token  = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-";
+
+  std::cout << SIZE << " chars                       etl::string  string_view  std::string  (ns/search)\n";
+
+  Print("find(char) whole buffer",
+        [&]() { return etl_text.find('C'); },
+        [&]() { return etl_view.find('C'); },
+        [&]() { return std_text.find('C'); });
+
+  Print("find(\"...octet-stream\")",
+        [&]() { return etl_text.find(needle); },
+        [&]() { return etl_view.find(needle); },
+        [&]() { return std_text.find(needle); });
+
+  Print("find(\"\\r\\n\\r\\n\")",
+        [&]() { return etl_text.find("\r\n\r\n"); },
+        [&]() { return etl_view.find("\r\n\r\n"); },
+        [&]() { return std_text.find("\r\n\r\n"); });
+
+  Print("find_first_of(\";,=\\r\") x all",
+        [&]() { size_t n = 0; for (size_t p = etl_text.find_first_of(set); p != Text::npos; p = etl_text.find_first_of(set, p + 1)) ++n; return n; },
+        [&]() { size_t n = 0; for (size_t p = etl_view.find_first_of(set); p != etl::string_view::npos; p = etl_view.find_first_of(set, p + 1)) ++n; return n; },
+        [&]() { size_t n = 0; for (size_t p = std_text.find_first_of(set); p != std::string::npos; p = std_text.find_first_of(set, p + 1)) ++n; return n; });
+
+  Print("find_first_not_of(token)",
+        [&]() { size_t n = 0; for (size_t p = etl_text.find_first_not_of(token); p != Text::npos; p = etl_text.find_first_not_of(token, p + 1)) ++n; return n; },
+        [&]() { size_t n = 0; for (size_t p = etl_view.find_first_not_of(token); p != etl::string_view::npos; p = etl_view.find_first_not_of(token, p + 1)) ++n; return n; },
+        [&]() { size_t n = 0; for (size_t p = std_text.find_first_not_of(token); p != std::string::npos; p = std_text.find_first_not_of(token, p + 1)) ++n; return n; });
+
+  Print("find_last_of(\":\")",
+        [&]() { return etl_text.find_last_of(":", SIZE / 2); },
+        [&]() { return etl_view.find_last_of(":", SIZE / 2); },
+        [&]() { return std_text.find_last_of(":", SIZE / 2); });
+
+  return 0;
+}
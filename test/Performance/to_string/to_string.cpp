@@ -0,0 +1,262 @@
+// to_string.cpp : Times etl::append_integer, etl::append_float and
+// etl::from_chars against snprintf, strtol and strtod.
+//
+// Each line of output is a log style record of one value, built in an
+// etl::string.
+//   g++ -O2 -std=c++11 -DPROFILE_GCC_GENERIC -I../../../include/etl -I../../../include/etl/profiles to_string.cpp
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cstring.h"
+#include "to_string.h"
+#include "from_chars.h"
+
+const size_t SIZE    = 10000;
+const size_t REPEATS = 20;
+
+std::vector<int32_t> integers;
+std::vector<double>  doubles;
+
+std::vector<etl::string<32> > integer_text;
+std::vector<etl::string<32> > double_text;
+
+volatile size_t sink;
+
+//*****************************************************************************
+template <typename TFunction>
+double Time(size_t operations, TFunction function)
+{
+  std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+
+  function();
+
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / double(operations);
+}
+
+//*****************************************************************************
+double EtlInteger()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    etl::string<64> text;
+    size_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        text.assign("id=");
+        etl::append_integer(text, integers[i]);
+        total += text.size();
+      }
+    }
+
+    sink = total;
+  });
+}
+
+//*****************************************************************************
+double SnprintfInteger()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    etl::string<64> text;
+    size_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        char buffer[32];
+        text.assign("id=");
+        snprintf(buffer, sizeof(buffer), "%d", int(integers[i]));
+        text.append(buffer);
+        total += text.size();
+      }
+    }
+
+    sink = total;
+  });
+}
+
+//*****************************************************************************
+double EtlFloat()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    etl::string<64> text;
+    size_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        text.assign("v=");
+        etl::append_float(text, doubles[i]);
+        total += text.size();
+      }
+    }
+
+    sink = total;
+  });
+}
+
+//*****************************************************************************
+double SnprintfFloat()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    etl::string<64> text;
+    size_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        char buffer[32];
+        text.assign("v=");
+        snprintf(buffer, sizeof(buffer), "%.17g", doubles[i]);
+        text.append(buffer);
+        total += text.size();
+      }
+    }
+
+    sink = total;
+  });
+}
+
+//*****************************************************************************
+double EtlParseInteger()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    int64_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        int32_t value = 0;
+        etl::from_chars(integer_text[i].data(), integer_text[i].data() + integer_text[i].size(), value);
+        total += value;
+      }
+    }
+
+    sink = size_t(total);
+  });
+}
+
+//*****************************************************************************
+double StrtolInteger()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    int64_t total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        total += strtol(integer_text[i].c_str(), 0, 10);
+      }
+    }
+
+    sink = size_t(total);
+  });
+}
+
+//*****************************************************************************
+double EtlParseFloat()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    double total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        double value = 0;
+        etl::from_chars(double_text[i].data(), double_text[i].data() + double_text[i].size(), value);
+        total += value;
+      }
+    }
+
+    sink = size_t(total);
+  });
+}
+
+//*****************************************************************************
+double StrtodFloat()
+{
+  return Time(SIZE * REPEATS, [&]()
+  {
+    double total = 0;
+
+    for (size_t r = 0; r < REPEATS; ++r)
+    {
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        total += strtod(double_text[i].c_str(), 0);
+      }
+    }
+
+    sink = size_t(total);
+  });
+}
+
+//*****************************************************************************
+void Print(const char* name, double etl_ns, double c_ns)
+{
+  std::cout << "  " << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(8) << etl_ns << std::setw(14) << c_ns << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  uint64_t seed = 0x123456789ABCDEF1;
+
+  for (size_t i = 0; i < SIZE; ++i)
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    // A spread of magnitudes, as in real records.
+    integers.push_back(int32_t(seed) >> (seed >> 59));
+
+    // Sensor style readings with a few decimal places, and arbitrary doubles.
+    if ((i % 2) == 0)
+    {
+      doubles.push_back(double(int32_t(seed >> 20) % 100000) / 100.0);
+    }
+    else
+    {
+      doubles.push_back(double(int64_t(seed)) * 1e-12);
+    }
+
+    etl::string<32> text;
+    etl::to_string(integers[i], text);
+    integer_text.push_back(text);
+
+    etl::to_string(doubles[i], text);
+    double_text.push_back(text);
+  }
+
+  std::cout << SIZE << " values                    etl (ns)   C library (ns)\n";
+  Print("append_integer / snprintf %d", EtlInteger(), SnprintfInteger());
+  Print("append_float / snprintf %.17g", EtlFloat(), SnprintfFloat());
+  Print("from_chars int / strtol", EtlParseInteger(), StrtolInteger());
+  Print("from_chars double / strtod", EtlParseFloat(), StrtodFloat());
+
+  return 0;
+}
@@ -30,6 +30,7 @@ SOFTWARE.
 #define ETL_TEST_DATA_INCLUDED
 
 #include <ostream>
+#include <utility>
 
 #include "instance_count.h"
 
@@ -152,4 +153,67 @@ std::ostream& operator << (std::ostream& s, const TestDataNDC<T>& rhs)
   return s;
 }
 
+//*****************************************************************************
+// Movable, non-copyable.
+//*****************************************************************************
+template <typename T>
+class TestDataM : public etl::instance_count<TestDataM<T>>
+{
+public:
+
+  explicit TestDataM(const T& value_)
+    : value(value_),
+      valid(true)
+  {
+  }
+
+  TestDataM(TestDataM&& other)
+    : value(std::move(other.value)),
+      valid(other.valid)
+  {
+    other.valid = false;
+  }
+
+  TestDataM& operator =(TestDataM&& other)
+  {
+    value       = std::move(other.value);
+    valid       = other.valid;
+    other.valid = false;
+
+    return *this;
+  }
+
+  bool operator < (const TestDataM& other) const
+  {
+    return value < other.value;
+  }
+
+  T    value;
+  bool valid;
+
+private:
+
+  TestDataM(const TestDataM&) = delete;
+  TestDataM& operator =(const TestDataM&) = delete;
+};
+
+template <typename T>
+bool operator == (const TestDataM<T>& lhs, const TestDataM<T>& rhs)
+{
+  return lhs.value == rhs.value;
+}
+
+template <typename T>
+bool operator != (const TestDataM<T>& lhs, const TestDataM<T>& rhs)
+{
+  return lhs.value != rhs.value;
+}
+
+template <typename T>
+std::ostream& operator << (std::ostream& s, const TestDataM<T>& rhs)
+{
+  s << rhs.value;
+  return s;
+}
+
 #endif
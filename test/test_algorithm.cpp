@@ -30,6 +30,8 @@ SOFTWARE.
 
 #include "algorithm.h"
 #include "container.h"
+#include "vector.h"
+#include "deque.h"
 
 #include <vector>
 #include <list>
@@ -75,6 +77,51 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  /// Test patterns for the sorts.
+  //***************************************************************************
+  enum SortPattern
+  {
+    SORT_RANDOM,
+    SORT_ASCENDING,
+    SORT_DESCENDING,
+    SORT_EQUAL,
+    SORT_FEW_UNIQUE,
+    SORT_ORGAN_PIPE,
+    SORT_SAWTOOTH,
+    SORT_ASCENDING_WITH_NOISE,
+    SORT_PATTERN_COUNT
+  };
+
+  std::vector<int> make_sort_data(SortPattern pattern, size_t size)
+  {
+    std::vector<int> result(size);
+    uint32_t seed = uint32_t(size) * 2654435761U + uint32_t(pattern);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      const int random = int(seed >> 8);
+
+      switch (pattern)
+      {
+        case SORT_RANDOM:               result[i] = random; break;
+        case SORT_ASCENDING:            result[i] = int(i); break;
+        case SORT_DESCENDING:           result[i] = int(size - i); break;
+        case SORT_EQUAL:                result[i] = 42; break;
+        case SORT_FEW_UNIQUE:           result[i] = random % 4; break;
+        case SORT_ORGAN_PIPE:           result[i] = int((i < (size / 2)) ? i : size - i); break;
+        case SORT_SAWTOOTH:             result[i] = int(i % 17); break;
+        case SORT_ASCENDING_WITH_NOISE: result[i] = ((random % 64) == 0) ? random : int(i); break;
+        default:                        break;
+      }
+    }
+
+    return result;
+  }
+
+  const size_t sort_sizes[] = { 0, 1, 2, 3, 5, 23, 24, 25, 100, 129, 1000, 5000 };
+
   SUITE(test_algorithm)
   {
     //=========================================================================
@@ -867,5 +914,223 @@ namespace
       is_same = std::equal(std::begin(output_false), std::end(output_false), std::begin(compare_false));
       CHECK(is_same);
     }
+
+    //=========================================================================
+    TEST(move_overlapping_trivially_copyable)
+    {
+      int data1[]    = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+      int data2[]    = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+      int compare1[] = { 3, 4, 5, 6, 7, 8, 9, 10, 9, 10 };
+      int compare2[] = { 1, 2, 1, 2, 3, 4, 5, 6, 7, 8 };
+
+      int* result = etl::move(data1 + 2, data1 + 10, data1);
+      CHECK(result == data1 + 8);
+      CHECK(std::equal(std::begin(data1), std::end(data1), std::begin(compare1)));
+
+      result = etl::move_backward(data2, data2 + 8, data2 + 10);
+      CHECK(result == data2 + 2);
+      CHECK(std::equal(std::begin(data2), std::end(data2), std::begin(compare2)));
+    }
+
+    //=========================================================================
+    TEST(sort)
+    {
+      for (size_t s = 0; s < (sizeof(sort_sizes) / sizeof(sort_sizes[0])); ++s)
+      {
+        for (int p = 0; p < SORT_PATTERN_COUNT; ++p)
+        {
+          std::vector<int> data1 = make_sort_data(SortPattern(p), sort_sizes[s]);
+          std::vector<int> data2 = data1;
+
+          std::sort(data1.begin(), data1.end());
+          etl::sort(data2.begin(), data2.end());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(sort_compare)
+    {
+      std::vector<int> data1 = make_sort_data(SORT_RANDOM, 1000);
+      std::vector<int> data2 = data1;
+
+      std::sort(data1.begin(), data1.end(), std::greater<int>());
+      etl::sort(data2.begin(), data2.end(), std::greater<int>());
+
+      CHECK(data1 == data2);
+    }
+
+    //=========================================================================
+    TEST(sort_etl_containers)
+    {
+      std::vector<int> compare = make_sort_data(SORT_RANDOM, 500);
+
+      etl::vector<int, 500> data1(compare.begin(), compare.end());
+      etl::ivector<int>& idata1 = data1;
+
+      // Wrap the deque contents around the end of its buffer.
+      etl::deque<int, 500> data2(compare.begin(), compare.end());
+      data2.erase(data2.begin(), data2.begin() + 100);
+      data2.insert(data2.end(), compare.begin(), compare.begin() + 100);
+
+      std::vector<int> compare2(data2.begin(), data2.end());
+
+      std::sort(compare.begin(), compare.end());
+      std::sort(compare2.begin(), compare2.end());
+      etl::sort(idata1.begin(), idata1.end());
+      etl::sort(data2.begin(), data2.end());
+
+      CHECK(std::equal(compare.begin(), compare.end(), data1.begin()));
+      CHECK(std::equal(compare2.begin(), compare2.end(), data2.begin()));
+    }
+
+    //=========================================================================
+    TEST(sort_quicksort_killer)
+    {
+      // Median of three 'killer' sequence.
+      const size_t size = 4096;
+      std::vector<int> data1(size);
+
+      for (size_t i = 0; i < (size / 2); ++i)
+      {
+        data1[2 * i]     = int(i % 2 == 0 ? i + 1 : (size / 2) + i);
+        data1[2 * i + 1] = int(2 * i + 2);
+      }
+
+      std::vector<int> data2 = data1;
+
+      std::sort(data1.begin(), data1.end());
+      etl::sort(data2.begin(), data2.end());
+
+      CHECK(data1 == data2);
+    }
+
+    //=========================================================================
+    TEST(heap_sort)
+    {
+      for (size_t s = 0; s < (sizeof(sort_sizes) / sizeof(sort_sizes[0])); ++s)
+      {
+        for (int p = 0; p < SORT_PATTERN_COUNT; ++p)
+        {
+          std::vector<int> data1 = make_sort_data(SortPattern(p), sort_sizes[s]);
+          std::vector<int> data2 = data1;
+
+          std::sort(data1.begin(), data1.end());
+          etl::heap_sort(data2.begin(), data2.end());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(stable_sort)
+    {
+      for (size_t s = 0; s < (sizeof(sort_sizes) / sizeof(sort_sizes[0])); ++s)
+      {
+        for (int p = 0; p < SORT_PATTERN_COUNT; ++p)
+        {
+          std::vector<int> keys = make_sort_data(SortPattern(p), sort_sizes[s]);
+
+          std::vector<StructData> data1;
+          std::vector<StructData> data2;
+
+          // Few keys, so that the order of equal elements is tested.
+          for (size_t i = 0; i < keys.size(); ++i)
+          {
+            StructData d = { keys[i] % 8, int(i) };
+            data1.push_back(d);
+          }
+
+          data2 = data1;
+
+          std::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+          etl::stable_sort(data2.begin(), data2.end(), StructDataPredicate());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(stable_sort_default_compare)
+    {
+      std::vector<int> data1 = make_sort_data(SORT_RANDOM, 1000);
+      std::vector<int> data2 = data1;
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end());
+
+      CHECK(data1 == data2);
+    }
+
+    //=========================================================================
+    TEST(partial_sort)
+    {
+      const size_t middles[] = { 0, 1, 10, 500, 999, 1000 };
+
+      for (size_t m = 0; m < (sizeof(middles) / sizeof(middles[0])); ++m)
+      {
+        for (int p = 0; p < SORT_PATTERN_COUNT; ++p)
+        {
+          std::vector<int> data1 = make_sort_data(SortPattern(p), 1000);
+          std::vector<int> data2 = data1;
+
+          std::partial_sort(data1.begin(), data1.begin() + middles[m], data1.end());
+          etl::partial_sort(data2.begin(), data2.begin() + middles[m], data2.end());
+
+          CHECK(std::equal(data1.begin(), data1.begin() + middles[m], data2.begin()));
+
+          // The rest are the same elements.
+          std::sort(data1.begin() + middles[m], data1.end());
+          std::sort(data2.begin() + middles[m], data2.end());
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(nth_element)
+    {
+      for (int p = 0; p < SORT_PATTERN_COUNT; ++p)
+      {
+        std::vector<int> sorted = make_sort_data(SortPattern(p), 257);
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t n = 0; n < sorted.size(); ++n)
+        {
+          std::vector<int> data = make_sort_data(SortPattern(p), 257);
+          std::vector<int>::iterator nth = data.begin() + n;
+
+          etl::nth_element(data.begin(), nth, data.end());
+
+          CHECK_EQUAL(sorted[n], *nth);
+
+          for (std::vector<int>::iterator itr = data.begin(); itr != nth; ++itr)
+          {
+            CHECK(!(*nth < *itr));
+          }
+
+          for (std::vector<int>::iterator itr = nth; itr != data.end(); ++itr)
+          {
+            CHECK(!(*itr < *nth));
+          }
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(nth_element_compare)
+    {
+      std::vector<int> data1 = make_sort_data(SORT_RANDOM, 1000);
+      std::vector<int> data2 = data1;
+
+      std::nth_element(data1.begin(), data1.begin() + 100, data1.end(), std::greater<int>());
+      etl::nth_element(data2.begin(), data2.begin() + 100, data2.end(), std::greater<int>());
+
+      CHECK_EQUAL(data1[100], data2[100]);
+    }
   };
 }
@@ -62,6 +62,20 @@ size_t test_parity(T value)
   return count & 1;
 }
 
+// Count trailing zeros the easy way.
+template <typename T>
+size_t test_trailing_zeros(T value)
+{
+  size_t count = 0;
+
+  while ((count < size_t(etl::integral_limits<T>::bits)) && ((value & (T(1) << count)) == 0))
+  {
+    ++count;
+  }
+
+  return count;
+}
+
 // Power of 2.
 uint64_t test_power_of_2(int power)
 {
@@ -797,6 +811,72 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_8)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint8_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint8_t(i)), etl::count_trailing_zeros(uint8_t(i)));
+        CHECK_EQUAL(test_trailing_zeros(uint8_t(i)), etl::count_trailing_zeros(int8_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_16)
+    {
+      for (size_t i = 0; i <= std::numeric_limits<uint16_t>::max(); ++i)
+      {
+        CHECK_EQUAL(test_trailing_zeros(uint16_t(i)), etl::count_trailing_zeros(uint16_t(i)));
+        CHECK_EQUAL(test_trailing_zeros(uint16_t(i)), etl::count_trailing_zeros(int16_t(i)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_32)
+    {
+      CHECK_EQUAL(32U, etl::count_trailing_zeros(uint32_t(0)));
+
+      for (size_t i = 0; i < 32; ++i)
+      {
+        uint32_t value = uint32_t(0xA5A5A5A5) << i;
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(int32_t(value)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_count_trailing_zeros_64)
+    {
+      CHECK_EQUAL(64U, etl::count_trailing_zeros(uint64_t(0)));
+
+      for (size_t i = 0; i < 64; ++i)
+      {
+        uint64_t value = uint64_t(0xA5A5A5A5A5A5A5A5) << i;
+
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(value));
+        CHECK_EQUAL(test_trailing_zeros(value), etl::count_trailing_zeros(int64_t(value)));
+      }
+    }
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    TEST(test_binary_constexpr)
+    {
+      constexpr uint32_t reversed_bits  = etl::reverse_bits(uint32_t(0x12345678));
+      constexpr uint32_t reversed_bytes = etl::reverse_bytes(uint32_t(0x12345678));
+      constexpr uint_least8_t count     = etl::count_bits(uint64_t(0xF0F0F0F0F0F0F0F0));
+      constexpr uint_least8_t parity    = etl::parity(uint16_t(0x0007));
+      constexpr uint_least8_t zeros     = etl::count_trailing_zeros(uint32_t(0x00010000));
+
+      CHECK_EQUAL(0x1E6A2C48U, reversed_bits);
+      CHECK_EQUAL(0x78563412U, reversed_bytes);
+      CHECK_EQUAL(32U, count);
+      CHECK_EQUAL(1U, parity);
+      CHECK_EQUAL(16U, zeros);
+    }
+#endif
+
     //*************************************************************************
     TEST(test_fold_bits)
     {
@@ -571,6 +571,73 @@ namespace
       CHECK(data2 == shift11);
     }
 
+    //*************************************************************************
+    TEST(test_big_bitset_shift_left)
+    {
+      std::bitset<1000> compare;
+      etl::bitset<1000> data;
+
+      for (size_t i = 0; i < data.size(); i += 3)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      const size_t shifts[] = { 0, 1, 7, 8, 9, 63, 64, 65, 500, 999, 1000, 2000 };
+
+      for (size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); ++s)
+      {
+        std::bitset<1000>  compare_shifted = compare << shifts[s];
+        etl::bitset<1000>  data_shifted    = data << shifts[s];
+
+        CHECK_EQUAL(compare_shifted.count(), data_shifted.count());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(compare_shifted.test(i), data_shifted.test(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_big_bitset_shift_right)
+    {
+      std::bitset<1000> compare;
+      etl::bitset<1000> data;
+
+      for (size_t i = 0; i < data.size(); i += 3)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      const size_t shifts[] = { 0, 1, 7, 8, 9, 63, 64, 65, 500, 999, 1000, 2000 };
+
+      for (size_t s = 0; s < sizeof(shifts) / sizeof(shifts[0]); ++s)
+      {
+        std::bitset<1000>  compare_shifted = compare >> shifts[s];
+        etl::bitset<1000>  data_shifted    = data >> shifts[s];
+
+        CHECK_EQUAL(compare_shifted.count(), data_shifted.count());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(compare_shifted.test(i), data_shifted.test(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_small_bitset_shift_left_top_mask)
+    {
+      etl::bitset<5> data("11111");
+
+      data <<= 2;
+
+      CHECK_EQUAL(3U, data.count());
+      CHECK(data == etl::bitset<5>("11100"));
+    }
+
     //*************************************************************************
     TEST(test_and_operator)
     {
@@ -775,6 +842,102 @@ namespace
     }
 
 
+    //*************************************************************************
+    TEST(test_find_next_big_bitset)
+    {
+      std::bitset<1000> compare;
+      etl::bitset<1000> data;
+
+      for (size_t i = 0; i < data.size(); i += 37)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      // Iterate the set bits.
+      size_t position = data.find_first(true);
+
+      for (size_t i = 0; i < compare.size(); ++i)
+      {
+        if (compare.test(i))
+        {
+          CHECK_EQUAL(i, position);
+          position = data.find_next(true, position + 1);
+        }
+      }
+
+      CHECK_EQUAL(etl::ibitset::npos, position);
+
+      // Iterate the clear bits.
+      data.flip();
+      position = data.find_first(false);
+
+      for (size_t i = 0; i < compare.size(); ++i)
+      {
+        if (compare.test(i))
+        {
+          CHECK_EQUAL(i, position);
+          position = data.find_next(false, position + 1);
+        }
+      }
+
+      CHECK_EQUAL(etl::ibitset::npos, position);
+
+      // The unused top bits are never found.
+      data.set();
+      CHECK_EQUAL(etl::ibitset::npos, data.find_first(false));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next(true, 1000));
+    }
+
+    //*************************************************************************
+    TEST(test_rank)
+    {
+      std::bitset<200> compare;
+      etl::bitset<200> data;
+
+      for (size_t i = 0; i < data.size(); i += 3)
+      {
+        compare.set(i);
+        data.set(i);
+      }
+
+      size_t expected = 0;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(expected, data.rank(i));
+
+        if (compare.test(i))
+        {
+          ++expected;
+        }
+      }
+
+      CHECK_EQUAL(compare.count(), data.rank(data.size()));
+      CHECK_EQUAL(compare.count(), data.rank(etl::ibitset::npos));
+    }
+
+    //*************************************************************************
+    TEST(test_select)
+    {
+      etl::bitset<200> data;
+
+      for (size_t i = 0; i < data.size(); i += 3)
+      {
+        data.set(i);
+      }
+
+      for (size_t n = 0; n < data.count(); ++n)
+      {
+        size_t position = data.select(n);
+
+        CHECK_EQUAL(n * 3, position);
+        CHECK_EQUAL(n, data.rank(position));
+      }
+
+      CHECK_EQUAL(etl::ibitset::npos, data.select(data.count()));
+    }
+
     //*************************************************************************
     TEST(test_swap)
     {
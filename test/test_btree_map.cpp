@@ -0,0 +1,552 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+
+#include "btree_map.h"
+
+namespace
+{
+  typedef etl::btree_map<int, int, 2000>  Data;
+  typedef etl::ibtree_map<int, int, std::less<int> > IData;
+  typedef std::map<int, int>              Compare;
+
+  //***************************************************************************
+  // A key large enough to give the minimum node sizes, so that small trees
+  // have many levels.
+  struct Big
+  {
+    Big()
+      : value(0)
+    {
+      ++instances;
+    }
+
+    Big(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Big(const Big& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    ~Big()
+    {
+      --instances;
+    }
+
+    Big& operator =(const Big& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    bool operator <(const Big& other) const
+    {
+      return value < other.value;
+    }
+
+    int  value;
+    char padding[200];
+
+    static int instances;
+  };
+
+  int Big::instances = 0;
+
+  typedef etl::btree_map<Big, int, 500> BigData;
+
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state = (state * 1103515245U) + 12345U;
+    return state >> 8;
+  }
+
+  //***************************************************************************
+  template <typename TData>
+  bool is_equal(const TData& data, const Compare& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    typename TData::const_iterator itr = data.begin();
+
+    for (Compare::const_iterator i = compare.begin(); i != compare.end(); ++i, ++itr)
+    {
+      if ((int(itr->first) != i->first) || (itr->second != i->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  bool is_equal(const BigData& data, const Compare& compare)
+  {
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    BigData::const_iterator itr = data.begin();
+
+    for (Compare::const_iterator i = compare.begin(); i != compare.end(); ++i, ++itr)
+    {
+      if ((itr->first.value != i->first) || (itr->second != i->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(2000U, data.max_size());
+      CHECK_EQUAL(2000U, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_node_sizes)
+    {
+      CHECK(Data::LEAF_SLOTS >= 4);
+      CHECK(Data::INNER_SLOTS >= 4);
+      CHECK_EQUAL(4U, size_t(BigData::LEAF_SLOTS));
+      CHECK_EQUAL(4U, size_t(BigData::INNER_SLOTS));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_ordered)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        data.insert(std::make_pair(i, i * 10));
+        compare.insert(std::make_pair(i, i * 10));
+      }
+
+      CHECK(data.full());
+      CHECK(data.height() > 1);
+      CHECK(is_equal(data, compare));
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.find(i)->second);
+      }
+
+      CHECK(data.find(-1) == data.end());
+      CHECK(data.find(2000) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_random)
+    {
+      Data    data;
+      Compare compare;
+
+      uint32_t seed = 1;
+
+      while (compare.size() < 2000)
+      {
+        int key = int(next_random(seed) % 100000);
+
+        std::pair<Data::iterator, bool>    result   = data.insert(std::make_pair(key, key + 1));
+        std::pair<Compare::iterator, bool> expected = compare.insert(std::make_pair(key, key + 1));
+
+        CHECK_EQUAL(expected.second, result.second);
+        CHECK_EQUAL(expected.first->first, result.first->first);
+      }
+
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        data[i] = i;
+      }
+
+      // Duplicate keys do not need space.
+      CHECK(!data.insert(std::make_pair(0, 0)).second);
+
+      CHECK_THROW(data.insert(std::make_pair(2000, 0)), etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      Data data;
+
+      data[3] = 30;
+      data[1] = 10;
+      data[3] = 33;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(33, data.at(3));
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(0, data[2]);
+      CHECK_EQUAL(3U, data.size());
+
+      const Data& cdata = data;
+      CHECK_EQUAL(33, cdata.at(3));
+      CHECK_THROW(data.at(4), etl::btree_out_of_bounds);
+      CHECK_THROW(cdata.at(4), etl::btree_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i * 3]    = i;
+        compare[i * 3] = i;
+      }
+
+      for (int key = -2; key < 3005; ++key)
+      {
+        Data::iterator    lower = data.lower_bound(key);
+        Compare::iterator clower = compare.lower_bound(key);
+
+        if (clower == compare.end())
+        {
+          CHECK(lower == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(clower->first, lower->first);
+        }
+
+        Data::const_iterator upper  = static_cast<const Data&>(data).upper_bound(key);
+        Compare::iterator    cupper = compare.upper_bound(key);
+
+        if (cupper == compare.end())
+        {
+          CHECK(upper == data.cend());
+        }
+        else
+        {
+          CHECK_EQUAL(cupper->first, upper->first);
+        }
+
+        std::pair<Data::iterator, Data::iterator> range = data.equal_range(key);
+        CHECK_EQUAL(compare.count(key), size_t(std::distance(range.first, range.second)));
+        CHECK_EQUAL(compare.count(key), data.count(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_both_ways)
+    {
+      Data    data;
+      Compare compare;
+
+      uint32_t seed = 2;
+
+      for (int i = 0; i < 1500; ++i)
+      {
+        int key = int(next_random(seed) % 10000);
+        data[key]    = i;
+        compare[key] = i;
+      }
+
+      CHECK(std::equal(compare.rbegin(), compare.rend(), data.rbegin()));
+
+      Data::iterator itr = data.end();
+
+      for (Compare::reverse_iterator i = compare.rbegin(); i != compare.rend(); ++i)
+      {
+        --itr;
+        CHECK_EQUAL(i->first, itr->first);
+      }
+
+      CHECK(itr == data.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key_random)
+    {
+      Data    data;
+      Compare compare;
+
+      uint32_t seed = 3;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      for (int i = 0; i < 3000; ++i)
+      {
+        int key = int(next_random(seed) % 2000);
+
+        CHECK_EQUAL(compare.erase(key), data.erase(key));
+      }
+
+      CHECK(is_equal(data, compare));
+
+      // Erase the rest.
+      for (int i = 0; i < 2000; ++i)
+      {
+        data.erase(i);
+      }
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.height());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      // Erase every third value, following the returned iterators.
+      Data::iterator    itr  = data.begin();
+      Compare::iterator citr = compare.begin();
+
+      int n = 0;
+
+      while (citr != compare.end())
+      {
+        if ((n++ % 3) == 0)
+        {
+          itr  = data.erase(itr);
+          compare.erase(citr++);
+        }
+        else
+        {
+          ++itr;
+          ++citr;
+        }
+
+        if (citr == compare.end())
+        {
+          CHECK(itr == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(citr->first, itr->first);
+        }
+      }
+
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i]    = i;
+        compare[i] = i;
+      }
+
+      Data::iterator itr = data.erase(data.find(100), data.find(700));
+      compare.erase(compare.find(100), compare.find(700));
+
+      CHECK_EQUAL(700, itr->first);
+      CHECK(is_equal(data, compare));
+
+      itr = data.erase(data.find(800), data.end());
+      compare.erase(compare.find(800), compare.end());
+
+      CHECK(itr == data.end());
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_deep_tree_random)
+    {
+      BigData data;
+      Compare compare;
+
+      uint32_t seed = 4;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int key = int(next_random(seed) % 700);
+
+        if ((next_random(seed) % 3) == 0)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(Big(key)));
+        }
+        else if (compare.size() < 500)
+        {
+          compare.insert(std::make_pair(key, i));
+          data.insert(std::make_pair(Big(key), i));
+        }
+      }
+
+      CHECK(data.height() > 2);
+      CHECK(is_equal(data, compare));
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0, Big::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_deep_tree_fill_and_empty)
+    {
+      BigData data;
+
+      // Fill to capacity in descending order, then empty from the middle outwards.
+      for (int i = 499; i >= 0; --i)
+      {
+        data[Big(i)] = i;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 250; ++i)
+      {
+        CHECK_EQUAL(1U, data.erase(Big(250 + i)));
+        CHECK_EQUAL(1U, data.erase(Big(249 - i)));
+      }
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0, Big::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      etl::btree_map<std::string, std::string, 300> data;
+      std::map<std::string, std::string>            compare;
+
+      uint32_t seed = 5;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        std::string key(1 + (next_random(seed) % 20), char('a' + (next_random(seed) % 26)));
+
+        if ((i % 4) == 0)
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+        else if (compare.size() < 300)
+        {
+          compare[key] = key + key;
+          data[key]    = key + key;
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_assign_compare)
+    {
+      Data data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data[i] = i;
+      }
+
+      Data other(data);
+
+      CHECK(data == other);
+
+      other[1] = 2;
+
+      CHECK(data != other);
+      CHECK(data < other);
+
+      IData& idata = other;
+      idata = data;
+
+      CHECK(data == other);
+
+      std::vector<std::pair<int, int> > values(data.begin(), data.end());
+      Data from_range(values.begin(), values.end());
+
+      CHECK(data == from_range);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    TEST(test_initializer_list)
+    {
+      Data data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()->first);
+      CHECK_EQUAL(30, data.at(3));
+    }
+#endif
+  };
+}
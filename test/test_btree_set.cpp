@@ -0,0 +1,215 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <set>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "btree_set.h"
+
+namespace
+{
+  typedef etl::btree_set<int, 1000, std::greater<int> >  Data;
+  typedef etl::ibtree_set<int, std::greater<int> >       IData;
+  typedef std::set<int, std::greater<int> >              Compare;
+
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state = (state * 1103515245U) + 12345U;
+    return state >> 8;
+  }
+
+  //***************************************************************************
+  bool is_equal(const Data& data, const Compare& compare)
+  {
+    return (data.size() == compare.size()) && std::equal(compare.begin(), compare.end(), data.begin());
+  }
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(1000U, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_random)
+    {
+      Data    data;
+      Compare compare;
+
+      uint32_t seed = 1;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        int value = int(next_random(seed) % 1500);
+
+        if ((next_random(seed) % 3) == 0)
+        {
+          CHECK_EQUAL(compare.erase(value), data.erase(value));
+        }
+        else if (compare.size() < 1000)
+        {
+          CHECK_EQUAL(compare.insert(value).second, data.insert(value).second);
+        }
+      }
+
+      CHECK(is_equal(data, compare));
+      CHECK(std::equal(compare.rbegin(), compare.rend(), data.rbegin()));
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert(i * 2);
+        compare.insert(i * 2);
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(1), etl::btree_full);
+
+      for (int value = -1; value < 2001; ++value)
+      {
+        CHECK_EQUAL(compare.count(value), data.count(value));
+
+        Compare::iterator clower = compare.lower_bound(value);
+        Data::iterator    lower  = data.lower_bound(value);
+
+        if (clower == compare.end())
+        {
+          CHECK(lower == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(*clower, *lower);
+        }
+
+        Compare::iterator cupper = compare.upper_bound(value);
+        Data::iterator    upper  = data.upper_bound(value);
+
+        if (cupper == compare.end())
+        {
+          CHECK(upper == data.end());
+        }
+        else
+        {
+          CHECK_EQUAL(*cupper, *upper);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data    data;
+      Compare compare;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.insert(i);
+        compare.insert(i);
+      }
+
+      Data::iterator itr = data.erase(data.find(900), data.find(100));
+      compare.erase(compare.find(900), compare.find(100));
+
+      CHECK_EQUAL(100, *itr);
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_string_values)
+    {
+      etl::btree_set<std::string, 200> data;
+      std::set<std::string>            compare;
+
+      uint32_t seed = 2;
+
+      for (int i = 0; i < 600; ++i)
+      {
+        std::string value(1 + (next_random(seed) % 30), char('a' + (next_random(seed) % 26)));
+
+        if ((i % 3) == 0)
+        {
+          CHECK_EQUAL(compare.erase(value), data.erase(value));
+        }
+        else if (compare.size() < 200)
+        {
+          compare.insert(value);
+          data.insert(value);
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_assign_compare)
+    {
+      std::vector<int> values;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        values.push_back((i * 7) % 300);
+      }
+
+      Data data(values.begin(), values.end());
+      Data other(data);
+
+      CHECK(data == other);
+
+      other.erase(10);
+
+      CHECK(data != other);
+
+      IData& iother = other;
+      iother = data;
+
+      CHECK(data == other);
+      CHECK_EQUAL(299, *data.begin());
+    }
+  };
+}
@@ -0,0 +1,203 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+
+#include "bucket_priority_queue.h"
+
+namespace
+{
+  SUITE(test_bucket_priority_queue)
+  {
+    static const size_t SIZE         = 8;
+    static const size_t N_PRIORITIES = 4;
+
+    typedef etl::bucket_priority_queue<int, SIZE, N_PRIORITIES> Queue;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(size_t(0), queue.size());
+      CHECK_EQUAL(SIZE, queue.available());
+      CHECK_EQUAL(SIZE, queue.max_size());
+      CHECK_EQUAL(N_PRIORITIES, queue.top_priority());
+    }
+
+    //*************************************************************************
+    TEST(test_priority_order)
+    {
+      Queue queue;
+
+      queue.push(2, 20);
+      queue.push(0, 0);
+      queue.push(3, 30);
+      queue.push(1, 10);
+
+      CHECK_EQUAL(size_t(0), queue.top_priority());
+      CHECK_EQUAL(0, queue.top());
+      queue.pop();
+      CHECK_EQUAL(10, queue.top());
+      queue.pop();
+      CHECK_EQUAL(20, queue.top());
+      queue.pop();
+      CHECK_EQUAL(size_t(3), queue.top_priority());
+      CHECK_EQUAL(30, queue.top());
+      queue.pop();
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_fifo_within_priority)
+    {
+      Queue queue;
+
+      queue.push(1, 1);
+      queue.push(1, 2);
+      queue.push(0, 0);
+      queue.push(1, 3);
+
+      int value;
+
+      queue.pop_into(value);
+      CHECK_EQUAL(0, value);
+      queue.pop_into(value);
+      CHECK_EQUAL(1, value);
+      queue.pop_into(value);
+      CHECK_EQUAL(2, value);
+      queue.pop_into(value);
+      CHECK_EQUAL(3, value);
+    }
+
+    //*************************************************************************
+    TEST(test_push_errors)
+    {
+      Queue queue;
+
+      CHECK_THROW(queue.push(N_PRIORITIES, 0), etl::bucket_priority_queue_priority);
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        queue.push(i % N_PRIORITIES, int(i));
+      }
+
+      CHECK(queue.full());
+      CHECK_THROW(queue.push(0, 0), etl::bucket_priority_queue_full);
+    }
+
+    //*************************************************************************
+    TEST(test_many_priorities)
+    {
+      // More priorities than bits in one bitmap word.
+      etl::bucket_priority_queue<int, 256, 100> queue;
+      std::vector<std::deque<int> > compare(100);
+      uint32_t seed = 12345;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        seed = seed * 1664525U + 1013904223U;
+
+        if (!queue.full() && ((seed >> 30) != 0))
+        {
+          const size_t priority = (seed >> 8) % 100;
+          queue.push(priority, i);
+          compare[priority].push_back(i);
+        }
+        else if (!queue.empty())
+        {
+          size_t priority = 0;
+
+          while (compare[priority].empty())
+          {
+            ++priority;
+          }
+
+          CHECK_EQUAL(priority, queue.top_priority());
+          CHECK_EQUAL(compare[priority].front(), queue.top());
+          queue.pop();
+          compare[priority].pop_front();
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_clear)
+    {
+      etl::bucket_priority_queue<std::string, SIZE, N_PRIORITIES> queue;
+
+      queue.push(3, "d");
+      queue.push(1, "b1");
+      queue.push(1, "b2");
+      queue.push(0, "a");
+
+      etl::bucket_priority_queue<std::string, SIZE, N_PRIORITIES> copy(queue);
+      etl::bucket_priority_queue<std::string, SIZE, N_PRIORITIES> assigned;
+      assigned.push(2, "x");
+      assigned = queue;
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK_EQUAL(N_PRIORITIES, queue.top_priority());
+
+      const char* expected[] = { "a", "b1", "b2", "d" };
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), copy.top());
+        CHECK_EQUAL(std::string(expected[i]), assigned.top());
+        copy.pop();
+        assigned.pop();
+      }
+
+      CHECK(copy.empty());
+      CHECK(assigned.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      Queue queue;
+      etl::ibucket_priority_queue<int, N_PRIORITIES>& iqueue = queue;
+
+      iqueue.push(2, 1);
+      iqueue.top() = 5;
+
+      CHECK_EQUAL(5, queue.top());
+      CHECK_EQUAL(SIZE - 1, iqueue.available());
+    }
+  };
+}
@@ -169,6 +169,61 @@ namespace
       CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
     }
 
+    //=========================================================================
+    TEST(callback_timer_delegate_repeating)
+    {
+      etl::callback_timer<3> timer_controller;
+
+      std::vector<uint64_t> lambda_tick_list;
+
+      etl::delegate<void()> member_delegate = etl::delegate<void()>::create<Test, &Test::callback>(test);
+      etl::delegate<void()> free_delegate   = etl::delegate<void()>::create<free_callback1>();
+      etl::delegate<void()> lambda_delegate([&lambda_tick_list]() { lambda_tick_list.push_back(ticks); });
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_delegate, 37, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_delegate,   23, etl::timer::mode::REPEATING);
+      etl::timer::id::type id3 = timer_controller.register_timer(lambda_delegate, 11, etl::timer::mode::REPEATING);
+
+      CHECK(id1 != etl::timer::id::NO_TIMER);
+      CHECK(id2 != etl::timer::id::NO_TIMER);
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 37, 74 };
+      std::vector<uint64_t> compare2 = { 23, 46, 69, 92 };
+      std::vector<uint64_t> compare3 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), lambda_tick_list.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),   compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(),  compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), lambda_tick_list.data(), compare3.size());
+
+      CHECK(timer_controller.unregister_timer(id3));
+      id3 = timer_controller.register_timer(free_callback2, 11, etl::timer::mode::REPEATING);
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+    }
+
     //=========================================================================
     TEST(message_timer_one_shot_after_timeout)
     {
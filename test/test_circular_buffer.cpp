@@ -0,0 +1,485 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <deque>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <string.h>
+
+#include "circular_buffer.h"
+
+#include "data.h"
+
+namespace
+{
+  const size_t SIZE = 8;
+
+  typedef TestDataNDC<std::string> ItemNDC;
+  typedef TestDataM<std::string>   ItemM;
+
+  typedef etl::circular_buffer<int, SIZE>     Data;
+  typedef etl::icircular_buffer<int>          IData;
+  typedef etl::circular_buffer<ItemNDC, SIZE> DataNDC;
+  typedef etl::circular_buffer<ItemM, SIZE>   DataM;
+
+  typedef std::deque<int> Compare_Data;
+
+  //***************************************************************************
+  // Concatenates the two array ranges.
+  template <typename TBuffer>
+  std::vector<typename TBuffer::value_type> join_arrays(TBuffer& buffer)
+  {
+    std::vector<typename TBuffer::value_type> result(buffer.array_one().begin(), buffer.array_one().end());
+    result.insert(result.end(), buffer.array_two().begin(), buffer.array_two().end());
+
+    return result;
+  }
+
+  SUITE(test_circular_buffer)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.get_overwrite());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(0U, data.array_one().size());
+      CHECK_EQUAL(0U, data.array_two().size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_pop_front)
+    {
+      Data data;
+      Compare_Data compare_data;
+
+      // Walk the front all the way round the buffer, twice.
+      for (int i = 0; i < int(4 * SIZE); ++i)
+      {
+        data.push_back(i);
+        compare_data.push_back(i);
+
+        if (data.size() == (SIZE - 2))
+        {
+          data.pop_front();
+          compare_data.pop_front();
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK_EQUAL(compare_data.front(), data.front());
+        CHECK_EQUAL(compare_data.back(), data.back());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_front_pop_back)
+    {
+      Data data;
+      Compare_Data compare_data;
+
+      for (int i = 0; i < int(4 * SIZE); ++i)
+      {
+        data.push_front(i);
+        compare_data.push_front(i);
+
+        if (data.size() == (SIZE - 1))
+        {
+          data.pop_back();
+          compare_data.pop_back();
+        }
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_overwrites_oldest)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 3); ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(3, data.front());
+      CHECK_EQUAL(int(SIZE + 2), data.back());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 3), data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_front_overwrites_newest)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.push_back(i);
+      }
+
+      data.push_front(-1);
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(-1, data.front());
+      CHECK_EQUAL(int(SIZE - 2), data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_no_overwrite)
+    {
+      Data data;
+      data.set_overwrite(false);
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_THROW(data.push_back(99), etl::circular_buffer_full);
+      CHECK_THROW(data.push_front(99), etl::circular_buffer_full);
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(0, data.front());
+      CHECK_EQUAL(int(SIZE - 1), data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_empty)
+    {
+      Data data;
+
+      CHECK_THROW(data.pop_front(), etl::circular_buffer_empty);
+      CHECK_THROW(data.pop_back(), etl::circular_buffer_empty);
+
+      data.push_back(1);
+      CHECK_THROW(data.pop_front(2), etl::circular_buffer_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_front_n)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 5); ++i)
+      {
+        data.push_back(i);
+      }
+
+      data.pop_front(3);
+      CHECK_EQUAL(SIZE - 3, data.size());
+      CHECK_EQUAL(8, data.front());
+
+      data.pop_back(2);
+      CHECK_EQUAL(SIZE - 5, data.size());
+      CHECK_EQUAL(10, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 2); ++i)
+      {
+        data.push_back(i);
+      }
+
+      const Data& cdata = data;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 2), data.at(i));
+        CHECK_EQUAL(int(i + 2), cdata.at(i));
+      }
+
+      CHECK_THROW(data.at(SIZE), etl::circular_buffer_out_of_bounds);
+      CHECK_THROW(cdata.at(SIZE), etl::circular_buffer_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 5); ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_EQUAL(int(SIZE), std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(int(SIZE), data.end() - data.begin());
+      CHECK_EQUAL(5, *data.begin());
+      CHECK_EQUAL(7, data.begin()[2]);
+      CHECK_EQUAL(9, *(data.begin() + 4));
+      CHECK_EQUAL(int(SIZE + 4), *(data.end() - 1));
+      CHECK_EQUAL(int(SIZE + 4), *data.rbegin());
+      CHECK(data.begin() < data.end());
+
+      Data::const_iterator citr = data.begin();
+      CHECK(citr == data.cbegin());
+
+      std::vector<int> reversed(data.rbegin(), data.rend());
+      std::vector<int> expected(data.begin(), data.end());
+      std::reverse(expected.begin(), expected.end());
+      CHECK(reversed == expected);
+
+      // Random access iterators work with the standard algorithms.
+      std::sort(data.begin(), data.end(), std::greater<int>());
+      CHECK(std::is_sorted(data.begin(), data.end(), std::greater<int>()));
+    }
+
+    //*************************************************************************
+    TEST(test_array_ranges)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE - 2); ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.is_linearized());
+      CHECK_EQUAL(SIZE - 2, data.array_one().size());
+      CHECK_EQUAL(0U, data.array_two().size());
+
+      data.pop_front(4);
+      data.push_back(10);
+      data.push_back(11);
+      data.push_back(12);
+
+      // 4, 5, 10, 11 at the top of the buffer, then 12 at the bottom.
+      CHECK(!data.is_linearized());
+      CHECK_EQUAL(4U, data.array_one().size());
+      CHECK_EQUAL(1U, data.array_two().size());
+      CHECK_EQUAL(4, data.array_one()[0]);
+      CHECK_EQUAL(12, data.array_two()[0]);
+
+      std::vector<int> joined = join_arrays(data);
+      CHECK(std::equal(joined.begin(), joined.end(), data.begin()));
+
+      const Data& cdata = data;
+      CHECK_EQUAL(4U, cdata.array_one().size());
+      CHECK_EQUAL(1U, cdata.array_two().size());
+
+      // The ranges may be copied directly.
+      int output[SIZE];
+      memcpy(output, data.array_one().data(), data.array_one().size() * sizeof(int));
+      memcpy(output + data.array_one().size(), data.array_two().data(), data.array_two().size() * sizeof(int));
+      CHECK(std::equal(data.begin(), data.end(), output));
+    }
+
+    //*************************************************************************
+    TEST(test_linearize_full)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 3); ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(!data.is_linearized());
+
+      int* p = data.linearize();
+
+      CHECK(data.is_linearized());
+      CHECK_EQUAL(SIZE, data.array_one().size());
+      CHECK_EQUAL(0U, data.array_two().size());
+      CHECK(p == data.array_one().data());
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(int(i + 3), p[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_linearize_non_trivial)
+    {
+      int current_count = ItemNDC::get_instance_count();
+
+      {
+        DataNDC data;
+        std::deque<ItemNDC> compare_data;
+
+        // Wrap with a gap between the back and the front.
+        for (int i = 0; i < int(SIZE + 4); ++i)
+        {
+          data.push_back(ItemNDC(std::to_string(i)));
+          compare_data.push_back(ItemNDC(std::to_string(i)));
+
+          if (data.size() > (SIZE - 3))
+          {
+            data.pop_front();
+            compare_data.pop_front();
+          }
+        }
+
+        CHECK(!data.is_linearized());
+        CHECK(!data.full());
+
+        ItemNDC* p = data.linearize();
+
+        CHECK(data.is_linearized());
+        CHECK_EQUAL(compare_data.size(), data.array_one().size());
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), p));
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+        CHECK_EQUAL(int(current_count + (compare_data.size() * 2)), ItemNDC::get_instance_count());
+
+        // Still usable afterwards.
+        data.push_back(ItemNDC("x"));
+        compare_data.push_back(ItemNDC("x"));
+        CHECK(std::equal(compare_data.begin(), compare_data.end(), data.begin()));
+      }
+
+      CHECK_EQUAL(current_count, ItemNDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_destroys)
+    {
+      int current_count = ItemNDC::get_instance_count();
+
+      {
+        DataNDC data;
+
+        for (int i = 0; i < int(SIZE + 3); ++i)
+        {
+          data.push_back(ItemNDC(std::to_string(i)));
+        }
+
+        CHECK_EQUAL(int(current_count + SIZE), ItemNDC::get_instance_count());
+
+        data.clear();
+        CHECK(data.empty());
+        CHECK_EQUAL(current_count, ItemNDC::get_instance_count());
+
+        data.push_back(ItemNDC("a"));
+        data.push_back(ItemNDC("b"));
+      }
+
+      CHECK_EQUAL(current_count, ItemNDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_move_only)
+    {
+      DataM data;
+
+      for (int i = 0; i < int(SIZE + 2); ++i)
+      {
+        data.push_back(ItemM(std::to_string(i)));
+      }
+
+      data.emplace_back("a");
+      data.emplace_front("b");
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(std::string("b"), data.front().value);
+      CHECK_EQUAL(std::string("9"), data.back().value);
+
+      DataM data2(std::move(data));
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data2.size());
+      CHECK_EQUAL(std::string("b"), data2.front().value);
+
+      data2.linearize();
+      CHECK_EQUAL(std::string("b"), data2.array_one()[0].value);
+      CHECK_EQUAL(std::string("9"), data2.array_one()[SIZE - 1].value);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE + 3); ++i)
+      {
+        data.push_back(i);
+      }
+
+      Data data2(data);
+      CHECK(data2 == data);
+      CHECK(data2.is_linearized());
+
+      Data data3;
+      data3.push_back(1);
+      CHECK(data3 != data);
+
+      data3 = data;
+      CHECK(data3 == data);
+
+      IData& idata = data3;
+      idata.pop_back();
+      CHECK(data3 != data);
+    }
+
+    //*************************************************************************
+    TEST(test_assign)
+    {
+      Compare_Data compare_data;
+
+      for (int i = 0; i < int(SIZE * 2); ++i)
+      {
+        compare_data.push_back(i);
+      }
+
+      // Keeps the last SIZE values.
+      Data data(compare_data.begin(), compare_data.end());
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK(std::equal(compare_data.begin() + SIZE, compare_data.end(), data.begin()));
+
+      data.assign(3, 7);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(7, data[0]);
+      CHECK_EQUAL(7, data[2]);
+
+      Data data2 = { 1, 2, 3 };
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(3, data2.back());
+    }
+  };
+}
@@ -0,0 +1,421 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+#include "UnitTest++.h"
+
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <stdint.h>
+
+#include "compressed_bitmap.h"
+
+namespace
+{
+  typedef etl::compressed_bitmap<16, 4, 64> Data;
+  typedef std::set<uint32_t>                Compare;
+
+  //***************************************************************************
+  // A simple repeatable random sequence.
+  uint32_t next_random(uint32_t& state)
+  {
+    state = (state * 1103515245U) + 12345U;
+    return state >> 8;
+  }
+
+  //***************************************************************************
+  bool is_equal(const Data& data, const Compare& compare)
+  {
+    return (data.count() == compare.size()) && std::equal(compare.begin(), compare.end(), data.begin());
+  }
+
+  //***************************************************************************
+  void fill(Data& data, Compare& compare, uint32_t seed, size_t n, uint32_t mask)
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      uint32_t value = next_random(seed) & mask;
+      data.set(value);
+      compare.insert(value);
+    }
+  }
+
+  //***************************************************************************
+  void fill_range(Data& data, Compare& compare, uint32_t first, uint32_t last)
+  {
+    for (uint32_t value = first; value <= last; ++value)
+    {
+      data.set(value);
+      compare.insert(value);
+    }
+  }
+
+  SUITE(test_compressed_bitmap)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.count());
+      CHECK_EQUAL(0U, data.chunk_count());
+      CHECK_EQUAL(16U, data.max_chunks());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_set_test_reset)
+    {
+      Data data;
+
+      data.set(5).set(3).set(0x12345678).set(3).set(0xFFFFFFFF);
+
+      CHECK_EQUAL(4U, data.count());
+      CHECK_EQUAL(3U, data.chunk_count());
+      CHECK(data.test(3));
+      CHECK(data.test(5));
+      CHECK(data.test(0x12345678));
+      CHECK(data.test(0xFFFFFFFF));
+      CHECK(!data.test(4));
+      CHECK(!data.test(0x12345679));
+
+      data.reset(5).reset(0x12345678).reset(6);
+
+      CHECK_EQUAL(2U, data.count());
+      CHECK_EQUAL(2U, data.chunk_count());
+      CHECK(data.test(3));
+      CHECK(!data.test(5));
+      CHECK(!data.test(0x12345678));
+
+      data.reset();
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_in_order)
+    {
+      Data    data;
+      Compare compare;
+
+      fill(data, compare, 1, 200, 0xFFFFFFFF & 0x0007FFFF);
+
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_sparse_random)
+    {
+      Data    data;
+      Compare compare;
+
+      // Enough values in one chunk to force each representation.
+      fill(data, compare, 12345, 5000, 0x0000FFFF);
+      CHECK(is_equal(data, compare));
+
+      uint32_t seed = 6789;
+
+      for (size_t i = 0; i < 5000; ++i)
+      {
+        uint32_t value = next_random(seed) & 0x0000FFFF;
+        data.reset(value);
+        compare.erase(value);
+      }
+
+      CHECK(is_equal(data, compare));
+
+      for (uint32_t value = 0; value < 0x10000; ++value)
+      {
+        CHECK_EQUAL(compare.count(value) != 0, data.test(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_runs)
+    {
+      Data    data;
+      Compare compare;
+
+      // Long runs that would not fit in an array.
+      fill_range(data, compare, 100, 20000);
+      fill_range(data, compare, 30000, 30500);
+      fill_range(data, compare, 65000, 65700);
+
+      CHECK(is_equal(data, compare));
+
+      // Split a run.
+      data.reset(200);
+      compare.erase(200);
+      data.reset(30000);
+      compare.erase(30000);
+
+      CHECK(is_equal(data, compare));
+
+      // Join runs.
+      fill_range(data, compare, 20000, 30000);
+
+      CHECK(is_equal(data, compare));
+      CHECK(data.test(25000));
+      CHECK(!data.test(99));
+      CHECK(!data.test(200));
+    }
+
+    //*************************************************************************
+    TEST(test_runs_random)
+    {
+      Data    data;
+      Compare compare;
+
+      uint32_t seed = 42;
+
+      // Clusters of values, with some removed.
+      for (size_t i = 0; i < 2000; ++i)
+      {
+        uint32_t value = (next_random(seed) % 32) * 1000;
+        uint32_t n     = next_random(seed) % 50;
+
+        for (uint32_t j = 0; j < n; ++j)
+        {
+          if ((next_random(seed) % 4) == 0)
+          {
+            data.reset(value + j);
+            compare.erase(value + j);
+          }
+          else
+          {
+            data.set(value + j);
+            compare.insert(value + j);
+          }
+        }
+      }
+
+      CHECK(is_equal(data, compare));
+
+      for (uint32_t value = 0; value < 33000; ++value)
+      {
+        CHECK_EQUAL(compare.count(value) != 0, data.test(value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_dense_to_sparse)
+    {
+      Data    data;
+      Compare compare;
+
+      for (uint32_t value = 0; value < 0x10000; value += 3)
+      {
+        data.set(value);
+        compare.insert(value);
+      }
+
+      CHECK(is_equal(data, compare));
+
+      // Remove all but a few.
+      for (uint32_t value = 0; value < 0x10000; value += 3)
+      {
+        if ((value % 999) != 0)
+        {
+          data.reset(value);
+          compare.erase(value);
+        }
+      }
+
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_set_operations)
+    {
+      const uint32_t masks[] = { 0x0003FFFF, 0x0001FFFF, 0x000000FF };
+      const size_t   sizes[] = { 30, 2000, 40000 };
+
+      for (size_t m = 0; m < 3; ++m)
+      {
+        for (size_t sa = 0; sa < 3; ++sa)
+        {
+          for (size_t sb = 0; sb < 3; ++sb)
+          {
+            Data    a;
+            Data    b;
+            Compare ca;
+            Compare cb;
+
+            fill(a, ca, uint32_t(sa + 1), sizes[sa], masks[m]);
+            fill(b, cb, uint32_t(sb + 100), sizes[sb], masks[(m + sb) % 3]);
+            fill_range(b, cb, 1000, 3000);
+
+            Compare expected;
+
+            Data result(a);
+            result &= b;
+            expected.clear();
+            std::set_intersection(ca.begin(), ca.end(), cb.begin(), cb.end(), std::inserter(expected, expected.end()));
+            CHECK(is_equal(result, expected));
+
+            result = a;
+            result |= b;
+            expected.clear();
+            std::set_union(ca.begin(), ca.end(), cb.begin(), cb.end(), std::inserter(expected, expected.end()));
+            CHECK(is_equal(result, expected));
+
+            result = a;
+            result ^= b;
+            expected.clear();
+            std::set_symmetric_difference(ca.begin(), ca.end(), cb.begin(), cb.end(), std::inserter(expected, expected.end()));
+            CHECK(is_equal(result, expected));
+
+            result = a;
+            result.and_not(b);
+            expected.clear();
+            std::set_difference(ca.begin(), ca.end(), cb.begin(), cb.end(), std::inserter(expected, expected.end()));
+            CHECK(is_equal(result, expected));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_set_operations_with_self)
+    {
+      Data    data;
+      Compare compare;
+
+      fill(data, compare, 1, 3000, 0x0001FFFF);
+
+      data &= data;
+      CHECK(is_equal(data, compare));
+
+      data |= data;
+      CHECK(is_equal(data, compare));
+
+      data ^= data;
+      CHECK(data.empty());
+
+      fill(data, compare, 1, 3000, 0x0001FFFF);
+
+      data.and_not(data);
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      Data a;
+      Data b;
+
+      CHECK(a == b);
+
+      // Same values, built in a different order.
+      for (uint32_t value = 0; value < 1000; ++value)
+      {
+        a.set(value);
+        b.set(999 - value);
+      }
+
+      CHECK(a == b);
+
+      b.reset(500);
+
+      CHECK(a != b);
+    }
+
+    //*************************************************************************
+    TEST(test_serialize)
+    {
+      Data    data;
+      Compare compare;
+
+      fill(data, compare, 1, 100, 0x0007FFFF);
+      fill(data, compare, 2, 30000, 0x0000FFFF);
+      fill_range(data, compare, 0x00200000, 0x00201000);
+
+      std::vector<uint8_t> buffer(data.serialized_size());
+
+      CHECK_EQUAL(0U, data.serialize(buffer.data(), buffer.size() - 1));
+      CHECK_EQUAL(buffer.size(), data.serialize(buffer.data(), buffer.size()));
+
+      Data result;
+      CHECK(result.deserialize(buffer.data(), buffer.size()));
+      CHECK(is_equal(result, compare));
+
+      // Into a bitmap with a different array size.
+      etl::compressed_bitmap<16, 8, 1024> other;
+      CHECK(other.deserialize(buffer.data(), buffer.size()));
+      CHECK(std::equal(compare.begin(), compare.end(), other.begin()));
+      CHECK_EQUAL(compare.size(), other.count());
+    }
+
+    //*************************************************************************
+    TEST(test_deserialize_invalid)
+    {
+      Data    data;
+      Compare compare;
+
+      fill(data, compare, 1, 30, 0x0000FFFF);
+
+      std::vector<uint8_t> buffer(data.serialized_size());
+      data.serialize(buffer.data(), buffer.size());
+
+      Data result;
+
+      // Truncated.
+      CHECK(!result.deserialize(buffer.data(), buffer.size() - 1));
+      CHECK(result.empty());
+
+      // Out of order values.
+      std::swap(buffer[13], buffer[15]);
+      std::swap(buffer[14], buffer[16]);
+      CHECK(!result.deserialize(buffer.data(), buffer.size()));
+      CHECK(result.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::compressed_bitmap<2, 1, 16> data;
+
+      data.set(0x00000000);
+      data.set(0x00010000);
+
+      CHECK_THROW(data.set(0x00020000), etl::compressed_bitmap_full);
+
+      // One dense chunk.
+      for (uint32_t value = 0; value < 200; value += 2)
+      {
+        data.set(value);
+      }
+
+      // A second dense chunk.
+      CHECK_THROW(for (uint32_t value = 0x00010000; value < 0x00010100; value += 2) data.set(value), etl::compressed_bitmap_full);
+    }
+  };
+}
@@ -0,0 +1,307 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string>
+
+#include "delegate.h"
+
+namespace
+{
+  //***************************************************************************
+  int  called_value = 0;
+  bool was_called   = false;
+
+  //***************************************************************************
+  void free_void()
+  {
+    was_called = true;
+  }
+
+  //***************************************************************************
+  int free_int(int i)
+  {
+    was_called   = true;
+    called_value = i;
+    return i * 2;
+  }
+
+  //***************************************************************************
+  int other_free_int(int i)
+  {
+    return i * 3;
+  }
+
+  //***************************************************************************
+  struct Object
+  {
+    Object()
+      : offset(10)
+    {
+    }
+
+    int member(int i)
+    {
+      was_called   = true;
+      called_value = i;
+      return i + offset;
+    }
+
+    int const_member(int i) const
+    {
+      return i + offset + 1;
+    }
+
+    int offset;
+  };
+
+  Object object_static;
+
+  //***************************************************************************
+  /// Counts live copies, to check that stored function objects are copied and
+  /// destroyed correctly.
+  //***************************************************************************
+  struct Counted
+  {
+    Counted()
+    {
+      ++instances;
+    }
+
+    Counted(const Counted&)
+    {
+      ++instances;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int operator ()(int i) const
+    {
+      return i + 100;
+    }
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  //***************************************************************************
+  struct SetupFixture
+  {
+    SetupFixture()
+    {
+      called_value = 0;
+      was_called   = false;
+    }
+  };
+
+  SUITE(test_delegate)
+  {
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_is_empty)
+    {
+      etl::delegate<void()> d;
+
+      CHECK(!d.is_valid());
+      CHECK(!d);
+      CHECK_THROW(d(), etl::delegate_uninitialised);
+      CHECK(!d.call_if());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_free_function_compile_time)
+    {
+      etl::delegate<void()> d = etl::delegate<void()>::create<free_void>();
+
+      CHECK(d.is_valid());
+      d();
+      CHECK(was_called);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_free_function_run_time)
+    {
+      etl::delegate<int(int)> d(free_int);
+
+      CHECK_EQUAL(6, d(3));
+      CHECK(was_called);
+      CHECK_EQUAL(3, called_value);
+
+      d = &other_free_int;
+      CHECK_EQUAL(9, d(3));
+
+      int (*null_function)(int) = nullptr;
+      etl::delegate<int(int)> d2(null_function);
+      CHECK(!d2.is_valid());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_member_function_compile_time)
+    {
+      Object object;
+      etl::delegate<int(int)> d = etl::delegate<int(int)>::create<Object, &Object::member>(object);
+
+      CHECK_EQUAL(15, d(5));
+      CHECK(was_called);
+
+      object.offset = 20;
+      CHECK_EQUAL(25, d(5));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_const_member_function_compile_time)
+    {
+      const Object object;
+      etl::delegate<int(int)> d = etl::delegate<int(int)>::create<Object, &Object::const_member>(object);
+
+      CHECK_EQUAL(16, d(5));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_member_function_and_instance_compile_time)
+    {
+      etl::delegate<int(int)> d = etl::delegate<int(int)>::create<Object, object_static, &Object::member>();
+
+      CHECK_EQUAL(15, d(5));
+      CHECK(was_called);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_member_function_run_time)
+    {
+      Object object;
+      etl::delegate<int(int)> d = etl::delegate<int(int)>::create(object, &Object::member);
+
+      CHECK_EQUAL(15, d(5));
+      CHECK_EQUAL(5, called_value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_lambda)
+    {
+      int total = 0;
+      etl::delegate<void(int)> d([&total](int i) { total += i; });
+
+      d(1);
+      d(2);
+      d(3);
+
+      CHECK_EQUAL(6, total);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_lambda_captured_by_value)
+    {
+      int offset = 7;
+      etl::delegate<int(int)> d([offset](int i) { return i + offset; });
+
+      offset = 0;
+      CHECK_EQUAL(10, d(3));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_reference_parameters)
+    {
+      etl::delegate<void(std::string&, const std::string&)> d([](std::string& out, const std::string& in) { out += in; });
+
+      std::string text("abc");
+      d(text, "def");
+
+      CHECK_EQUAL(std::string("abcdef"), text);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_assign)
+    {
+      Object object;
+      etl::delegate<int(int)> d1 = etl::delegate<int(int)>::create<Object, &Object::member>(object);
+      etl::delegate<int(int)> d2(d1);
+      etl::delegate<int(int)> d3;
+
+      d3 = d2;
+
+      CHECK_EQUAL(15, d2(5));
+      CHECK_EQUAL(15, d3(5));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_non_trivial_function_object_lifetime)
+    {
+      CHECK_EQUAL(0, Counted::instances);
+
+      {
+        etl::delegate<int(int)> d1((Counted()));
+        CHECK_EQUAL(1, Counted::instances);
+
+        etl::delegate<int(int)> d2(d1);
+        CHECK_EQUAL(2, Counted::instances);
+        CHECK_EQUAL(101, d2(1));
+
+        etl::delegate<int(int)> d3(free_int);
+        d3 = d1;
+        CHECK_EQUAL(3, Counted::instances);
+
+        d2 = etl::delegate<int(int)>::create<free_int>();
+        CHECK_EQUAL(2, Counted::instances);
+
+        d1.clear();
+        CHECK_EQUAL(1, Counted::instances);
+        CHECK(!d1.is_valid());
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equality)
+    {
+      Object object1;
+      Object object2;
+
+      etl::delegate<int(int)> d1 = etl::delegate<int(int)>::create<Object, &Object::member>(object1);
+      etl::delegate<int(int)> d2 = etl::delegate<int(int)>::create<Object, &Object::member>(object1);
+      etl::delegate<int(int)> d3 = etl::delegate<int(int)>::create<Object, &Object::member>(object2);
+      etl::delegate<int(int)> d4 = etl::delegate<int(int)>::create<free_int>();
+      etl::delegate<int(int)> d5(free_int);
+      etl::delegate<int(int)> d6(free_int);
+      etl::delegate<int(int)> d7;
+      etl::delegate<int(int)> d8;
+
+      CHECK(d1 == d2);
+      CHECK(d1 != d3);
+      CHECK(d1 != d4);
+      CHECK(d5 == d6);
+      CHECK(d7 == d8);
+      CHECK(d4 != d7);
+    }
+  };
+}
@@ -58,6 +58,40 @@ namespace
     typedef std::deque<NDC>          Compare_Data;
     typedef std::deque<DC>           Compare_DataDC;
 
+    typedef TestDataM<std::string>   M;
+    typedef etl::deque<M, SIZE>      DataM;
+
+    //*************************************************************************
+    struct Five
+    {
+      Five(int a_, int b_, int c_, int d_, const std::string& e_)
+        : a(a_), b(b_), c(c_), d(d_), e(e_)
+      {
+      }
+
+      int a, b, c, d;
+      std::string e;
+    };
+
+    //*************************************************************************
+    bool Check_Values(const DataM& data, const char* values)
+    {
+      DataM::const_iterator itr = data.begin();
+
+      while (*values != 0)
+      {
+        if ((itr == data.end()) || (itr->value != std::string(1, *values)) || !itr->valid)
+        {
+          return false;
+        }
+
+        ++itr;
+        ++values;
+      }
+
+      return itr == data.end();
+    }
+
     NDC N0 = NDC("0");
     NDC N1 = NDC("1");
     NDC N2 = NDC("2");
@@ -1746,5 +1780,282 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST(test_push_move)
+    {
+      DataM data;
+
+      M m("1");
+      data.push_back(std::move(m));
+      data.push_back(M("2"));
+      data.push_front(M("0"));
+
+      CHECK(!m.valid);
+      CHECK(Check_Values(data, "012"));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_move)
+    {
+      DataM data;
+
+      for (char c = '0'; c <= '9'; c += 2)
+      {
+        data.push_back(M(std::string(1, c)));
+      }
+
+      data.insert(data.begin() + 1, M("1"));
+      data.insert(data.end() - 1, M("7"));
+      data.insert(data.begin() + 3, M("3"));
+      data.insert(data.end() - 3, M("5"));
+      data.emplace(data.end(), std::string("X"));
+      data.emplace(data.begin() + 1, std::string("Y"));
+
+      CHECK(Check_Values(data, "0Y12345678X"));
+
+      data.erase(data.begin() + 1);
+      data.erase(data.end() - 1);
+      data.erase(data.begin() + 2, data.begin() + 4);
+      data.erase(data.end() - 4, data.end() - 2);
+
+      CHECK(Check_Values(data, "01478"));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      etl::deque<Five, SIZE> data;
+
+      data.emplace_back(1, 2, 3, 4, "5");
+      data.emplace_front(6, 7, 8, 9, "10");
+      data.emplace(data.begin() + 1, 11, 12, 13, 14, "15");
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("10"), data[0].e);
+      CHECK_EQUAL(std::string("15"), data[1].e);
+      CHECK_EQUAL(std::string("5"),  data[2].e);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+      data1.push_back(M("1"));
+      data1.push_front(M("0"));
+
+      DataM data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK(Check_Values(data2, "01"));
+
+      DataM data3;
+      data3.push_back(M("9"));
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK(Check_Values(data3, "01"));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_trivially_copyable_wrapped)
+    {
+      // Exercise the block moves with the contents both contiguous and wrapped around the buffer.
+      for (size_t offset = 0; offset < SIZE; ++offset)
+      {
+        DataInt data;
+        std::deque<int> compare;
+
+        for (size_t i = 0; i < offset; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        for (int i = 0; i < 8; ++i)
+        {
+          data.push_back(i);
+          compare.push_back(i);
+        }
+
+        data.insert(data.begin() + 2, 3, 100);
+        compare.insert(compare.begin() + 2, 3, 100);
+
+        data.insert(data.end() - 2, 2, 200);
+        compare.insert(compare.end() - 2, 2, 200);
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+        data.erase(data.begin() + 1, data.begin() + 4);
+        compare.erase(compare.begin() + 1, compare.begin() + 4);
+
+        data.erase(data.end() - 4, data.end() - 1);
+        compare.erase(compare.end() - 4, compare.end() - 1);
+
+        data.erase(data.begin() + 3);
+        compare.erase(compare.begin() + 3);
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_array_ranges)
+    {
+      for (size_t offset = 0; offset < SIZE; ++offset)
+      {
+        DataInt data;
+
+        for (size_t i = 0; i < offset; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        for (int i = 0; i < 10; ++i)
+        {
+          data.push_back(i);
+        }
+
+        const DataInt& cdata = data;
+
+        DataInt::array_range       one  = data.array_one();
+        DataInt::array_range       two  = data.array_two();
+        DataInt::const_array_range cone = cdata.array_one();
+        DataInt::const_array_range ctwo = cdata.array_two();
+
+        CHECK_EQUAL(data.size(), one.size() + two.size());
+        CHECK_EQUAL(one.size(), cone.size());
+        CHECK_EQUAL(two.size(), ctwo.size());
+        CHECK(std::equal(one.begin(), one.end(), data.begin()));
+        CHECK(std::equal(two.begin(), two.end(), data.begin() + one.size()));
+        CHECK(&data.front() == one.data());
+
+        if (two.size() > 0)
+        {
+          CHECK(&data.back() == (two.data() + two.size() - 1));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_trivially_copyable_wrapped)
+    {
+      const int source[] = { 10, 11, 12, 13, 14, 15 };
+
+      for (size_t offset = 0; offset < SIZE; ++offset)
+      {
+        DataInt data;
+        std::deque<int> compare;
+
+        for (size_t i = 0; i < offset; ++i)
+        {
+          data.push_back(0);
+          data.pop_front();
+        }
+
+        data.assign(source, source + 4);
+        compare.assign(source, source + 4);
+
+        data.insert(data.end(), source, source + 3);
+        compare.insert(compare.end(), source, source + 3);
+
+        data.insert(data.begin(), source + 2, source + 6);
+        compare.insert(compare.begin(), source + 2, source + 6);
+
+        data.insert(data.begin() + 3, source, source + 2);
+        compare.insert(compare.begin() + 3, source, source + 2);
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+        for (size_t i = 0; i < compare.size(); ++i)
+        {
+          CHECK_EQUAL(compare[i], data[i]);
+          CHECK_EQUAL(compare[i], data.at(i));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_front_of_empty)
+    {
+      const int source[] = { 1, 2, 3 };
+
+      DataInt data;
+      data.insert(data.begin(), source, source + 3);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(std::equal(source, source + 3, data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_empty_range)
+    {
+      DataNDC data;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data.push_back(NDC(std::to_string(i)));
+      }
+
+      data.erase(data.begin() + 3, data.begin() + 3);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(std::string("3"), data[3].value);
+      CHECK_EQUAL(std::string("4"), data[4].value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_zero_elements)
+    {
+      const std::string empty[] = { "" };
+
+      etl::deque<std::string, 8> data;
+      data.push_back("a");
+      data.push_back("b");
+      data.push_back("c");
+      data.push_back("d");
+
+      etl::deque<std::string, 8>::iterator itr = data.insert(data.begin() + 3, 0, std::string("Z"));
+      CHECK(itr == data.begin() + 3);
+
+      itr = data.insert(data.begin() + 1, empty, empty);
+      CHECK(itr == data.begin() + 1);
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(std::string("a"), data[0]);
+      CHECK_EQUAL(std::string("b"), data[1]);
+      CHECK_EQUAL(std::string("c"), data[2]);
+      CHECK_EQUAL(std::string("d"), data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_own_element)
+    {
+      etl::deque<std::string, 16> data;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data.push_back(std::to_string(i));
+      }
+
+      // Closer to the back, then closer to the front.
+      data.insert(data.begin() + 4, data[5]);
+      data.insert(data.begin() + 1, data[0]);
+      data.insert(data.begin() + 6, 2, data[7]);
+      data.insert(data.begin() + 1, 2, data[0]);
+
+      const char* expected[] = { "0", "0", "0", "0", "1", "2", "3", "5", "5", "5", "4", "5" };
+
+      CHECK_EQUAL(12U, data.size());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), data[i]);
+      }
+    }
   };
 }
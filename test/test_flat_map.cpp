@@ -695,6 +695,125 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      const ElementNDC existing[] = { ElementNDC(1, N1), ElementNDC(5, N5), ElementNDC(8, N8) };
+      const ElementNDC extra[]    = { ElementNDC(9, N9), ElementNDC(3, N3), ElementNDC(5, N15),
+                                      ElementNDC(0, N0), ElementNDC(3, N3), ElementNDC(7, N7) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      compare_data.insert(std::begin(existing), std::end(existing));
+
+      int current_count = NDC::get_instance_count();
+
+      data.insert(std::begin(extra), std::end(extra));
+      CHECK_EQUAL(current_count + 4, NDC::get_instance_count());
+
+      compare_data.insert(std::begin(extra), std::end(extra));
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(compare_data.count(i), data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      const ElementNDC existing[] = { ElementNDC(1, N1), ElementNDC(5, N5), ElementNDC(8, N8) };
+      const ElementNDC extra[]    = { ElementNDC(0, N0), ElementNDC(1, N11), ElementNDC(1, N12),
+                                      ElementNDC(2, N2), ElementNDC(5, N15), ElementNDC(9, N9) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      compare_data.insert(std::begin(existing), std::end(existing));
+
+      data.insert_sorted(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_sorted(initial_data.begin(), initial_data.end());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+
+      // Not actually sorted.
+      data.assign_sorted(initial_data.rbegin(), initial_data.rend());
+
+      isEqual = Check_Equal(data.begin(),
+                            data.end(),
+                            compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_duplicates_when_nearly_full)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 8);
+      DataNDC data(initial_data.begin(), initial_data.begin() + 8);
+
+      // More than the free space, but only two are new.
+      data.insert(initial_data.begin() + 5, initial_data.end());
+      compare_data.insert(initial_data.begin() + 5, initial_data.end());
+
+      CHECK(data.full());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_frozen)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      data.freeze();
+      data.insert(initial_data.begin() + 5, initial_data.end());
+
+      CHECK(!data.frozen());
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        DataNDC::iterator itr = data.find(initial_data[i].first);
+        CHECK(itr != data.end());
+        CHECK(itr->second == initial_data[i].second);
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -1152,5 +1271,42 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_freeze)
+    {
+      std::map<int, int> compare_data;
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        compare_data[i * 3] = i;
+        data.insert(ElementInt(i * 3, i));
+      }
+
+      data.freeze();
+      CHECK(data.frozen());
+
+      for (int key = -1; key <= int(SIZE * 3); ++key)
+      {
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        CHECK_EQUAL(compare_data.count(key), data.count(key));
+      }
+
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      data.erase(9);
+      compare_data.erase(9);
+      CHECK(!data.frozen());
+
+      data.insert(ElementInt(10, 99));
+      compare_data[10] = 99;
+
+      data.freeze();
+      CHECK_EQUAL(99, data.at(10));
+      CHECK(data.find(9) == data.end());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
   };
 }
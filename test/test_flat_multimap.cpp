@@ -549,6 +549,89 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_equal_keys)
+    {
+      DataInt data;
+
+      const ElementInt existing[] = { ElementInt(1, 10), ElementInt(5, 50) };
+      const ElementInt extra[]    = { ElementInt(5, 51), ElementInt(0, 0), ElementInt(1, 11), ElementInt(3, 30) };
+      const DataInt::value_type expected[] = { ElementInt(0, 0), ElementInt(1, 11), ElementInt(1, 10), ElementInt(3, 30), ElementInt(5, 51), ElementInt(5, 50) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(6U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_duplicate_order)
+    {
+      DataInt data;
+      DataInt one_at_a_time;
+
+      const ElementInt existing[] = { ElementInt(2, 20), ElementInt(1, 10) };
+      const ElementInt extra[]    = { ElementInt(2, 21), ElementInt(1, 11), ElementInt(2, 22), ElementInt(0, 0),
+                                      ElementInt(1, 12), ElementInt(2, 23), ElementInt(1, 13), ElementInt(2, 24) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert(std::begin(extra), std::end(extra));
+
+      for (size_t i = 0; i < 2; ++i)
+      {
+        one_at_a_time.insert(existing[i]);
+      }
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        one_at_a_time.insert(extra[i]);
+      }
+
+      CHECK_EQUAL(one_at_a_time.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), one_at_a_time.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted_equal_keys)
+    {
+      DataInt data;
+
+      const ElementInt existing[] = { ElementInt(1, 10), ElementInt(5, 50) };
+      const ElementInt extra[]    = { ElementInt(0, 0), ElementInt(1, 11), ElementInt(1, 12), ElementInt(5, 51), ElementInt(9, 90) };
+      const DataInt::value_type expected[] = { ElementInt(0, 0), ElementInt(1, 12), ElementInt(1, 11), ElementInt(1, 10), ElementInt(5, 51), ElementInt(5, 50), ElementInt(9, 90) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert_sorted(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(7U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_sorted(initial_data.begin(), initial_data.end());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
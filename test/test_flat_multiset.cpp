@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <sstream>
 
 #include "data.h"
 
@@ -512,6 +513,63 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_equal_values)
+    {
+      DataInt data;
+
+      const int existing[] = { 1, 5, 8 };
+      const int extra[]    = { 9, 3, 5, 0, 3, 7 };
+      const int expected[] = { 0, 1, 3, 3, 5, 5, 7, 8, 9 };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(9U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign_sorted(initial_data.begin(), initial_data.end());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+
+      // Fills the flat_multiset, leaving no room to merge into.
+      data.assign_sorted(initial_data.begin(), initial_data.begin() + 5);
+      data.insert_sorted(initial_data.begin(), initial_data.begin() + 5);
+
+      CHECK(data.full());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_input_iterator)
+    {
+      const int expected[] = { 1, 1, 2, 3, 3, 5 };
+
+      DataInt data;
+
+      // Single pass.
+      std::istringstream stream("3 1 5 3 2 1");
+      data.insert(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+      CHECK_EQUAL(6U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
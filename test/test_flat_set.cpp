@@ -35,6 +35,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <sstream>
 
 #include "data.h"
 
@@ -520,6 +521,88 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      DataInt data;
+
+      const int existing[] = { 1, 5, 8 };
+      const int extra[]    = { 9, 3, 5, 0, 3, 7 };
+      const int expected[] = { 0, 1, 3, 5, 7, 8, 9 };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(7U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      data.insert_sorted(initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(different_data.begin(), different_data.end());
+
+      // Not actually sorted.
+      data.assign_sorted(initial_data.rbegin(), initial_data.rend());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_duplicates_when_nearly_full)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 8);
+
+      // More than the free space, but only two are new.
+      data.insert(initial_data.begin() + 5, initial_data.end());
+
+      CHECK(data.full());
+
+      bool isEqual = std::equal(data.begin(), data.end(), initial_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_input_iterator)
+    {
+      const int expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      DataInt data(std::begin(expected), std::begin(expected) + 6);
+
+      // Single pass, more than the free space, but only four are new.
+      std::istringstream stream("9 2 7 2 8 6 9");
+      data.insert(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+
+      CHECK(data.full());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
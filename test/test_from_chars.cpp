@@ -0,0 +1,349 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <string>
+#include <limits>
+#include <cmath>
+#include <string.h>
+#include <stdlib.h>
+
+#include "from_chars.h"
+#include "to_string.h"
+#include "cstring.h"
+#include "u16string.h"
+
+namespace
+{
+  typedef etl::string_view View;
+
+  SUITE(test_from_chars)
+  {
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      int value = 0;
+
+      etl::from_chars_result<char> result = etl::from_chars(View("12345"), value);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK_EQUAL(12345, value);
+
+      result = etl::from_chars(View("-42xyz"), value);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK_EQUAL(-42, value);
+      CHECK_EQUAL('x', *result.ptr);
+
+      int64_t value64 = 0;
+      result = etl::from_chars(View("-9223372036854775808"), value64);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK(value64 == std::numeric_limits<int64_t>::min());
+
+      uint64_t uvalue64 = 0;
+      result = etl::from_chars(View("18446744073709551615"), uvalue64);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK(uvalue64 == std::numeric_limits<uint64_t>::max());
+    }
+
+    //*************************************************************************
+    TEST(test_integer_bases)
+    {
+      uint32_t value = 0;
+
+      CHECK(etl::from_chars(View("ff"), value, 16U).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(255U, value);
+
+      CHECK(etl::from_chars(View("DeadBeef"), value, 16U).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(0xDEADBEEFU, value);
+
+      CHECK(etl::from_chars(View("1012"), value, 2U).ptr == View("1012").begin() + 3);
+      CHECK_EQUAL(5U, value);
+    }
+
+    //*************************************************************************
+    TEST(test_integer_invalid)
+    {
+      View text("+1");
+      int value = 99;
+
+      etl::from_chars_result<char> result = etl::from_chars(text, value);
+      CHECK(result.status == etl::from_chars_status::invalid_argument);
+      CHECK(result.ptr == text.begin());
+      CHECK_EQUAL(99, value);
+
+      unsigned uvalue = 99U;
+      CHECK(etl::from_chars(View("-1"), uvalue).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View(" 1"), uvalue).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View(""), uvalue).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View("-"), value).status == etl::from_chars_status::invalid_argument);
+      CHECK_EQUAL(99U, uvalue);
+
+      CHECK_THROW(etl::from_chars(View("1"), value, 0U), etl::from_chars_invalid_base);
+      CHECK_THROW(etl::from_chars(View("1"), value, 1U), etl::from_chars_invalid_base);
+      CHECK_THROW(etl::from_chars(View("1"), value, 37U), etl::from_chars_invalid_base);
+      CHECK_EQUAL(99, value);
+    }
+
+    //*************************************************************************
+    TEST(test_integer_out_of_range)
+    {
+      View text("128;");
+      int8_t value = 1;
+
+      etl::from_chars_result<char> result = etl::from_chars(text, value);
+      CHECK(result.status == etl::from_chars_status::result_out_of_range);
+      CHECK(result.ptr == text.begin() + 3);
+      CHECK_EQUAL(1, value);
+
+      CHECK(etl::from_chars(View("-128"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(-128, value);
+
+      CHECK(etl::from_chars(View("-129"), value).status == etl::from_chars_status::result_out_of_range);
+
+      uint16_t value16 = 0;
+      CHECK(etl::from_chars(View("65535"), value16).status == etl::from_chars_status::ok);
+      CHECK(etl::from_chars(View("65536"), value16).status == etl::from_chars_status::result_out_of_range);
+      CHECK_EQUAL(65535U, value16);
+
+      uint64_t value64 = 0;
+      CHECK(etl::from_chars(View("18446744073709551616"), value64).status == etl::from_chars_status::result_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_floats)
+    {
+      double value = 0.0;
+
+      CHECK(etl::from_chars(View("1.5"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(1.5, value);
+
+      CHECK(etl::from_chars(View("-0.001"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(-0.001, value);
+
+      CHECK(etl::from_chars(View(".5"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(0.5, value);
+
+      CHECK(etl::from_chars(View("5."), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(5.0, value);
+
+      CHECK(etl::from_chars(View("1e10"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(1e10, value);
+
+      CHECK(etl::from_chars(View("2.5E-3"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(2.5e-3, value);
+
+      CHECK(etl::from_chars(View("1.7976931348623157e308"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<double>::max(), value);
+
+      CHECK(etl::from_chars(View("4.9406564584124654e-324"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(), value);
+
+      CHECK(etl::from_chars(View("0.1000000000000000055511151231257827021181583404541015625"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(0.1, value);
+
+      CHECK(etl::from_chars(View("-0"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(0.0, value);
+      CHECK(std::signbit(value));
+    }
+
+    //*************************************************************************
+    TEST(test_float_many_digits)
+    {
+      double value = 0.0;
+
+      // More than 19 significant digits, with the halfway point between
+      // the first 19 digits and the full value.
+      CHECK(etl::from_chars(View("73936022489751805956"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(strtod("73936022489751805956", 0), value);
+
+      // Just above halfway between 2^53 and 2^53 + 2.
+      CHECK(etl::from_chars(View("9007199254740993.00000000000000000001"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(9007199254740994.0, value);
+
+      // Exactly halfway rounds to even.
+      CHECK(etl::from_chars(View("9007199254740993.00000000000000000000"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(9007199254740992.0, value);
+
+      // More digits than are passed to strtod.
+      std::string text("0.");
+      text.append(900, '3');
+      text += "e1";
+      CHECK(etl::from_chars(View(text.c_str()), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(strtod(text.c_str(), 0), value);
+
+      // Random digit strings, with a random point and exponent.
+      uint64_t seed = 0x0123456789ABCDEF;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        const int n_digits = 20 + int(seed % 30U);
+        const int point    = int((seed >> 8) % uint64_t(n_digits + 1));
+        const int exponent = int((seed >> 16) % 600U) - 300;
+
+        text.clear();
+
+        for (int d = 0; d < n_digits; ++d)
+        {
+          if (d == point)
+          {
+            text += '.';
+          }
+
+          seed ^= seed << 13;
+          seed ^= seed >> 7;
+          seed ^= seed << 17;
+          text += char('0' + (seed % 10U));
+        }
+
+        text += 'e';
+        text += std::to_string(exponent);
+
+        const double expected = strtod(text.c_str(), 0);
+
+        if ((expected == 0.0) || ((expected - expected) != 0.0))
+        {
+          continue;
+        }
+
+        value = 0.0;
+        etl::from_chars(View(text.c_str()), value);
+        CHECK_EQUAL(expected, value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_float_end_of_parse)
+    {
+      double value = 0.0;
+
+      View text("3.25e");
+      etl::from_chars_result<char> result = etl::from_chars(text, value);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK(result.ptr == text.begin() + 4);
+      CHECK_EQUAL(3.25, value);
+
+      View text2("1e+x");
+      result = etl::from_chars(text2, value);
+      CHECK(result.ptr == text2.begin() + 1);
+      CHECK_EQUAL(1.0, value);
+    }
+
+    //*************************************************************************
+    TEST(test_float_special_values)
+    {
+      double value = 0.0;
+
+      CHECK(etl::from_chars(View("inf"), value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(std::numeric_limits<double>::infinity(), value);
+
+      View text("-Infinity!");
+      etl::from_chars_result<char> result = etl::from_chars(text, value);
+      CHECK(result.ptr == text.begin() + 9);
+      CHECK_EQUAL(-std::numeric_limits<double>::infinity(), value);
+
+      CHECK(etl::from_chars(View("NaN"), value).status == etl::from_chars_status::ok);
+      CHECK(value != value);
+    }
+
+    //*************************************************************************
+    TEST(test_float_invalid_and_out_of_range)
+    {
+      double value = 7.0;
+
+      CHECK(etl::from_chars(View("."), value).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View("e5"), value).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View("-"), value).status == etl::from_chars_status::invalid_argument);
+      CHECK(etl::from_chars(View("1e400"), value).status == etl::from_chars_status::result_out_of_range);
+      CHECK(etl::from_chars(View("1e-400"), value).status == etl::from_chars_status::result_out_of_range);
+      CHECK_EQUAL(7.0, value);
+
+      float fvalue = 7.0f;
+      CHECK(etl::from_chars(View("1e39"), fvalue).status == etl::from_chars_status::result_out_of_range);
+      CHECK_EQUAL(7.0f, fvalue);
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip_with_to_string)
+    {
+      etl::string<32> text;
+
+      uint64_t seed = 0x0F1E2D3C4B5A6978;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        double value;
+        memcpy(&value, &seed, sizeof(value));
+
+        if ((value != value) || ((value - value) != 0.0))
+        {
+          continue;
+        }
+
+        etl::to_string(value, text);
+
+        double parsed = 0.0;
+        CHECK(etl::from_chars(View(text.c_str()), parsed).status == etl::from_chars_status::ok);
+        CHECK_EQUAL(value, parsed);
+
+        float fvalue = float(value);
+
+        if ((fvalue - fvalue) == 0.0f)
+        {
+          etl::to_string(fvalue, text);
+
+          float fparsed = 0.0f;
+          etl::from_chars(View(text.c_str()), fparsed);
+          CHECK_EQUAL(fvalue, fparsed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      etl::u16string_view text(u"-1234.5");
+
+      double value = 0.0;
+      CHECK(etl::from_chars(text, value).status == etl::from_chars_status::ok);
+      CHECK_EQUAL(-1234.5, value);
+
+      int ivalue = 0;
+      etl::from_chars_result<char16_t> result = etl::from_chars(text, ivalue);
+      CHECK(result.status == etl::from_chars_status::ok);
+      CHECK_EQUAL(-1234, ivalue);
+      CHECK(*result.ptr == u'.');
+    }
+  };
+}
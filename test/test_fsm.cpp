@@ -35,6 +35,7 @@ SOFTWARE.
 #include "queue.h"
 
 #include <iostream>
+#include <vector>
 
 
 namespace
@@ -326,6 +327,106 @@ namespace
 
   MotorControl motorControl(stateList, etl::size(stateList));
 
+  //***************************************************************************
+  // The queued motor control FSM.
+  //***************************************************************************
+  struct QueuedStateId
+  {
+    enum
+    {
+      IDLE,
+      RUNNING,
+      NUMBER_OF_STATES
+    };
+  };
+
+  typedef etl::largest<Start, Stop, SetSpeed, Stopped, Recursive> QueuedLargest;
+
+  class QueuedMotorControl : public etl::queued_fsm<QueuedStateId::NUMBER_OF_STATES, 4, QueuedLargest::size, QueuedLargest::alignment>
+  {
+  public:
+
+    QueuedMotorControl(etl::ifsm_state** p_states, size_t size)
+      : queued_fsm(MOTOR_CONTROL),
+        startCount(0),
+        startedRecursively(false)
+    {
+      set_states(p_states, size);
+    }
+
+    int              startCount;
+    bool             startedRecursively;
+    std::vector<int> speeds;
+  };
+
+  //***********************************
+  class QueuedIdle : public etl::fsm_state<QueuedMotorControl, QueuedIdle, QueuedStateId::IDLE, Start, SetSpeed, Recursive>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Start&)
+    {
+      ++get_fsm_context().startCount;
+      return QueuedStateId::RUNNING;
+    }
+
+    // The speed cannot be set until running.
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const SetSpeed& event)
+    {
+      get_fsm_context().defer(event);
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Recursive&)
+    {
+      get_fsm_context().post(Start());
+      get_fsm_context().startedRecursively = (get_fsm_context().startCount != 0);
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  //***********************************
+  class QueuedRunning : public etl::fsm_state<QueuedMotorControl, QueuedRunning, QueuedStateId::RUNNING, Stop, SetSpeed, Stopped>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Stop&)
+    {
+      return QueuedStateId::IDLE;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const SetSpeed& event)
+    {
+      get_fsm_context().speeds.push_back(event.speed);
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Stopped&)
+    {
+      get_fsm_context().post(SetSpeed(1));
+      get_fsm_context().post_urgent(SetSpeed(2));
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  QueuedIdle    queuedIdle;
+  QueuedRunning queuedRunning;
+
+  etl::ifsm_state* queuedStateList[QueuedStateId::NUMBER_OF_STATES] =
+  {
+    &queuedIdle, &queuedRunning
+  };
+
   SUITE(test_map)
   {
     //*************************************************************************
@@ -566,5 +667,123 @@ namespace
       CHECK(motorControl.accepts(Stopped()));
       CHECK(motorControl.accepts(Unsupported()));
     }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_self_posted_event)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+
+      // The posted Start is handled after Recursive has completed.
+      motor.receive(Recursive());
+
+      CHECK(!motor.startedRecursively);
+      CHECK_EQUAL(1, motor.startCount);
+      CHECK_EQUAL(QueuedStateId::RUNNING, int(motor.get_state_id()));
+      CHECK_EQUAL(0U, motor.queued_events());
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_post_when_idle)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+
+      // Handled immediately.
+      CHECK(motor.post(Start()));
+      CHECK_EQUAL(QueuedStateId::RUNNING, int(motor.get_state_id()));
+      CHECK_EQUAL(0U, motor.queued_events());
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_deferred_events)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+
+      motor.receive(SetSpeed(5));
+      motor.receive(SetSpeed(6));
+
+      CHECK_EQUAL(2U, motor.deferred_events_size());
+      CHECK(motor.speeds.empty());
+
+      // The deferred events are handled in order after the change of state.
+      motor.receive(Start());
+
+      CHECK_EQUAL(0U, motor.deferred_events_size());
+      CHECK_EQUAL(2U, motor.speeds.size());
+      CHECK_EQUAL(5, motor.speeds[0]);
+      CHECK_EQUAL(6, motor.speeds[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_urgent_event)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+      motor.receive(Start());
+
+      motor.receive(Stopped());
+
+      CHECK_EQUAL(2U, motor.speeds.size());
+      CHECK_EQUAL(2, motor.speeds[0]);
+      CHECK_EQUAL(1, motor.speeds[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_batch)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+      motor.receive(Start());
+
+      const SetSpeed batch[] = { SetSpeed(10), SetSpeed(20), SetSpeed(30) };
+
+      motor.receive(etl::begin(batch), etl::end(batch));
+
+      CHECK_EQUAL(3U, motor.speeds.size());
+      CHECK_EQUAL(10, motor.speeds[0]);
+      CHECK_EQUAL(20, motor.speeds[1]);
+      CHECK_EQUAL(30, motor.speeds[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_event_counts)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+
+      motor.receive(Stopped());
+      motor.receive(Start());
+      motor.receive(SetSpeed(1));
+      motor.receive(SetSpeed(2));
+      motor.receive(Stop());
+
+      CHECK_EQUAL(2U, motor.get_event_count(QueuedStateId::IDLE));
+      CHECK_EQUAL(3U, motor.get_event_count(QueuedStateId::RUNNING));
+
+      motor.clear_event_counts();
+      CHECK_EQUAL(0U, motor.get_event_count(QueuedStateId::IDLE));
+      CHECK_EQUAL(0U, motor.get_event_count(QueuedStateId::RUNNING));
+    }
+
+    //*************************************************************************
+    TEST(test_queued_fsm_queue_full)
+    {
+      QueuedMotorControl motor(queuedStateList, etl::size(queuedStateList));
+      motor.start();
+
+      for (int i = 0; i < 4; ++i)
+      {
+        motor.receive(SetSpeed(i));
+      }
+
+      CHECK_EQUAL(4U, motor.queued_events());
+      CHECK_THROW(motor.post(Start()), etl::fsm_queue_full_exception);
+
+      // Reset discards the deferred events.
+      motor.reset();
+      CHECK_EQUAL(0U, motor.queued_events());
+    }
   };
 }
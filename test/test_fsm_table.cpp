@@ -0,0 +1,332 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "fsm_table.h"
+
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  // The context.
+  //***************************************************************************
+  struct Motor
+  {
+    Motor()
+      : speed(0),
+        start_count(0),
+        can_reset(true)
+    {
+    }
+
+    std::string log;
+    int         speed;
+    int         start_count;
+    bool        can_reset;
+  };
+
+  //***************************************************************************
+  // States.
+  //***************************************************************************
+  struct Idle
+  {
+    static void on_enter(Motor& motor) { motor.log += "+Idle"; }
+    static void on_exit(Motor& motor)  { motor.log += "-Idle"; }
+  };
+
+  struct Operating
+  {
+    static void on_enter(Motor& motor) { motor.log += "+Operating"; }
+    static void on_exit(Motor& motor)  { motor.log += "-Operating"; }
+  };
+
+  struct Running
+  {
+    static void on_enter(Motor& motor) { motor.log += "+Running"; }
+    static void on_exit(Motor& motor)  { motor.log += "-Running"; }
+  };
+
+  // Paused only has an entry function.
+  struct Paused
+  {
+    static void on_enter(Motor& motor) { motor.log += "+Paused"; }
+  };
+
+  // Fault has neither.
+  struct Fault
+  {
+  };
+
+  //***************************************************************************
+  // Events.
+  //***************************************************************************
+  struct Start    {};
+  struct Pause    {};
+  struct Resume   {};
+  struct Error    {};
+  struct Reset    {};
+  struct Unknown  {};
+
+  struct Stop
+  {
+    explicit Stop(bool emergency_ = false) : emergency(emergency_) {}
+    bool emergency;
+  };
+
+  struct SetSpeed
+  {
+    explicit SetSpeed(int speed_) : speed(speed_) {}
+    int speed;
+  };
+
+  //***************************************************************************
+  // Actions and guards.
+  //***************************************************************************
+  struct CountStart
+  {
+    void operator ()(Motor& motor, const Start&) const
+    {
+      ++motor.start_count;
+      motor.log += "/Start";
+    }
+  };
+
+  struct ApplySpeed
+  {
+    void operator ()(Motor& motor, const SetSpeed& event) const
+    {
+      motor.speed = event.speed;
+    }
+  };
+
+  struct IsEmergency
+  {
+    bool operator ()(Motor&, const Stop& event) const
+    {
+      return event.emergency;
+    }
+  };
+
+  struct CanReset
+  {
+    bool operator ()(Motor& motor, const Reset&) const
+    {
+      return motor.can_reset;
+    }
+  };
+
+  //***************************************************************************
+  // The FSM.
+  //***************************************************************************
+  typedef etl::fsm_table_states<etl::fsm_table_state<Idle>,
+                                etl::fsm_table_state<Operating>,
+                                etl::fsm_table_state<Running, Operating>,
+                                etl::fsm_table_state<Paused,  Operating>,
+                                etl::fsm_table_state<Fault> > States;
+
+  typedef etl::fsm_table_transitions<etl::fsm_table_transition<Idle,      Start,    Operating, CountStart>,
+                                     etl::fsm_table_transition<Running,   Pause,    Paused>,
+                                     etl::fsm_table_transition<Running,   SetSpeed, void,      ApplySpeed>,
+                                     etl::fsm_table_transition<Running,   Stop,     Fault,     void,      IsEmergency>,
+                                     etl::fsm_table_transition<Paused,    Resume,   Running>,
+                                     etl::fsm_table_transition<Paused,    Pause,    Paused>,
+                                     etl::fsm_table_transition<Operating, Stop,     Idle>,
+                                     etl::fsm_table_transition<Operating, Error,    Fault>,
+                                     etl::fsm_table_transition<Fault,     Reset,    Idle,      void,      CanReset> > Transitions;
+
+  typedef etl::fsm_table<Motor, States, Transitions> MotorFsm;
+
+  SUITE(test_fsm_table)
+  {
+    //*************************************************************************
+    TEST(test_state_ids)
+    {
+      CHECK_EQUAL(5U, MotorFsm::NUMBER_OF_STATES);
+      CHECK_EQUAL(0, int(MotorFsm::state_id<Idle>::value));
+      CHECK_EQUAL(2, int(MotorFsm::state_id<Running>::value));
+      CHECK_EQUAL(4, int(MotorFsm::state_id<Fault>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_start)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+
+      CHECK(!fsm.is_started());
+      CHECK_THROW(fsm.receive(Start()), etl::fsm_null_state_exception);
+
+      fsm.start();
+      CHECK(fsm.is_started());
+      CHECK_EQUAL(int(MotorFsm::state_id<Idle>::value), int(fsm.get_state_id()));
+      CHECK_EQUAL(std::string("+Idle"), motor.log);
+
+      // A second start does nothing.
+      fsm.start();
+      CHECK_EQUAL(std::string("+Idle"), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_enter_composite_state)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      motor.log.clear();
+
+      // Entering Operating enters its first child.
+      CHECK(fsm.receive(Start()));
+      CHECK_EQUAL(int(MotorFsm::state_id<Running>::value), int(fsm.get_state_id()));
+      CHECK_EQUAL(std::string("-Idle/Start+Operating+Running"), motor.log);
+      CHECK_EQUAL(1, motor.start_count);
+
+      CHECK(fsm.is_in_state<Running>());
+      CHECK(fsm.is_in_state<Operating>());
+      CHECK(!fsm.is_in_state<Idle>());
+    }
+
+    //*************************************************************************
+    TEST(test_transition_between_children)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      fsm.receive(Start());
+      motor.log.clear();
+
+      // The parent is not exited.
+      CHECK(fsm.receive(Pause()));
+      CHECK_EQUAL(std::string("-Running+Paused"), motor.log);
+
+      // A self transition exits and enters the state.
+      motor.log.clear();
+      CHECK(fsm.receive(Pause()));
+      CHECK(fsm.is_in_state<Paused>());
+      CHECK_EQUAL(std::string("+Paused"), motor.log);
+
+      motor.log.clear();
+      CHECK(fsm.receive(Resume()));
+      CHECK_EQUAL(std::string("+Running"), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_inherited_transition)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      fsm.receive(Start());
+      fsm.receive(Pause());
+      motor.log.clear();
+
+      // Paused does not handle Stop, so Operating does.
+      CHECK(fsm.receive(Stop()));
+      CHECK(fsm.is_in_state<Idle>());
+      CHECK_EQUAL(std::string("-Operating+Idle"), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_guards)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      fsm.receive(Start());
+
+      // The guard on Running fails, so Operating handles Stop.
+      motor.log.clear();
+      CHECK(fsm.receive(Stop(false)));
+      CHECK(fsm.is_in_state<Idle>());
+      CHECK_EQUAL(std::string("-Running-Operating+Idle"), motor.log);
+
+      fsm.receive(Start());
+      CHECK(fsm.receive(Stop(true)));
+      CHECK(fsm.is_in_state<Fault>());
+
+      motor.can_reset = false;
+      CHECK(!fsm.receive(Reset()));
+      CHECK(fsm.is_in_state<Fault>());
+
+      motor.can_reset = true;
+      CHECK(fsm.receive(Reset()));
+      CHECK(fsm.is_in_state<Idle>());
+    }
+
+    //*************************************************************************
+    TEST(test_internal_transition)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      fsm.receive(Start());
+      motor.log.clear();
+
+      CHECK(fsm.receive(SetSpeed(100)));
+      CHECK_EQUAL(100, motor.speed);
+      CHECK(fsm.is_in_state<Running>());
+      CHECK_EQUAL(std::string(""), motor.log);
+    }
+
+    //*************************************************************************
+    TEST(test_unhandled_events)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+
+      CHECK(!fsm.receive(Unknown()));
+      CHECK(!fsm.receive(Pause()));
+      CHECK(!fsm.receive(SetSpeed(10)));
+      CHECK(fsm.is_in_state<Idle>());
+      CHECK_EQUAL(0, motor.speed);
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      Motor    motor;
+      MotorFsm fsm(motor);
+      fsm.start();
+      fsm.receive(Start());
+
+      fsm.reset();
+      CHECK(!fsm.is_started());
+      CHECK_EQUAL(int(MotorFsm::NO_STATE), int(fsm.get_state_id()));
+
+      fsm.start();
+      fsm.receive(Start());
+      motor.log.clear();
+
+      fsm.reset(true);
+      CHECK_EQUAL(std::string("-Running-Operating"), motor.log);
+      CHECK(!fsm.is_started());
+    }
+  };
+}
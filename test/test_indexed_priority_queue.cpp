@@ -0,0 +1,352 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "UnitTest++.h"
+
+#include <algorithm>
+#include <vector>
+#include <functional>
+
+#include "indexed_priority_queue.h"
+
+namespace
+{
+  //***************************************************************************
+  /// Pushes, pops, updates and erases a pseudo random sequence, checking the
+  /// order against a sorted copy.
+  //***************************************************************************
+  template <typename TQueue, typename TCompare>
+  void check_random_updates(TQueue& queue, TCompare compare)
+  {
+    std::vector<int>    values(queue.max_size(), 0);
+    std::vector<size_t> handles;
+    uint32_t seed = 12345;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      const int value = int((seed >> 8) % 1000);
+
+      switch (seed >> 30)
+      {
+        case 0:
+        case 1:
+        {
+          if (!queue.full())
+          {
+            const size_t handle = queue.push(value);
+            CHECK(queue.contains(handle));
+            values[handle] = value;
+            handles.push_back(handle);
+          }
+          break;
+        }
+
+        case 2:
+        {
+          if (!handles.empty())
+          {
+            const size_t handle = handles[(seed >> 4) % handles.size()];
+            queue.update(handle, value);
+            values[handle] = value;
+            CHECK_EQUAL(value, queue[handle]);
+          }
+          break;
+        }
+
+        default:
+        {
+          if (!handles.empty())
+          {
+            const size_t index  = (seed >> 4) % handles.size();
+            const size_t handle = handles[index];
+            queue.erase(handle);
+            CHECK(!queue.contains(handle));
+            handles.erase(handles.begin() + index);
+          }
+          break;
+        }
+      }
+
+      CHECK_EQUAL(handles.size(), queue.size());
+
+      if (!queue.empty())
+      {
+        // The top must not be lower than any queued value.
+        for (size_t j = 0; j < handles.size(); ++j)
+        {
+          CHECK(!compare(queue.top(), values[handles[j]]));
+        }
+
+        CHECK_EQUAL(values[queue.top_handle()], queue.top());
+      }
+    }
+
+    std::vector<int> expected;
+
+    for (size_t j = 0; j < handles.size(); ++j)
+    {
+      expected.push_back(values[handles[j]]);
+    }
+
+    std::sort(expected.begin(), expected.end(), compare);
+
+    while (!queue.empty())
+    {
+      CHECK_EQUAL(expected.back(), queue.top());
+      expected.pop_back();
+      queue.pop();
+    }
+  }
+
+  SUITE(test_indexed_priority_queue)
+  {
+    static const size_t SIZE = 4;
+
+    typedef etl::indexed_priority_queue<int, SIZE> Queue;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(size_t(0), queue.size());
+      CHECK_EQUAL(SIZE, queue.available());
+      CHECK_EQUAL(SIZE, queue.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Queue queue;
+
+      queue.push(2);
+      queue.push(4);
+      queue.push(1);
+      queue.push(3);
+
+      CHECK(queue.full());
+
+      CHECK_EQUAL(4, queue.top());
+      queue.pop();
+      CHECK_EQUAL(3, queue.top());
+      queue.pop();
+      CHECK_EQUAL(2, queue.top());
+      queue.pop();
+      CHECK_EQUAL(1, queue.top());
+      queue.pop();
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_handles)
+    {
+      Queue queue;
+
+      const size_t h1 = queue.push(1);
+      const size_t h2 = queue.push(2);
+      const size_t h3 = queue.push(3);
+
+      CHECK_EQUAL(size_t(0), h1);
+      CHECK_EQUAL(size_t(1), h2);
+      CHECK_EQUAL(size_t(2), h3);
+
+      CHECK_EQUAL(1, queue[h1]);
+      CHECK_EQUAL(2, queue[h2]);
+      CHECK_EQUAL(3, queue[h3]);
+      CHECK_EQUAL(h3, queue.top_handle());
+
+      queue.pop();
+      CHECK(!queue.contains(h3));
+      CHECK(!queue.contains(Queue::npos));
+
+      // The released handle is reused.
+      const size_t h4 = queue.push(4);
+      CHECK_EQUAL(h3, h4);
+      CHECK_EQUAL(4, queue.top());
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      Queue queue;
+
+      const size_t h1 = queue.push(10);
+      const size_t h2 = queue.push(20);
+      const size_t h3 = queue.push(30);
+
+      // Increase key.
+      queue.update(h1, 40);
+      CHECK_EQUAL(h1, queue.top_handle());
+      CHECK_EQUAL(40, queue.top());
+
+      // Decrease key.
+      queue.update(h1, 5);
+      CHECK_EQUAL(h3, queue.top_handle());
+
+      // No change of position.
+      queue.update(h2, 25);
+      CHECK_EQUAL(h3, queue.top_handle());
+
+      queue.pop();
+      CHECK_EQUAL(25, queue.top());
+      queue.pop();
+      CHECK_EQUAL(5, queue.top());
+      queue.pop();
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Queue queue;
+
+      const size_t h1 = queue.push(1);
+      const size_t h2 = queue.push(2);
+      const size_t h3 = queue.push(3);
+      const size_t h4 = queue.push(4);
+
+      // Middle.
+      queue.erase(h2);
+      CHECK_EQUAL(size_t(3), queue.size());
+      CHECK(!queue.contains(h2));
+
+      // Top.
+      queue.erase(h4);
+      CHECK_EQUAL(3, queue.top());
+
+      // Last.
+      queue.erase(h1);
+      CHECK_EQUAL(3, queue.top());
+
+      queue.erase(h3);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_full)
+    {
+      Queue queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      CHECK_THROW(queue.push(5), etl::indexed_priority_queue_full);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_handle)
+    {
+      Queue queue;
+
+      const size_t handle = queue.push(1);
+      queue.pop();
+
+      CHECK_THROW(queue.update(handle, 2), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(queue.erase(handle), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(queue.erase(SIZE), etl::indexed_priority_queue_invalid_handle);
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Queue queue;
+
+      const size_t h1 = queue.push(1);
+      const size_t h2 = queue.push(3);
+      queue.push(2);
+
+      Queue copy(queue);
+
+      CHECK_EQUAL(queue.size(), copy.size());
+      CHECK_EQUAL(1, copy[h1]);
+
+      // The handles are kept.
+      copy.update(h1, 4);
+      CHECK_EQUAL(h1, copy.top_handle());
+      CHECK_EQUAL(h2, queue.top_handle());
+
+      Queue assigned;
+      assigned.push(9);
+      assigned = copy;
+
+      CHECK_EQUAL(4, assigned.top());
+      assigned.pop();
+      CHECK_EQUAL(3, assigned.top());
+      assigned.pop();
+      CHECK_EQUAL(2, assigned.top());
+      assigned.pop();
+      CHECK(assigned.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Queue queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(size_t(0), queue.push(3));
+    }
+
+    //*************************************************************************
+    TEST(test_random_updates)
+    {
+      etl::indexed_priority_queue<int, 64> binary;
+      check_random_updates(binary, std::less<int>());
+
+      etl::indexed_priority_queue<int, 64, std::less<int>, 4> quaternary;
+      check_random_updates(quaternary, std::less<int>());
+
+      etl::indexed_priority_queue<int, 64, std::greater<int>, 8> octonary;
+      check_random_updates(octonary, std::greater<int>());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      etl::indexed_priority_queue<int, 8, std::less<int>, 4> queue;
+      etl::iindexed_priority_queue<int, std::less<int>, 4>& iqueue = queue;
+
+      iqueue.push(1);
+      iqueue.push(2);
+
+      CHECK_EQUAL(2, queue.top());
+      CHECK_EQUAL(size_t(6), iqueue.available());
+    }
+  };
+}
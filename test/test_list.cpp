@@ -54,6 +54,9 @@ namespace
 
     typedef etl::list<int, SIZE> DataInt;
 
+    typedef TestDataM<std::string> ItemM;
+    typedef etl::list<ItemM, SIZE> DataM;
+
     typedef std::list<ItemNDC>   CompareData;
     typedef std::vector<ItemNDC> InitialData;
 
@@ -1669,5 +1672,121 @@ namespace
 
       CHECK_THROW(data0.merge(data1), etl::list_unsorted);
     }
+
+    //*************************************************************************
+    TEST(test_push_insert_move)
+    {
+      DataM data;
+
+      ItemM m("1");
+      data.push_back(std::move(m));
+      data.push_front(ItemM("0"));
+      data.push_back(ItemM("3"));
+      data.insert(std::prev(data.end()), ItemM("2"));
+
+      CHECK(!m.valid);
+      CHECK_EQUAL(4U, data.size());
+
+      std::string expected[] = { "0", "1", "2", "3" };
+      DataM::iterator itr = data.begin();
+
+      for (size_t i = 0; i < 4; ++i, ++itr)
+      {
+        CHECK(itr->valid);
+        CHECK_EQUAL(expected[i], itr->value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_variadic)
+    {
+      etl::list<std::pair<int, std::string>, SIZE> data;
+
+      data.emplace_back(2, "two");
+      data.emplace_front(0, "zero");
+      data.emplace(std::next(data.begin()), 1, "one");
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(0, data.front().first);
+      CHECK_EQUAL(std::string("one"), std::next(data.begin())->second);
+      CHECK_EQUAL(std::string("two"), data.back().second);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+      data1.push_back(ItemM("0"));
+      data1.push_back(ItemM("1"));
+
+      DataM data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(std::string("0"), data2.front().value);
+      CHECK_EQUAL(std::string("1"), data2.back().value);
+
+      DataM data3;
+      data3.push_back(ItemM("9"));
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(std::string("0"), data3.front().value);
+      CHECK(data3.back().valid);
+    }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      DataM data;
+      std::list<std::string> compare_data;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        data.push_back(ItemM(std::to_string(i)));
+        compare_data.push_back(std::to_string(i));
+      }
+
+      // Scatter the nodes.
+      for (size_t i = 0; i < SIZE / 2; ++i)
+      {
+        data.erase(std::next(data.begin(), i));
+        compare_data.erase(std::next(compare_data.begin(), i));
+      }
+
+      for (size_t i = 0; i < SIZE / 2; ++i)
+      {
+        data.push_front(ItemM(std::to_string(i + SIZE)));
+        compare_data.push_front(std::to_string(i + SIZE));
+      }
+
+      int current_count = ItemM::get_instance_count();
+
+      data.compact();
+
+      CHECK_EQUAL(current_count, ItemM::get_instance_count());
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      std::list<std::string>::const_iterator itr = compare_data.begin();
+      const ItemM* previous = nullptr;
+
+      for (DataM::const_iterator i_data = data.begin(); i_data != data.end(); ++i_data, ++itr)
+      {
+        CHECK_EQUAL(*itr, i_data->value);
+        CHECK(i_data->valid);
+        CHECK(&*i_data > previous);
+        previous = &*i_data;
+      }
+
+      // The free list is rebuilt.
+      data.pop_front();
+      data.pop_back();
+      data.push_back(ItemM("A"));
+      data.push_back(ItemM("B"));
+
+      CHECK(data.full());
+      CHECK_EQUAL(std::string("B"), data.back().value);
+    }
   };
 }
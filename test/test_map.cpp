@@ -38,6 +38,8 @@ SOFTWARE.
 
 #include "map.h"
 
+#include "data.h"
+
 static const size_t MAX_SIZE = 10;
 
 #define TEST_GREATER_THAN
@@ -1054,5 +1056,117 @@ namespace
 #endif
     }
 
+    //*************************************************************************
+    TEST(test_insert_move_and_emplace)
+    {
+      etl::map<int, TestDataM<std::string>, MAX_SIZE> data;
+
+      TestDataM<std::string> m("one");
+      data.insert(std::make_pair(1, std::move(m)));
+      data.insert(data.begin(), std::make_pair(0, TestDataM<std::string>("zero")));
+
+      std::pair<etl::map<int, TestDataM<std::string>, MAX_SIZE>::iterator, bool> result = data.emplace(2, "two");
+
+      CHECK(!m.valid);
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("two"), result.first->second.value);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("zero"), data.find(0)->second.value);
+      CHECK_EQUAL(std::string("one"),  data.find(1)->second.value);
+
+      result = data.emplace(2, "again");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("two"), result.first->second.value);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef etl::map<int, TestDataM<std::string>, MAX_SIZE> DataM;
+
+      DataM data1;
+      data1.emplace(1, "one");
+      data1.emplace(0, "zero");
+
+      DataM data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(std::string("zero"), data2.begin()->second.value);
+      CHECK(data2.find(1)->second.valid);
+
+      DataM data3;
+      data3.emplace(9, "nine");
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK(data3.find(9) == data3.end());
+      CHECK_EQUAL(std::string("one"), data3.find(1)->second.value);
+    }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::map<int, TestDataM<std::string>, MAX_SIZE> DataM;
+
+      DataM data;
+      std::map<int, std::string> compare_data;
+
+      // Scatter the nodes.
+      for (int i = 0; i < int(MAX_SIZE); ++i)
+      {
+        data.emplace(i * 2, std::to_string(i));
+      }
+
+      for (int i = 0; i < int(MAX_SIZE); i += 2)
+      {
+        data.erase(i * 2);
+      }
+
+      for (int i = int(MAX_SIZE) - 1; i >= 0; i -= 2)
+      {
+        data.emplace((i * 2) + 1, std::to_string(i));
+      }
+
+      for (DataM::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        compare_data[itr->first] = itr->second.value;
+      }
+
+      data.compact();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      std::map<int, std::string>::const_iterator itr = compare_data.begin();
+      const DataM::value_type* previous = nullptr;
+
+      for (DataM::const_iterator i_data = data.begin(); i_data != data.end(); ++i_data, ++itr)
+      {
+        CHECK_EQUAL(itr->first, i_data->first);
+        CHECK_EQUAL(itr->second, i_data->second.value);
+        CHECK(i_data->second.valid);
+        CHECK(&*i_data > previous);
+        previous = &*i_data;
+      }
+
+      // The tree and the free list are rebuilt.
+      for (itr = compare_data.begin(); itr != compare_data.end(); ++itr)
+      {
+        CHECK(data.find(itr->first) != data.end());
+      }
+
+      data.erase(3);
+      data.erase(7);
+      data.emplace(100, "100");
+      data.emplace(-1, "-1");
+      data.erase(100);
+      data.emplace(101, "101");
+
+      CHECK_EQUAL(MAX_SIZE, data.size());
+      CHECK_EQUAL(-1, data.begin()->first);
+      CHECK_EQUAL(101, (--data.end())->first);
+    }
+
   };
 }
@@ -29,6 +29,16 @@ SOFTWARE.
 #include "UnitTest++.h"
 
 #include "observer.h"
+#include "observable_atomic.h"
+
+#include <string>
+
+#define REALTIME_TEST 0
+
+#if REALTIME_TEST
+  #include <thread>
+  #include <atomic>
+#endif
 
 //*****************************************************************************
 // Notification1
@@ -430,6 +440,281 @@ namespace
       observable.clear_observers();
       CHECK_EQUAL(size_t(0), observable.number_of_observers());
     }
+
+    //*************************************************************************
+    // Records the order of the notifications.
+    //*************************************************************************
+    class RecordingObserver : public etl::observer<int>
+    {
+    public:
+
+      RecordingObserver(char name_, std::string& log_)
+        : name(name_),
+          log(log_)
+      {
+      }
+
+      void notification(int n)
+      {
+        log += name;
+        log += char('0' + n);
+      }
+
+    private:
+
+      char         name;
+      std::string& log;
+    };
+
+    //*************************************************************************
+    TEST(test_batched_notifications)
+    {
+      class Observable : public etl::observable<RecordingObserver, 2>
+      {
+      };
+
+      std::string log;
+
+      Observable        observable;
+      RecordingObserver a('a', log);
+      RecordingObserver b('b', log);
+
+      observable.add_observer(a);
+      observable.add_observer(b);
+
+      const int notifications[] = { 1, 2, 3 };
+
+      // Each observer is sent all of the notifications in turn.
+      observable.notify_observers(notifications, notifications + 3);
+      CHECK_EQUAL(std::string("a1a2a3b1b2b3"), log);
+
+      log.clear();
+      observable.notify_observers(notifications, notifications);
+      CHECK_EQUAL(std::string(""), log);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    // A counter that does not derive from etl::observer.
+    //*************************************************************************
+    struct Counter
+    {
+      Counter()
+        : total(0)
+      {
+      }
+
+      void notification(int n)
+      {
+        total += n;
+      }
+
+      // Passed by reference.
+      void notification(Notification2&)
+      {
+        ++total;
+      }
+
+      int total;
+    };
+
+    //*************************************************************************
+    TEST(test_static_observable)
+    {
+      std::string log;
+
+      RecordingObserver a('a', log);
+      Counter           counter;
+      RecordingObserver b('b', log);
+
+      etl::static_observable<RecordingObserver, Counter, RecordingObserver> observable(a, counter, b);
+
+      CHECK_EQUAL(size_t(3), observable.number_of_observers());
+
+      observable.notify_observers(4);
+      CHECK_EQUAL(std::string("a4b4"), log);
+      CHECK_EQUAL(4, counter.total);
+
+      log.clear();
+      const int notifications[] = { 1, 2 };
+      observable.notify_observers(notifications, notifications + 2);
+      CHECK_EQUAL(std::string("a1a2b1b2"), log);
+      CHECK_EQUAL(7, counter.total);
+
+      etl::static_observable<Counter> counter_observable(counter);
+      counter_observable.notify_observers(Notification2());
+      CHECK_EQUAL(8, counter.total);
+    }
+#endif
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_observable_atomic_observer_list)
+    {
+      std::string log;
+
+      etl::observable_atomic<RecordingObserver, 3> observable;
+
+      RecordingObserver a('a', log);
+      RecordingObserver b('b', log);
+      RecordingObserver c('c', log);
+      RecordingObserver d('d', log);
+
+      CHECK_EQUAL(size_t(0), observable.number_of_observers());
+
+      observable.add_observer(a);
+      observable.add_observer(b);
+      observable.add_observer(c);
+      observable.add_observer(b);
+      CHECK_EQUAL(size_t(3), observable.number_of_observers());
+
+      CHECK_THROW(observable.add_observer(d), etl::observer_list_full);
+      CHECK_EQUAL(size_t(3), observable.number_of_observers());
+
+      observable.notify_observers(1);
+      CHECK_EQUAL(std::string("a1b1c1"), log);
+
+      // The order of the others is kept.
+      log.clear();
+      observable.remove_observer(b);
+      observable.remove_observer(d);
+      CHECK_EQUAL(size_t(2), observable.number_of_observers());
+      observable.notify_observers(2);
+      CHECK_EQUAL(std::string("a2c2"), log);
+
+      log.clear();
+      observable.add_observer(d);
+      const int notifications[] = { 3, 4 };
+      observable.notify_observers(notifications, notifications + 2);
+      CHECK_EQUAL(std::string("a3a4c3c4d3d4"), log);
+
+      log.clear();
+      observable.clear_observers();
+      CHECK_EQUAL(size_t(0), observable.number_of_observers());
+      observable.notify_observers(5);
+      CHECK_EQUAL(std::string(""), log);
+    }
+
+    //*************************************************************************
+    // Adds an observer during a notification.
+    //*************************************************************************
+    class AddingObserver : public etl::observer<int>
+    {
+    public:
+
+      typedef etl::observable_atomic<AddingObserver, 3> Observable;
+
+      AddingObserver(Observable& observable_, AddingObserver& other_)
+        : observable(observable_),
+          other(other_),
+          count(0)
+      {
+      }
+
+      void notification(int)
+      {
+        ++count;
+        observable.add_observer(other);
+      }
+
+      Observable&     observable;
+      AddingObserver& other;
+      int             count;
+    };
+
+    //*************************************************************************
+    TEST(test_observable_atomic_add_during_notification)
+    {
+      AddingObserver::Observable observable;
+
+      AddingObserver a(observable, a);
+      AddingObserver b(observable, a);
+      AddingObserver c(observable, b);
+
+      observable.add_observer(c);
+
+      // The notification uses the list as it was when it started.
+      observable.notify_observers(0);
+      CHECK_EQUAL(1, c.count);
+      CHECK_EQUAL(0, b.count);
+      CHECK_EQUAL(size_t(2), observable.number_of_observers());
+
+      observable.notify_observers(0);
+      CHECK_EQUAL(2, c.count);
+      CHECK_EQUAL(1, b.count);
+      CHECK_EQUAL(0, a.count);
+      CHECK_EQUAL(size_t(3), observable.number_of_observers());
+    }
+
+#if REALTIME_TEST
+    //*************************************************************************
+    class CountingObserver : public etl::observer<int>
+    {
+    public:
+
+      CountingObserver()
+        : alive(true),
+          count(0)
+      {
+      }
+
+      void notification(int)
+      {
+        CHECK(alive.load());
+        ++count;
+      }
+
+      std::atomic<bool> alive;
+      std::atomic<int>  count;
+    };
+
+    //*************************************************************************
+    TEST(test_observable_atomic_threads)
+    {
+      typedef etl::observable_atomic<CountingObserver, 4> Observable;
+
+      Observable        observable;
+      CountingObserver  permanent;
+      std::atomic<bool> stop(false);
+
+      observable.add_observer(permanent);
+
+      auto notifier = [&]()
+      {
+        while (!stop.load())
+        {
+          observable.notify_observers(0);
+        }
+      };
+
+      std::thread t1(notifier);
+      std::thread t2(notifier);
+
+      while (permanent.count.load() == 0)
+      {
+        std::this_thread::yield();
+      }
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        CountingObserver temporary;
+        observable.add_observer(temporary);
+        observable.remove_observer(temporary);
+
+        // No notification can still be using it.
+        temporary.alive = false;
+      }
+
+      stop = true;
+
+      t1.join();
+      t2.join();
+
+      CHECK(permanent.count.load() > 0);
+      CHECK_EQUAL(size_t(1), observable.number_of_observers());
+    }
+#endif
+#endif
   }
 }
 
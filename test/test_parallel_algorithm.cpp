@@ -0,0 +1,273 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <string>
+
+#include "parallel_algorithm.h"
+
+namespace
+{
+  const size_t SIZE = 100003; // Not a multiple of the task count.
+
+  //***************************************************************************
+  std::vector<int> make_data(size_t size, uint32_t seed)
+  {
+    std::vector<int> result(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      result[i] = int(seed >> 12);
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  struct Twice
+  {
+    int operator()(int i) const
+    {
+      return i * 2;
+    }
+  };
+
+  struct IsEven
+  {
+    bool operator()(int i) const
+    {
+      return (i % 2) == 0;
+    }
+  };
+
+  struct Increment
+  {
+    void operator()(int& i) const
+    {
+      ++i;
+    }
+  };
+
+  //***************************************************************************
+  void check_for_each(etl::iworker_pool& pool)
+  {
+    std::vector<int> data = make_data(SIZE, 1);
+    std::vector<int> compare = data;
+
+    std::for_each(compare.begin(), compare.end(), Increment());
+    etl::parallel_for_each(pool, data.begin(), data.end(), Increment());
+
+    CHECK(compare == data);
+  }
+
+  //***************************************************************************
+  void check_transform(etl::iworker_pool& pool)
+  {
+    std::vector<int> data = make_data(SIZE, 2);
+    std::vector<int> output1(SIZE);
+    std::vector<int> output2(SIZE);
+
+    std::transform(data.begin(), data.end(), output1.begin(), Twice());
+    std::vector<int>::iterator end = etl::parallel_transform(pool, data.begin(), data.end(), output2.begin(), Twice());
+
+    CHECK(output1 == output2);
+    CHECK(end == output2.end());
+
+    std::transform(data.begin(), data.end(), output1.begin(), output1.begin(), std::minus<int>());
+    etl::parallel_transform(pool, data.begin(), data.end(), output2.begin(), output2.begin(), std::minus<int>());
+
+    CHECK(output1 == output2);
+  }
+
+  //***************************************************************************
+  void check_reduce(etl::iworker_pool& pool)
+  {
+    std::vector<int> data = make_data(SIZE, 3);
+
+    std::vector<int64_t> wide(data.begin(), data.end());
+
+    CHECK_EQUAL(std::accumulate(wide.begin(), wide.end(), int64_t(7)), etl::parallel_reduce(pool, wide.begin(), wide.end(), int64_t(7)));
+
+    // Not commutative, so checks that the chunks are combined in order.
+    std::vector<std::string> text;
+
+    for (size_t i = 0; i < 20000; ++i)
+    {
+      text.push_back(std::string(1, char('a' + (i % 26))));
+    }
+
+    CHECK(std::accumulate(text.begin(), text.end(), std::string(">")) == etl::parallel_reduce(pool, text.begin(), text.end(), std::string(">")));
+
+    // Empty.
+    CHECK_EQUAL(5, etl::parallel_reduce(pool, data.begin(), data.begin(), 5));
+  }
+
+  //***************************************************************************
+  void check_sort(etl::iworker_pool& pool)
+  {
+    const size_t sizes[] = { 0, 1, 100, 5000, 9000, SIZE };
+
+    for (size_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); ++s)
+    {
+      std::vector<int> compare = make_data(sizes[s], 4);
+      std::vector<int> data1   = compare;
+      std::vector<int> data2   = compare;
+      std::vector<int> scratch(sizes[s]);
+
+      std::sort(compare.begin(), compare.end());
+      etl::parallel_sort(pool, data1.begin(), data1.end());
+      etl::parallel_sort(pool, data2.begin(), data2.end(), scratch.begin(), scratch.end());
+
+      CHECK(compare == data1);
+      CHECK(compare == data2);
+    }
+
+    // With a compare.
+    std::vector<int> data = make_data(SIZE, 5);
+    std::vector<int> compare(data);
+    std::vector<int> scratch(SIZE);
+
+    std::sort(compare.begin(), compare.end(), std::greater<int>());
+    etl::parallel_sort(pool, data.begin(), data.end(), scratch.begin(), scratch.end(), std::greater<int>());
+
+    CHECK(compare == data);
+  }
+
+  //***************************************************************************
+  void check_partition(etl::iworker_pool& pool)
+  {
+    const size_t sizes[] = { 0, 1, 100, 9000, SIZE };
+
+    for (size_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); ++s)
+    {
+      std::vector<int> data    = make_data(sizes[s], 6);
+      std::vector<int> compare = data;
+
+      std::vector<int>::iterator split = etl::parallel_partition(pool, data.begin(), data.end(), IsEven());
+
+      CHECK(std::count_if(compare.begin(), compare.end(), IsEven()) == (split - data.begin()));
+      CHECK(std::all_of(data.begin(), split, IsEven()));
+      CHECK(std::none_of(split, data.end(), IsEven()));
+
+      std::sort(data.begin(), data.end());
+      std::sort(compare.begin(), compare.end());
+      CHECK(compare == data);
+    }
+
+    // All true, and all false.
+    std::vector<int> evens(SIZE, 2);
+    CHECK(etl::parallel_partition(pool, evens.begin(), evens.end(), IsEven()) == evens.end());
+
+    std::vector<int> odds(SIZE, 1);
+    CHECK(etl::parallel_partition(pool, odds.begin(), odds.end(), IsEven()) == odds.begin());
+  }
+
+  SUITE(test_parallel_algorithm)
+  {
+    //*************************************************************************
+    TEST(test_serial_pool)
+    {
+      etl::serial_worker_pool pool;
+
+      CHECK_EQUAL(1U, pool.size());
+
+      check_for_each(pool);
+      check_transform(pool);
+      check_reduce(pool);
+      check_sort(pool);
+      check_partition(pool);
+    }
+
+#if ETL_HAS_WORKER_POOL
+    //*************************************************************************
+    TEST(test_worker_pool)
+    {
+      etl::worker_pool<4> pool;
+
+      CHECK_EQUAL(4U, pool.size());
+
+      check_for_each(pool);
+      check_transform(pool);
+      check_reduce(pool);
+      check_sort(pool);
+      check_partition(pool);
+    }
+
+    //*************************************************************************
+    TEST(test_worker_pool_runs_every_task_once)
+    {
+      struct Task : public etl::ifunction<size_t>
+      {
+        Task()
+        {
+          for (size_t i = 0; i < 1000; ++i)
+          {
+            counts[i] = 0;
+          }
+        }
+
+        void operator ()(size_t index)
+        {
+          counts[index].fetch_add(1);
+        }
+
+        std::atomic<int> counts[1000];
+      };
+
+      etl::worker_pool<3> pool;
+
+      for (int repeat = 0; repeat < 100; ++repeat)
+      {
+        Task task;
+        pool.run(task, 1000);
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+          CHECK_EQUAL(1, task.counts[i].load());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_worker_pool_single_thread)
+    {
+      etl::worker_pool<1> pool;
+
+      check_transform(pool);
+      check_sort(pool);
+    }
+#endif
+  };
+}
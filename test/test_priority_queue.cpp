@@ -32,6 +32,8 @@ SOFTWARE.
 
 #include "priority_queue.h"
 
+#include "data.h"
+
 namespace
 {
   struct Item
@@ -64,6 +66,43 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  /// Pushes and pops a pseudo random sequence, comparing with std::priority_queue.
+  //***************************************************************************
+  template <typename TQueue, typename TCompare>
+  void check_against_std(TQueue& queue, TCompare)
+  {
+    std::priority_queue<int, std::vector<int>, TCompare> compare;
+    uint32_t seed = 12345;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+
+      if (!queue.full() && ((seed >> 30) != 0))
+      {
+        const int value = int((seed >> 8) % 1000);
+        queue.push(value);
+        compare.push(value);
+      }
+      else if (!queue.empty())
+      {
+        CHECK_EQUAL(compare.top(), queue.top());
+        queue.pop();
+        compare.pop();
+      }
+
+      CHECK_EQUAL(compare.size(), queue.size());
+    }
+
+    while (!queue.empty())
+    {
+      CHECK_EQUAL(compare.top(), queue.top());
+      queue.pop();
+      compare.pop();
+    }
+  }
+
   SUITE(test_priority_queue)
   {
     static const size_t SIZE = 4;
@@ -517,5 +556,128 @@ namespace
       CHECK_EQUAL(compare_priority_queue.size(), ipriority_queue.size());
       CHECK_EQUAL(compare_priority_queue.top(), ipriority_queue.top());
     }
+
+    //*************************************************************************
+    TEST(test_push_move_and_emplace)
+    {
+      typedef TestDataM<std::string> M;
+
+      etl::priority_queue<M, 4> priority_queue;
+
+      M m("2");
+      priority_queue.push(std::move(m));
+      priority_queue.emplace("3");
+      priority_queue.push(M("1"));
+
+      CHECK(!m.valid);
+      CHECK_EQUAL(3U, priority_queue.size());
+      CHECK_EQUAL(std::string("3"), priority_queue.top().value);
+
+      M out("0");
+      priority_queue.pop_into(out);
+
+      CHECK_EQUAL(std::string("3"), out.value);
+      CHECK_EQUAL(std::string("2"), priority_queue.top().value);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<std::string> M;
+
+      etl::priority_queue<M, 4> priority_queue1;
+      priority_queue1.emplace("1");
+      priority_queue1.emplace("3");
+      priority_queue1.emplace("2");
+
+      etl::priority_queue<M, 4> priority_queue2(std::move(priority_queue1));
+
+      CHECK(priority_queue1.empty());
+      CHECK_EQUAL(3U, priority_queue2.size());
+      CHECK_EQUAL(std::string("3"), priority_queue2.top().value);
+
+      etl::priority_queue<M, 4> priority_queue3;
+      priority_queue3.emplace("9");
+      priority_queue3 = std::move(priority_queue2);
+
+      CHECK(priority_queue2.empty());
+      CHECK_EQUAL(3U, priority_queue3.size());
+      priority_queue3.pop();
+      CHECK_EQUAL(std::string("2"), priority_queue3.top().value);
+    }
+
+    //*************************************************************************
+    TEST(test_d_ary_heaps)
+    {
+      etl::priority_queue<int, 100, etl::vector<int, 100>, std::less<int>, 2> priority_queue2;
+      etl::priority_queue<int, 100, etl::vector<int, 100>, std::less<int>, 3> priority_queue3;
+      etl::priority_queue<int, 100, etl::vector<int, 100>, std::less<int>, 4> priority_queue4;
+      etl::priority_queue<int, 100, etl::vector<int, 100>, std::greater<int>, 8> priority_queue8;
+
+      check_against_std(priority_queue2, std::less<int>());
+      check_against_std(priority_queue3, std::less<int>());
+      check_against_std(priority_queue4, std::less<int>());
+      check_against_std(priority_queue8, std::greater<int>());
+    }
+
+    //*************************************************************************
+    TEST(test_d_ary_heap_assign)
+    {
+      int data[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0, 11, 10, 12 };
+
+      etl::priority_queue<int, 20, etl::vector<int, 20>, std::less<int>, 4> priority_queue(std::begin(data), std::end(data));
+      etl::ipriority_queue<int, etl::vector<int, 20>, std::less<int>, 4>& ipriority_queue = priority_queue;
+
+      for (int expected = 12; expected >= 0; --expected)
+      {
+        CHECK_EQUAL(expected, ipriority_queue.top());
+        ipriority_queue.pop();
+      }
+
+      CHECK(ipriority_queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_d_ary_heap_move_and_emplace)
+    {
+      typedef TestDataM<std::string> M;
+      typedef etl::priority_queue<M, 10, etl::vector<M, 10>, std::less<M>, 4> Queue;
+
+      const char* data[] = { "5", "1", "9", "3", "7", "2", "8", "6", "4", "0" };
+
+      Queue priority_queue1;
+
+      for (size_t i = 0; i < 10; ++i)
+      {
+        if ((i % 2) == 0)
+        {
+          M m(data[i]);
+          priority_queue1.push(std::move(m));
+          CHECK(!m.valid);
+        }
+        else
+        {
+          priority_queue1.emplace(data[i]);
+        }
+      }
+
+      Queue priority_queue2(std::move(priority_queue1));
+      CHECK(priority_queue1.empty());
+
+      Queue priority_queue3;
+      priority_queue3.emplace("99");
+      priority_queue3 = std::move(priority_queue2);
+      CHECK(priority_queue2.empty());
+      CHECK_EQUAL(10U, priority_queue3.size());
+
+      for (char expected = '9'; expected >= '0'; --expected)
+      {
+        M out("");
+        priority_queue3.pop_into(out);
+        CHECK_EQUAL(std::string(1, expected), out.value);
+      }
+
+      CHECK(priority_queue3.empty());
+    }
   };
 }
@@ -32,6 +32,8 @@ SOFTWARE.
 
 #include "queue.h"
 
+#include "data.h"
+
 namespace
 {
   struct Item
@@ -564,5 +566,51 @@ namespace
       CHECK_EQUAL(4, queue.front());
       queue.pop();
     }
+
+    //*************************************************************************
+    TEST(test_push_move_and_emplace)
+    {
+      typedef TestDataM<std::string> M;
+
+      etl::queue<M, 4> queue;
+
+      M m("1");
+      queue.push(std::move(m));
+      queue.emplace("2");
+
+      CHECK(!m.valid);
+      CHECK_EQUAL(2U, queue.size());
+
+      M out("0");
+      queue.pop_into(out);
+
+      CHECK_EQUAL(std::string("1"), out.value);
+      CHECK_EQUAL(std::string("2"), queue.front().value);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      typedef TestDataM<std::string> M;
+
+      etl::queue<M, 4> queue1;
+      queue1.emplace("1");
+      queue1.emplace("2");
+
+      etl::queue<M, 4> queue2(std::move(queue1));
+
+      CHECK(queue1.empty());
+      CHECK_EQUAL(2U, queue2.size());
+      CHECK_EQUAL(std::string("1"), queue2.front().value);
+      CHECK_EQUAL(std::string("2"), queue2.back().value);
+
+      etl::queue<M, 4> queue3;
+      queue3.emplace("9");
+      queue3 = std::move(queue2);
+
+      CHECK(queue2.empty());
+      CHECK_EQUAL(2U, queue3.size());
+      CHECK_EQUAL(std::string("1"), queue3.front().value);
+    }
   };
 }
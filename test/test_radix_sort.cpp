@@ -0,0 +1,333 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <vector>
+#include <algorithm>
+#include <string.h>
+
+#include "radix_sort.h"
+#include "array.h"
+#include "vector.h"
+
+namespace
+{
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_data(size_t size, uint64_t seed)
+  {
+    std::vector<T> result;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      seed ^= seed << 13;
+      seed ^= seed >> 7;
+      seed ^= seed << 17;
+
+      result.push_back(T(seed));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void check_radix_sort(size_t size)
+  {
+    std::vector<T> data1 = make_data<T>(size, 0x123456789ABCDEF1);
+    std::vector<T> data2 = data1;
+    std::vector<T> scratch(size);
+
+    std::sort(data1.begin(), data1.end());
+    etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end());
+
+    CHECK(data1 == data2);
+  }
+
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t id;
+    int      order;
+  };
+
+  bool operator ==(const Record& lhs, const Record& rhs)
+  {
+    return (lhs.id == rhs.id) && (lhs.order == rhs.order);
+  }
+
+  struct RecordId
+  {
+    uint32_t operator()(const Record& record) const
+    {
+      return record.id;
+    }
+  };
+
+  struct RecordIdLess
+  {
+    bool operator()(const Record& lhs, const Record& rhs) const
+    {
+      return lhs.id < rhs.id;
+    }
+  };
+
+  //***************************************************************************
+  struct Name
+  {
+    char text[8];
+    int  order;
+  };
+
+  struct NameText
+  {
+    const char* operator()(const Name& name) const
+    {
+      return name.text;
+    }
+  };
+
+  struct NameLess
+  {
+    bool operator()(const Name& lhs, const Name& rhs) const
+    {
+      return memcmp(lhs.text, rhs.text, sizeof(lhs.text)) < 0;
+    }
+  };
+
+  SUITE(test_radix_sort)
+  {
+    //*************************************************************************
+    TEST(test_radix_sort_unsigned)
+    {
+      check_radix_sort<uint8_t>(1000);
+      check_radix_sort<uint16_t>(1000);
+      check_radix_sort<uint32_t>(1000);
+      check_radix_sort<uint64_t>(1000);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_signed)
+    {
+      check_radix_sort<int8_t>(1000);
+      check_radix_sort<int16_t>(1000);
+      check_radix_sort<int32_t>(1000);
+      check_radix_sort<int64_t>(1000);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_sizes)
+    {
+      check_radix_sort<uint32_t>(0);
+      check_radix_sort<uint32_t>(1);
+      check_radix_sort<uint32_t>(2);
+      check_radix_sort<uint32_t>(100000);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_skipped_passes)
+    {
+      // Only the low byte varies, so only one pass is made, and the result
+      // is left in the scratch buffer before being copied back.
+      std::vector<uint32_t> data1;
+
+      for (uint32_t i = 0; i < 500; ++i)
+      {
+        data1.push_back(0x12345600U + ((i * 37U) & 0xFFU));
+      }
+
+      std::vector<uint32_t> data2 = data1;
+      std::vector<uint32_t> scratch(data1.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end());
+
+      CHECK(data1 == data2);
+
+      // All equal.
+      std::vector<uint32_t> data3(100, 42U);
+      etl::radix_sort(data3.begin(), data3.end(), scratch.begin(), scratch.end());
+      CHECK(std::count(data3.begin(), data3.end(), 42U) == 100);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_etl_containers)
+    {
+      std::vector<int32_t> compare = make_data<int32_t>(256, 99);
+
+      etl::vector<int32_t, 256> data(compare.begin(), compare.end());
+      etl::ivector<int32_t>& idata = data;
+      etl::array<int32_t, 256> scratch;
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(idata.begin(), idata.end(), scratch.begin(), scratch.end());
+
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_key_is_stable)
+    {
+      std::vector<Record> data1;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        Record record = { uint32_t(make_data<uint32_t>(1, uint64_t(i) + 1U)[0] % 50U) << 20U, i };
+        data1.push_back(record);
+      }
+
+      std::vector<Record> data2 = data1;
+      std::vector<Record> scratch(data1.size());
+
+      std::stable_sort(data1.begin(), data1.end(), RecordIdLess());
+      etl::radix_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end(), RecordId());
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_by_key)
+    {
+      std::vector<uint32_t> keys = make_data<uint32_t>(1000, 7);
+      std::vector<int>      values;
+      std::vector<Record>   compare;
+
+      for (size_t i = 0; i < keys.size(); ++i)
+      {
+        keys[i] %= 100U;
+        values.push_back(int(i));
+
+        Record record = { keys[i], int(i) };
+        compare.push_back(record);
+      }
+
+      std::vector<uint32_t> key_scratch(keys.size());
+      std::vector<int>      value_scratch(values.size());
+
+      std::stable_sort(compare.begin(), compare.end(), RecordIdLess());
+      etl::radix_sort_by_key(keys.begin(), keys.end(), values.begin(), key_scratch.begin(), key_scratch.end(), value_scratch.begin());
+
+      for (size_t i = 0; i < keys.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i].id,    keys[i]);
+        CHECK_EQUAL(compare[i].order, values[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_msd_radix_sort)
+    {
+      std::vector<Name> data1;
+
+      std::vector<uint32_t> random = make_data<uint32_t>(2000, 3);
+
+      for (size_t i = 0; i < random.size(); ++i)
+      {
+        Name name;
+        memset(name.text, 0, sizeof(name.text));
+
+        // Short strings from a small alphabet, so that there are common
+        // prefixes and duplicates.
+        const size_t length = 1U + (random[i] % 7U);
+
+        for (size_t c = 0; c < length; ++c)
+        {
+          name.text[c] = char('a' + ((random[i] >> (c * 2U)) % 3U));
+        }
+
+        name.order = int(i);
+        data1.push_back(name);
+      }
+
+      std::vector<Name> data2 = data1;
+      std::vector<Name> scratch(data1.size());
+
+      std::stable_sort(data1.begin(), data1.end(), NameLess());
+      etl::msd_radix_sort<8>(data2.begin(), data2.end(), scratch.begin(), scratch.end(), NameText());
+
+      for (size_t i = 0; i < data1.size(); ++i)
+      {
+        CHECK(memcmp(data1[i].text, data2[i].text, sizeof(data1[i].text)) == 0);
+        CHECK_EQUAL(data1[i].order, data2[i].order);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_counting_sort)
+    {
+      std::vector<uint8_t> data1 = make_data<uint8_t>(1000, 11);
+
+      for (size_t i = 0; i < data1.size(); ++i)
+      {
+        data1[i] %= 20U;
+      }
+
+      std::vector<uint8_t> data2 = data1;
+      etl::array<size_t, 20> counts;
+
+      std::sort(data1.begin(), data1.end());
+      etl::counting_sort(data2.begin(), data2.end(), counts.begin(), counts.end());
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_counting_sort_key)
+    {
+      std::vector<Record> data1;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        Record record = { uint32_t(make_data<uint32_t>(1, uint64_t(i) + 5U)[0] % 16U), i };
+        data1.push_back(record);
+      }
+
+      std::vector<Record> data2 = data1;
+      std::vector<Record> scratch(data1.size());
+      etl::array<uint16_t, 16> counts;
+
+      std::stable_sort(data1.begin(), data1.end(), RecordIdLess());
+      etl::counting_sort(data2.begin(), data2.end(), scratch.begin(), scratch.end(), counts.begin(), counts.end(), RecordId());
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      std::vector<uint32_t> data(10, 1U);
+      std::vector<uint32_t> scratch(9);
+      etl::array<size_t, 1> counts;
+
+      CHECK_THROW(etl::radix_sort(data.begin(), data.end(), scratch.begin(), scratch.end()), etl::radix_sort_buffer_too_small);
+      CHECK_THROW(etl::counting_sort(data.begin(), data.end(), counts.begin(), counts.end()), etl::radix_sort_key_out_of_range);
+    }
+  };
+}
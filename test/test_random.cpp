@@ -35,6 +35,7 @@ SOFTWARE.
 #include <vector>
 #include <algorithm>
 #include <fstream>
+#include <random>
 
 namespace
 {
@@ -304,5 +305,323 @@ namespace
         CHECK(n <= high);
       }
     }
+
+    //=========================================================================
+    template <typename TEngine>
+    void check_fill_matches_sequence(uint64_t seed)
+    {
+      TEngine r1(seed);
+      TEngine r2(seed);
+
+      // Start part way through, to check any buffered values.
+      r1();
+      r2();
+
+      std::vector<typename TEngine::result_type> out1(1001);
+      std::vector<typename TEngine::result_type> out2(1001);
+
+      r1.fill(out1.begin(), out1.end());
+
+      for (size_t i = 0; i < out2.size(); ++i)
+      {
+        out2[i] = r2();
+      }
+
+      CHECK(out1 == out2);
+      CHECK(r1() == r2());
+    }
+
+    //=========================================================================
+    template <typename TEngine>
+    void check_range_is_uniform()
+    {
+      TEngine r(1234);
+
+      const uint32_t low     = 10;
+      const uint32_t high    = 15;
+      const int      samples = 60000;
+
+      int counts[6] = { 0 };
+
+      for (int i = 0; i < samples; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+
+        ++counts[n - low];
+      }
+
+      // Each count should be within 5% of the expected 10000.
+      for (int i = 0; i < 6; ++i)
+      {
+        CHECK(counts[i] > 9500);
+        CHECK(counts[i] < 10500);
+      }
+
+      CHECK_EQUAL(7U, r.range(7, 7));
+    }
+
+    //=========================================================================
+    TEST(test_random_xoshiro256ss)
+    {
+      etl::random_xoshiro256ss r1(1);
+      etl::random_xoshiro256ss r2(1);
+      etl::random_xoshiro256ss r3(2);
+
+      CHECK(r1() == r2());
+      CHECK(r1() != r3());
+
+      r1.initialise(1);
+      r2.initialise(1);
+      CHECK(r1() == r2());
+
+      check_fill_matches_sequence<etl::random_xoshiro256ss>(99);
+      check_range_is_uniform<etl::random_xoshiro256ss>();
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg32)
+    {
+      etl::random_pcg32 r1(1);
+      etl::random_pcg32 r2(1);
+      etl::random_pcg32 r3(2);
+
+      CHECK_EQUAL(r1(), r2());
+      CHECK(r1() != r3());
+
+      check_fill_matches_sequence<etl::random_pcg32>(99);
+      check_range_is_uniform<etl::random_pcg32>();
+    }
+
+    //=========================================================================
+    TEST(test_random_philox4x32)
+    {
+      // Known answer from the Random123 test vectors, for a zero key and counter.
+      etl::random_philox4x32 r(0);
+
+      CHECK_EQUAL(0x6627E8D5U, r());
+      CHECK_EQUAL(0xE169C58DU, r());
+      CHECK_EQUAL(0xBC57AC4CU, r());
+      CHECK_EQUAL(0x9B00DBD8U, r());
+
+      check_fill_matches_sequence<etl::random_philox4x32>(99);
+      check_range_is_uniform<etl::random_philox4x32>();
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg32_known_answer)
+    {
+      // From the reference implementation, pcg32_srandom_r(&rng, 42, 54).
+      etl::random_pcg32 r(42, 54);
+
+      CHECK_EQUAL(0xA15C02B7U, r());
+      CHECK_EQUAL(0x7B47F409U, r());
+      CHECK_EQUAL(0xBA1D3330U, r());
+      CHECK_EQUAL(0x83D2F293U, r());
+      CHECK_EQUAL(0xBFA4784BU, r());
+      CHECK_EQUAL(0xCBED606EU, r());
+    }
+
+    //=========================================================================
+    TEST(test_random_reproducible_sequences)
+    {
+      // These values must never change, or saved seeds would no longer
+      // reproduce earlier runs.
+      etl::random_xoshiro256ss xoshiro(12345);
+      CHECK(xoshiro() == 0xBE6A36374160D49B);
+      CHECK(xoshiro() == 0x214AAA0637A688C6);
+
+      xoshiro.initialise(12345);
+      xoshiro.jump();
+      CHECK(xoshiro() == 0x3ED575283F0594E6);
+
+      xoshiro.initialise(12345);
+      xoshiro.long_jump();
+      CHECK(xoshiro() == 0x92654155FB089136);
+
+      etl::random_philox4x32 philox(0, 1);
+      CHECK_EQUAL(0x844515E1U, philox());
+    }
+
+    //=========================================================================
+    TEST(test_random_xoshiro256ss_jump)
+    {
+      etl::random_xoshiro256ss base(7);
+      etl::random_xoshiro256ss jumped(base);
+      etl::random_xoshiro256ss long_jumped(base);
+
+      jumped.jump();
+      long_jumped.long_jump();
+
+      CHECK(base() != jumped());
+      CHECK(jumped() != long_jumped());
+
+      // Jumping is deterministic.
+      etl::random_xoshiro256ss jumped2(7);
+      jumped2.jump();
+      jumped2();
+      jumped2();
+      CHECK(jumped() == jumped2());
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg32_streams_and_discard)
+    {
+      etl::random_pcg32 r1(1, 1);
+      etl::random_pcg32 r2(1, 2);
+
+      CHECK(r1() != r2());
+
+      // Discarding matches calling.
+      const uint64_t counts[] = { 0, 1, 2, 17, 1000 };
+
+      for (size_t i = 0; i < (sizeof(counts) / sizeof(counts[0])); ++i)
+      {
+        etl::random_pcg32 called(5, 3);
+        etl::random_pcg32 skipped(5, 3);
+
+        for (uint64_t n = 0; n < counts[i]; ++n)
+        {
+          called();
+        }
+
+        skipped.discard(counts[i]);
+
+        CHECK_EQUAL(called(), skipped());
+      }
+
+      // Discards add up.
+      etl::random_pcg32 once(9);
+      etl::random_pcg32 twice(9);
+
+      once.discard(0x10000000000 + 12345);
+      twice.discard(0x10000000000);
+      twice.discard(12345);
+
+      CHECK_EQUAL(once(), twice());
+    }
+
+    //=========================================================================
+    TEST(test_random_philox4x32_streams_and_discard)
+    {
+      etl::random_philox4x32 r1(1, 0);
+      etl::random_philox4x32 r2(1, 1);
+
+      CHECK(r1() != r2());
+
+      // Reseeding keeps the stream.
+      r2.initialise(1);
+      etl::random_philox4x32 r3(1, 1);
+      CHECK_EQUAL(r3(), r2());
+
+      // Discarding matches calling, from any position in a block.
+      for (uint64_t start = 0; start < 4; ++start)
+      {
+        for (uint64_t count = 0; count < 11; ++count)
+        {
+          etl::random_philox4x32 called(5, 3);
+          etl::random_philox4x32 skipped(5, 3);
+
+          for (uint64_t n = 0; n < start; ++n)
+          {
+            called();
+            skipped();
+          }
+
+          for (uint64_t n = 0; n < count; ++n)
+          {
+            called();
+          }
+
+          skipped.discard(count);
+
+          CHECK_EQUAL(called(), skipped());
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(test_random_parallel_workers_are_reproducible)
+    {
+      // Each worker has its own subsequence, so the values each worker sees do
+      // not depend on how the workers are interleaved.
+      const size_t WORKERS = 4;
+      const size_t VALUES  = 100;
+
+      std::vector<uint64_t> in_turn[WORKERS];
+      std::vector<uint64_t> interleaved[WORKERS];
+
+      etl::random_xoshiro256ss xoshiro[WORKERS];
+      etl::random_philox4x32   philox[WORKERS];
+
+      xoshiro[0].initialise(2018);
+
+      for (size_t w = 0; w < WORKERS; ++w)
+      {
+        if (w != 0)
+        {
+          xoshiro[w] = xoshiro[w - 1];
+          xoshiro[w].jump();
+        }
+
+        philox[w].initialise(2018, w);
+
+        etl::random_xoshiro256ss x(xoshiro[w]);
+        etl::random_philox4x32   p(philox[w]);
+
+        for (size_t i = 0; i < VALUES; ++i)
+        {
+          in_turn[w].push_back(x() ^ p());
+        }
+      }
+
+      for (size_t i = 0; i < VALUES; ++i)
+      {
+        for (size_t w = 0; w < WORKERS; ++w)
+        {
+          interleaved[w].push_back(xoshiro[w]() ^ philox[w]());
+        }
+      }
+
+      for (size_t w = 0; w < WORKERS; ++w)
+      {
+        CHECK(in_turn[w] == interleaved[w]);
+
+        for (size_t other = w + 1; other < WORKERS; ++other)
+        {
+          CHECK(in_turn[w] != in_turn[other]);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(test_random_engines_with_std_distributions)
+    {
+      etl::random_pcg32 r(5);
+      std::uniform_int_distribution<int> distribution(1, 6);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        int n = distribution(r);
+
+        CHECK(n >= 1);
+        CHECK(n <= 6);
+      }
+
+      std::vector<int> values(100);
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = int(i);
+      }
+
+      std::shuffle(values.begin(), values.end(), r);
+      std::sort(values.begin(), values.end());
+
+      CHECK_EQUAL(0,  values.front());
+      CHECK_EQUAL(99, values.back());
+    }
   };
 }
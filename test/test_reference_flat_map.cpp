@@ -527,6 +527,54 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      ElementNDC existing[] = { ElementNDC(1, N1), ElementNDC(5, N5), ElementNDC(8, N8) };
+      ElementNDC extra[]    = { ElementNDC(9, N9), ElementNDC(3, N3), ElementNDC(5, N15),
+                                ElementNDC(0, N0), ElementNDC(3, N3), ElementNDC(7, N7) };
+
+      data.insert(std::begin(existing), std::end(existing));
+      compare_data.insert(std::begin(existing), std::end(existing));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+
+      // The existing element is kept.
+      CHECK(&data.find(5)->second == &existing[1].second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data;
+
+      data.assign_sorted(initial_data.begin(), initial_data.end());
+
+      bool isEqual = Check_Equal(data.begin(),
+                                 data.end(),
+                                 compare_data.begin());
+
+      CHECK(isEqual);
+
+      for (size_t i = 0; i < initial_data.size(); ++i)
+      {
+        CHECK(&*data.find(initial_data[i].first) == &initial_data[i]);
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -785,5 +833,70 @@ namespace
 
       CHECK(initial1 != different);
     }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_search_sorted_and_frozen)
+    {
+      std::vector<ElementDC> elements;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        elements.push_back(ElementDC(i * 2, M0));
+      }
+
+      for (size_t n = 0; n <= SIZE; ++n)
+      {
+        Compare_DataDC compare_data(elements.begin(), elements.begin() + n);
+        DataDC data(elements.begin(), elements.begin() + n);
+
+        for (int pass = 0; pass < 2; ++pass)
+        {
+          for (int key = -1; key <= int(n * 2); ++key)
+          {
+            CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+            CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+            CHECK_EQUAL(compare_data.count(key), data.count(key));
+
+            if (compare_data.find(key) == compare_data.end())
+            {
+              CHECK(data.find(key) == data.end());
+            }
+            else
+            {
+              CHECK_EQUAL(key, data.find(key)->first);
+            }
+          }
+
+          data.freeze();
+          CHECK(data.frozen());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_frozen_modify_thaws)
+    {
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      data.freeze();
+      CHECK(data.frozen());
+
+      data.insert(initial_data[7]);
+      CHECK(!data.frozen());
+      CHECK_EQUAL(N7, data.find(7)->second);
+      CHECK_EQUAL(N4, data.find(4)->second);
+
+      data.freeze();
+      data.erase(2);
+      CHECK(!data.frozen());
+      CHECK(data.find(2) == data.end());
+      CHECK_EQUAL(N3, data.find(3)->second);
+      CHECK_EQUAL(size_t(5), data.size());
+
+      data.freeze();
+      data.clear();
+      CHECK(!data.frozen());
+      CHECK(data.find(3) == data.end());
+    }
   };
 }
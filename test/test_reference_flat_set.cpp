@@ -341,6 +341,44 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_unsorted_with_duplicates)
+    {
+      etl::reference_flat_set<int, SIZE> data;
+
+      int existing[] = { 1, 5, 8 };
+      int extra[]    = { 9, 3, 5, 0, 3, 7 };
+      const int expected[] = { 0, 1, 3, 5, 7, 8, 9 };
+
+      data.insert(std::begin(existing), std::end(existing));
+      data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(7U, data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), std::begin(expected));
+
+      CHECK(isEqual);
+
+      // The existing element is kept.
+      CHECK(&*data.find(5) == &existing[1]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_sorted)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.begin() + 5);
+      DataNDC data(initial_data.begin(), initial_data.begin() + 5);
+
+      data.insert_sorted(initial_data.begin() + 3, initial_data.end());
+      compare_data.insert(initial_data.begin() + 3, initial_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = std::equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
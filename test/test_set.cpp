@@ -944,5 +944,49 @@ namespace
 #endif
     }
 
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      Data data;
+
+      // Scatter the nodes.
+      for (int i = 0; i < int(MAX_SIZE); ++i)
+      {
+        data.insert(i * 2);
+      }
+
+      for (int i = 0; i < int(MAX_SIZE); i += 2)
+      {
+        data.erase(i * 2);
+      }
+
+      for (int i = int(MAX_SIZE) - 1; i >= 0; i -= 2)
+      {
+        data.insert((i * 2) + 1);
+      }
+
+      Compare_Data compare_data(data.begin(), data.end());
+
+      data.compact();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+      const int* previous = nullptr;
+
+      for (Data::const_iterator i_data = data.begin(); i_data != data.end(); ++i_data)
+      {
+        CHECK(&*i_data > previous);
+        previous = &*i_data;
+        CHECK(data.find(*i_data) == i_data);
+      }
+
+      // The free list is rebuilt.
+      data.erase(3);
+      data.insert(100);
+
+      CHECK_EQUAL(MAX_SIZE, data.size());
+      CHECK(data.find(100) != data.end());
+    }
   };
 }
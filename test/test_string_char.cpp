@@ -2138,6 +2138,57 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_haystack)
+    {
+      std::string compare_haystack;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        compare_haystack += STR("abcabd abcabe ");
+      }
+
+      compare_haystack += STR("abcabcabf needle in a haystack");
+
+      etl::string<400> haystack(compare_haystack.c_str());
+
+      const value_t* needles[] = { STR("abcabf"), STR("abcabcabf needle"), STR("haystack"), STR("abcabd abcabe abcabd"), STR("abcabg"), STR("abd ") };
+
+      for (size_t i = 0; i < (sizeof(needles) / sizeof(needles[0])); ++i)
+      {
+        for (size_t position = 0; position < compare_haystack.size(); position += 7)
+        {
+          CHECK_EQUAL(compare_haystack.find(needles[i], position), haystack.find(needles[i], position));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_character_set_long_text)
+    {
+      std::string compare_text;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        compare_text += STR("GET /index.html HTTP/1.1\r\nHost: example.com\r\n");
+      }
+
+      etl::string<500> text(compare_text.c_str());
+
+      const value_t* sets[] = { STR("\r\n"), STR(" :/"), STR("abcdefghijklmnopqrstuvwxyz"), STR("\x80\xFF"), STR("") };
+
+      for (size_t i = 0; i < (sizeof(sets) / sizeof(sets[0])); ++i)
+      {
+        for (size_t position = 0; position < compare_text.size(); position += 5)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(sets[i], position),     text.find_first_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_first_not_of(sets[i], position), text.find_first_not_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_of(sets[i], position),      text.find_last_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_not_of(sets[i], position),  text.find_last_not_of(sets[i], position));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_rfind_string)
     {
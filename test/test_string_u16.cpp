@@ -2137,6 +2137,34 @@ namespace
       CHECK_EQUAL(etl::iu16string::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_character_set_wide_characters)
+    {
+      Compare_Text compare_text;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        compare_text += STR("ab\u0141cd\u0241ef\u0341 ");
+      }
+
+      etl::u16string<200> text(compare_text.c_str());
+
+      // \u0141 and \u0241 share their low byte with \u0041 'A'.
+      const value_t* sets[] = { STR("\u0241"), STR("A\u0341"), STR("\u0141\u0241 "), STR("abcdef"), STR("Az") };
+
+      for (size_t i = 0; i < (sizeof(sets) / sizeof(sets[0])); ++i)
+      {
+        for (size_t position = 0; position < compare_text.size(); position += 3)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(sets[i], position),     text.find_first_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_first_not_of(sets[i], position), text.find_first_not_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_of(sets[i], position),      text.find_last_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find_last_not_of(sets[i], position),  text.find_last_not_of(sets[i], position));
+          CHECK_EQUAL(compare_text.find(sets[i], position),              text.find(sets[i], position));
+        }
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_rfind_string)
     {
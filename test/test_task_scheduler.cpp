@@ -259,5 +259,31 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //=========================================================================
+    TEST(test_scheduler_delegate_callbacks)
+    {
+      SchedulerSequencialSingle s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+      common.watchdog_called = false;
+
+      s.set_idle_callback(etl::delegate<void()>::create<Common, &Common::IdleCallback>(common));
+      s.set_watchdog_callback(etl::delegate<void()>([]() { common.WatchdogCallback(); }));
+      s.add_task_list(taskList, etl::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      WorkList_t expected = { "T3W1", "T2W1", "T1W1", "T3W2", "T2W2", "T1W2", "T3W3", "T2W3", "T1W3", "T2W4" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
   };
 }
@@ -0,0 +1,205 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2018 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+#include "UnitTest++.h"
+
+#include <string>
+#include <limits>
+#include <stdlib.h>
+#include <string.h>
+
+#include "to_string.h"
+#include "cstring.h"
+#include "u16string.h"
+
+namespace
+{
+  typedef etl::string<64> Text;
+
+  SUITE(test_to_string)
+  {
+    //*************************************************************************
+    TEST(test_integers)
+    {
+      Text text;
+
+      CHECK_EQUAL(std::string("0"),     std::string(etl::to_string(0, text).c_str()));
+      CHECK_EQUAL(std::string("7"),     std::string(etl::to_string(7, text).c_str()));
+      CHECK_EQUAL(std::string("42"),    std::string(etl::to_string(42, text).c_str()));
+      CHECK_EQUAL(std::string("-42"),   std::string(etl::to_string(-42, text).c_str()));
+      CHECK_EQUAL(std::string("12345"), std::string(etl::to_string(12345U, text).c_str()));
+      CHECK_EQUAL(std::string("-128"),  std::string(etl::to_string(int8_t(-128), text).c_str()));
+      CHECK_EQUAL(std::string("255"),   std::string(etl::to_string(uint8_t(255), text).c_str()));
+
+      CHECK_EQUAL(std::string("-2147483648"),          std::string(etl::to_string(std::numeric_limits<int32_t>::min(), text).c_str()));
+      CHECK_EQUAL(std::string("4294967295"),           std::string(etl::to_string(std::numeric_limits<uint32_t>::max(), text).c_str()));
+      CHECK_EQUAL(std::string("-9223372036854775808"), std::string(etl::to_string(std::numeric_limits<int64_t>::min(), text).c_str()));
+      CHECK_EQUAL(std::string("18446744073709551615"), std::string(etl::to_string(std::numeric_limits<uint64_t>::max(), text).c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_integers_match_std)
+    {
+      Text text;
+
+      int64_t value = 1;
+
+      for (int i = 0; i < 62; ++i)
+      {
+        CHECK_EQUAL(std::to_string(value),     std::string(etl::to_string(value, text).c_str()));
+        CHECK_EQUAL(std::to_string(value - 1), std::string(etl::to_string(value - 1, text).c_str()));
+        CHECK_EQUAL(std::to_string(-value),    std::string(etl::to_string(-value, text).c_str()));
+        value = (value * 2) + 1;
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_integers_in_other_bases)
+    {
+      Text text;
+
+      CHECK_EQUAL(std::string("ff"),       std::string(etl::to_string(255, text, 16U).c_str()));
+      CHECK_EQUAL(std::string("-ff"),      std::string(etl::to_string(-255, text, 16U).c_str()));
+      CHECK_EQUAL(std::string("11111111"), std::string(etl::to_string(255, text, 2U).c_str()));
+      CHECK_EQUAL(std::string("377"),      std::string(etl::to_string(255, text, 8U).c_str()));
+      CHECK_EQUAL(std::string("z"),        std::string(etl::to_string(35, text, 36U).c_str()));
+      CHECK_EQUAL(std::string("100"),      std::string(etl::to_string(9, text, 3U).c_str()));
+
+      CHECK_EQUAL(std::string("1000000000000000000000000000000000000000000000000000000000000000"),
+                  std::string(etl::to_string(uint64_t(1) << 63, text, 2U).c_str()));
+
+      CHECK_THROW(etl::to_string(1, text, 1U), etl::to_string_invalid_base);
+      CHECK_THROW(etl::to_string(1, text, 37U), etl::to_string_invalid_base);
+    }
+
+    //*************************************************************************
+    TEST(test_append)
+    {
+      Text text("x=");
+
+      etl::append_integer(text, 10);
+      text.append(", y=");
+      etl::append_float(text, 2.5);
+      text.append(", z=0x");
+      etl::append_integer(text, 0xBEEFU, 16U);
+
+      CHECK_EQUAL(std::string("x=10, y=2.5, z=0xbeef"), std::string(text.c_str()));
+      CHECK(!text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<6> text("abc");
+
+      etl::append_integer(text, 12345);
+
+      CHECK_EQUAL(std::string("abc123"), std::string(text.c_str()));
+      CHECK(text.truncated());
+
+      etl::to_string(99, text);
+      CHECK_EQUAL(std::string("99"), std::string(text.c_str()));
+      CHECK(!text.truncated());
+
+      etl::append_float(text, 3.14159);
+      CHECK_EQUAL(std::string("993.14"), std::string(text.c_str()));
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_floats)
+    {
+      Text text;
+
+      CHECK_EQUAL(std::string("0"),                       std::string(etl::to_string(0.0, text).c_str()));
+      CHECK_EQUAL(std::string("-0"),                      std::string(etl::to_string(-0.0, text).c_str()));
+      CHECK_EQUAL(std::string("1"),                       std::string(etl::to_string(1.0, text).c_str()));
+      CHECK_EQUAL(std::string("0.1"),                     std::string(etl::to_string(0.1, text).c_str()));
+      CHECK_EQUAL(std::string("-123.456"),                std::string(etl::to_string(-123.456, text).c_str()));
+      CHECK_EQUAL(std::string("0.3"),                     std::string(etl::to_string(0.3, text).c_str()));
+      CHECK_EQUAL(std::string("0.30000000000000004"),     std::string(etl::to_string(0.1 + 0.2, text).c_str()));
+      CHECK_EQUAL(std::string("0.000001"),                std::string(etl::to_string(1e-6, text).c_str()));
+      CHECK_EQUAL(std::string("1.5e-7"),                  std::string(etl::to_string(1.5e-7, text).c_str()));
+      CHECK_EQUAL(std::string("100000000000000000000"),   std::string(etl::to_string(1e20, text).c_str()));
+      CHECK_EQUAL(std::string("1e+21"),                   std::string(etl::to_string(1e21, text).c_str()));
+      CHECK_EQUAL(std::string("5e-324"),                  std::string(etl::to_string(5e-324, text).c_str()));
+      CHECK_EQUAL(std::string("1.7976931348623157e+308"), std::string(etl::to_string(std::numeric_limits<double>::max(), text).c_str()));
+
+      CHECK_EQUAL(std::string("inf"),  std::string(etl::to_string(std::numeric_limits<double>::infinity(), text).c_str()));
+      CHECK_EQUAL(std::string("-inf"), std::string(etl::to_string(-std::numeric_limits<double>::infinity(), text).c_str()));
+      CHECK_EQUAL(std::string("nan"),  std::string(etl::to_string(std::numeric_limits<double>::quiet_NaN(), text).c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_float_uses_float_precision)
+    {
+      Text text;
+
+      CHECK_EQUAL(std::string("0.1"),           std::string(etl::to_string(0.1f, text).c_str()));
+      CHECK_EQUAL(std::string("3.4028235e+38"), std::string(etl::to_string(std::numeric_limits<float>::max(), text).c_str()));
+      CHECK_EQUAL(std::string("1e-45"),         std::string(etl::to_string(std::numeric_limits<float>::denorm_min(), text).c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_floats_round_trip)
+    {
+      Text text;
+
+      uint64_t seed = 0x123456789ABCDEF1;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+
+        double value;
+        memcpy(&value, &seed, sizeof(value));
+
+        if (value != value)
+        {
+          continue;
+        }
+
+        etl::to_string(value, text);
+
+        CHECK_EQUAL(value, strtod(text.c_str(), 0));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wide_strings)
+    {
+      etl::u16string<32> text;
+
+      etl::to_string(-1234, text);
+      etl::append_float(text, 0.5);
+
+      CHECK(text == etl::u16string<32>(u"-12340.5"));
+    }
+  };
+}
@@ -84,6 +84,9 @@ namespace
     typedef etl::unordered_map<std::string, NDC, SIZE, SIZE / 2, simple_hash> DataNDC;
     typedef etl::iunordered_map<std::string, NDC, simple_hash> IDataNDC;
 
+    typedef TestDataM<std::string> M;
+    typedef etl::unordered_map<std::string, M, SIZE, SIZE / 2, simple_hash> DataM;
+
     NDC N0 = NDC("A");
     NDC N1 = NDC("B");
     NDC N2 = NDC("C");
@@ -689,5 +692,116 @@ namespace
     {
 
     }
+
+    //*************************************************************************
+    TEST(test_insert_move_and_emplace)
+    {
+      DataM data;
+
+      M m("1");
+      data.insert(DataM::value_type("ab", std::move(m)));
+      data.insert(data.cbegin(), DataM::value_type("c", M("2")));
+
+      // "ba" hashes to the same bucket as "ab".
+      std::pair<DataM::iterator, bool> result = data.emplace("ba", "3");
+
+      CHECK(!m.valid);
+      CHECK(result.second);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("1"), data.at("ab").value);
+      CHECK_EQUAL(std::string("2"), data.at("c").value);
+      CHECK_EQUAL(std::string("3"), data.at("ba").value);
+
+      result = data.emplace("ab", "4");
+      CHECK(!result.second);
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("1"), data.at("ab").value);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+      data1.emplace("ab", "1");
+      data1.emplace("ba", "2");
+      data1.emplace("c",  "3");
+
+      DataM data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(3U, data2.size());
+      CHECK_EQUAL(std::string("2"), data2.at("ba").value);
+
+      DataM data3;
+      data3.emplace("z", "9");
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(3U, data3.size());
+      CHECK(data3.find("z") == data3.end());
+      CHECK(data3.at("c").valid);
+      CHECK_EQUAL(std::string("1"), data3.at("ab").value);
+    }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      DataM data;
+
+      // Scatter the nodes.
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        data.emplace(std::to_string(i), std::to_string(i));
+      }
+
+      for (size_t i = 0; i < SIZE; i += 2)
+      {
+        data.erase(std::to_string(i));
+      }
+
+      for (size_t i = SIZE; i < (SIZE + (SIZE / 2)); ++i)
+      {
+        data.emplace(std::to_string(i), std::to_string(i));
+      }
+
+      std::vector<std::string> keys;
+
+      for (DataM::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      int current_count = M::get_instance_count();
+
+      data.compact();
+
+      CHECK_EQUAL(current_count, M::get_instance_count());
+      CHECK_EQUAL(keys.size(), data.size());
+
+      // Same iteration order, in address order.
+      std::vector<std::string>::const_iterator i_key = keys.begin();
+      const std::string* previous = nullptr;
+
+      for (DataM::const_iterator itr = data.begin(); itr != data.end(); ++itr, ++i_key)
+      {
+        CHECK_EQUAL(*i_key, itr->first);
+        CHECK_EQUAL(*i_key, itr->second.value);
+        CHECK(itr->second.valid);
+        CHECK(&itr->first > previous);
+        previous = &itr->first;
+      }
+
+      for (i_key = keys.begin(); i_key != keys.end(); ++i_key)
+      {
+        CHECK(data.find(*i_key) != data.end());
+      }
+
+      // The free list is rebuilt.
+      data.erase("1");
+      data.emplace("X", "X");
+
+      CHECK(data.full());
+      CHECK_EQUAL(std::string("X"), data.at("X").value);
+    }
   };
 }
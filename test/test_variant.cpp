@@ -35,6 +35,7 @@ SOFTWARE.
 #include <vector>
 #include <algorithm>
 #include <string>
+#include <memory>
 
 namespace
 {
@@ -202,6 +203,35 @@ namespace
 
   typedef etl::variant<D1, D2, D3, D4> test_variant_emplace;
 
+  //*************************************************************************
+  // Visitor that returns the size of the stored type.
+  //*************************************************************************
+  struct size_visitor
+  {
+    template <typename T>
+    size_t operator ()(const T&) const
+    {
+      return sizeof(T);
+    }
+  };
+
+  //*************************************************************************
+  // Visitor that doubles the stored value.
+  //*************************************************************************
+  struct double_visitor
+  {
+    double_visitor()
+      : count(0)
+    {
+    }
+
+    void operator ()(char& c)        { c = char(c * 2); ++count; }
+    void operator ()(int& i)         { i *= 2; ++count; }
+    void operator ()(std::string& s) { s += s; ++count; }
+
+    int count;
+  };
+
   SUITE(test_variant)
   {
     TEST(test_alignment)
@@ -791,5 +821,112 @@ namespace
       CHECK(variant.is_type<D4>());
       CHECK_EQUAL(D4("1", "2", "3", "4"), variant.get<D4>());
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    TEST(test_visit)
+    {
+      test_variant_3a variant;
+      double_visitor visitor;
+
+      variant = char(16);
+      variant.visit(visitor);
+      CHECK_EQUAL(char(32), variant.get<char>());
+
+      variant = 21;
+      variant.visit(visitor);
+      CHECK_EQUAL(42, variant.get<int>());
+
+      variant = std::string("ab");
+      etl::visit(visitor, variant);
+      CHECK_EQUAL(std::string("abab"), variant.get<std::string>());
+
+      CHECK_EQUAL(3, visitor.count);
+    }
+
+    //*************************************************************************
+    TEST(test_visit_return_value)
+    {
+      test_variant_3b variant;
+
+      variant = short(1);
+      CHECK_EQUAL(sizeof(short), variant.visit(size_visitor()));
+
+      variant = 1.0;
+      CHECK_EQUAL(sizeof(double), variant.visit(size_visitor()));
+
+      const test_variant_3b cvariant(1);
+      CHECK_EQUAL(sizeof(int), etl::visit(size_visitor(), cvariant));
+    }
+
+    //*************************************************************************
+    TEST(test_visit_lambda)
+    {
+      test_variant_3b variant(2.5);
+
+      double result = variant.visit([](double d) { return d * 2.0; });
+
+      CHECK_CLOSE(5.0, result, 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_visit_not_valid)
+    {
+      test_variant_3b variant;
+
+      CHECK_THROW(variant.visit(size_visitor()), etl::variant_invalid_exception);
+    }
+
+    //*************************************************************************
+    TEST(test_more_than_eight_types)
+    {
+      typedef etl::variant<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double, std::string> variant_t;
+
+      variant_t variant(std::string("Text"));
+      CHECK_EQUAL(10U, variant.index());
+      CHECK_EQUAL(std::string("Text"), variant.get<std::string>());
+
+      variant = 1.5f;
+      CHECK_EQUAL(8U, variant.index());
+      CHECK_EQUAL(sizeof(float), variant.visit(size_visitor()));
+    }
+
+    //*************************************************************************
+    TEST(test_trivially_copyable)
+    {
+      typedef etl::variant<char, int, double> trivial_t;
+
+#if ETL_CPP11_TYPE_TRAITS_IS_TRIVIAL_SUPPORTED
+      CHECK(std::is_trivially_copyable<trivial_t>::value);
+      CHECK(!std::is_trivially_copyable<test_variant_3a>::value);
+#endif
+
+      CHECK_EQUAL(2 * sizeof(double), sizeof(trivial_t));
+
+      trivial_t variant1(1.5);
+      trivial_t variant2(variant1);
+      CHECK_CLOSE(1.5, variant2.get<double>(), 0.001);
+
+      variant2 = 3;
+      variant1 = variant2;
+      CHECK_EQUAL(3, variant1.get<int>());
+    }
+
+    //*************************************************************************
+    TEST(test_move_only_type)
+    {
+      typedef etl::variant<int, std::unique_ptr<int>> variant_t;
+
+      variant_t variant1(std::unique_ptr<int>(new int(5)));
+      variant_t variant2(std::move(variant1));
+
+      CHECK_EQUAL(5, *variant2.get<std::unique_ptr<int>>());
+      CHECK(!variant1.get<std::unique_ptr<int>>());
+
+      variant1.emplace<std::unique_ptr<int>>(new int(6));
+      variant2 = std::move(variant1);
+      CHECK_EQUAL(6, *variant2.get<std::unique_ptr<int>>());
+    }
+#endif
   };
 }
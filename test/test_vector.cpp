@@ -1033,5 +1033,23 @@ namespace
 
       CHECK(!is_equal);
     }
+
+    //*************************************************************************
+    TEST(test_insert_own_element)
+    {
+      etl::vector<int, 8> data;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data.push_back(i * 10);
+      }
+
+      data.insert(data.begin(), data[2]);
+
+      const int expected[] = { 20, 0, 10, 20, 30, 40 };
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), expected));
+    }
   };
 }
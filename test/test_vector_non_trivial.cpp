@@ -54,6 +54,22 @@ namespace
     typedef etl::ivector<DC>      IDataDC;
     typedef std::vector<DC>       CompareDataDC;
 
+    typedef TestDataM<std::string> M;
+    typedef etl::vector<M, SIZE>   DataM;
+    typedef etl::ivector<M>        IDataM;
+
+    //*************************************************************************
+    struct Five
+    {
+      Five(int a_, int b_, int c_, int d_, const std::string& e_)
+        : a(a_), b(b_), c(c_), d(d_), e(e_)
+      {
+      }
+
+      int a, b, c, d;
+      std::string e;
+    };
+
     CompareDataNDC initial_data;
     CompareDataNDC less_data;
     CompareDataNDC greater_data;
@@ -1037,5 +1053,161 @@ namespace
       const DataNDC initial2(initial_data.begin(), initial_data.end());
       CHECK((initial >= initial2) == (initial_data >= initial_data));
     }
+
+    //*************************************************************************
+    TEST(test_push_back_move)
+    {
+      DataM data;
+
+      M m("0");
+      data.push_back(std::move(m));
+      data.push_back(M("1"));
+
+      CHECK(!m.valid);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("0"), data[0].value);
+      CHECK_EQUAL(std::string("1"), data[1].value);
+      CHECK(data[0].valid && data[1].valid);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_back_variadic)
+    {
+      etl::vector<Five, SIZE> data;
+
+      data.emplace_back(1, 2, 3, 4, "5");
+      data.emplace(data.begin(), 6, 7, 8, 9, "10");
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(6, data[0].a);
+      CHECK_EQUAL(std::string("10"), data[0].e);
+      CHECK_EQUAL(1, data[1].a);
+      CHECK_EQUAL(std::string("5"), data[1].e);
+
+      DataM datam;
+      datam.emplace_back(std::string("0"));
+      datam.emplace(datam.begin(), std::string("1"));
+
+      CHECK_EQUAL(std::string("1"), datam[0].value);
+      CHECK_EQUAL(std::string("0"), datam[1].value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_move)
+    {
+      DataM data;
+
+      data.push_back(M("0"));
+      data.push_back(M("2"));
+      data.push_back(M("4"));
+
+      data.insert(data.begin() + 1, M("1"));
+      data.insert(data.begin() + 3, M("3"));
+      data.insert(data.end(), M("5"));
+
+      CHECK_EQUAL(6U, data.size());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(std::to_string(i), data[i].value);
+        CHECK(data[i].valid);
+      }
+
+      data.erase(data.begin() + 1);
+      data.erase(data.begin() + 2, data.begin() + 4);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(std::string("0"), data[0].value);
+      CHECK_EQUAL(std::string("2"), data[1].value);
+      CHECK_EQUAL(std::string("5"), data[2].value);
+      CHECK(data[0].valid && data[1].valid && data[2].valid);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor_and_assignment)
+    {
+      DataM data1;
+      data1.push_back(M("0"));
+      data1.push_back(M("1"));
+
+      DataM data2(std::move(data1));
+
+      CHECK(data1.empty());
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(std::string("1"), data2[1].value);
+
+      DataM data3;
+      data3.push_back(M("9"));
+      data3 = std::move(data2);
+
+      CHECK(data2.empty());
+      CHECK_EQUAL(2U, data3.size());
+      CHECK_EQUAL(std::string("0"), data3[0].value);
+
+      etl::vector<M, SIZE * 2> data4;
+      IDataM& idata4 = data4;
+      idata4 = std::move(data3);
+
+      CHECK(data3.empty());
+      CHECK_EQUAL(2U, data4.size());
+      CHECK(data4[0].valid && data4[1].valid);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_n_overlapping)
+    {
+      CompareDataDC compare_data;
+      DataDC data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        compare_data.push_back(DC(std::to_string(i)));
+        data.push_back(DC(std::to_string(i)));
+      }
+
+      compare_data.insert(compare_data.begin() + 1, 2, DC("x"));
+      data.insert(data.begin() + 1, 2, DC("x"));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_zero_elements)
+    {
+      const std::string empty[] = { "" };
+
+      etl::vector<std::string, 4> data;
+      data.push_back("a");
+      data.push_back("b");
+
+      data.insert(data.begin(), empty, empty);
+      data.insert(data.begin() + 1, 0, std::string("x"));
+      data.insert(data.end(), 0, std::string("x"));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("a"), data[0]);
+      CHECK_EQUAL(std::string("b"), data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_own_element)
+    {
+      etl::vector<std::string, 8> data;
+      data.push_back("0");
+      data.push_back("1");
+      data.push_back("2");
+
+      data.insert(data.begin(), data[2]);
+      data.insert(data.begin() + 1, 2, data[3]);
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK_EQUAL(std::string("2"), data[0]);
+      CHECK_EQUAL(std::string("2"), data[1]);
+      CHECK_EQUAL(std::string("2"), data[2]);
+      CHECK_EQUAL(std::string("0"), data[3]);
+      CHECK_EQUAL(std::string("1"), data[4]);
+      CHECK_EQUAL(std::string("2"), data[5]);
+    }
   };
 }